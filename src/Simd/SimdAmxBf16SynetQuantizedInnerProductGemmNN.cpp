@@ -102,6 +102,12 @@ namespace Simd
             }
             else if (term == Term8iLast32f)
             {
+                __mmask16 tailN = TailMask16(N - F);
+                size_t M8 = AlignLo(M, 8), i = 0;
+                for (; i < M8; i += 8)
+                    Apply2x8<term>(C + i * dC, dC, sum + i * dS, dS, bias, norm, zero, tailN);
+                for (; i < M; ++i)
+                    Apply2<term>(C + i * dC, sum + i * dS, bias, norm, zero, tailN);
             }
             else
             {
@@ -161,6 +167,12 @@ namespace Simd
             }
             else if (term == Term8iLast32f)
             {
+                __mmask16 tailN = TailMask16(N);
+                size_t M8 = AlignLo(M, 8), i = 0;
+                for (; i < M8; i += 8)
+                    Apply1x8<term>(C + i * dC, dC, sum + i * dS, dS, bias, norm, zero, tailN);
+                for (; i < M; ++i)
+                    Apply1<term>(C + i * dC, sum + i * dS, bias, norm, zero, tailN);
             }
             else
             {
@@ -218,6 +230,12 @@ namespace Simd
             }
             else if (term == Term8iLast32f)
             {
+                __mmask16 tailN = TailMask16(N - F);
+                size_t M8 = AlignLo(M, 8), i = 0;
+                for (; i < M8; i += 8)
+                    Apply2x8<term>(C + i * dC, dC, sum + i * dS, dS, bias, norm, zero, tailN);
+                for (; i < M; ++i)
+                    Apply2<term>(C + i * dC, sum + i * dS, bias, norm, zero, tailN);
             }
             else
             {
@@ -262,6 +280,12 @@ namespace Simd
             }
             else if (term == Term8iLast32f)
             {
+                __mmask16 tailN = TailMask16(N);
+                size_t M8 = AlignLo(M, 8), i = 0;
+                for (; i < M8; i += 8)
+                    Apply1x8<term>(C + i * dC, dC, sum + i * dS, dS, bias, norm, zero, tailN);
+                for (; i < M; ++i)
+                    Apply1<term>(C + i * dC, sum + i * dS, bias, norm, zero, tailN);
             }
             else
             {
@@ -355,7 +379,7 @@ namespace Simd
                 if (p.typeC == SimdTensorData8u)
                     _gemm = QuantizedInnerProductGemm_2<Term8iLast8u>;
                 else
-                    _gemm = NULL;// QuantizedInnerProductGemm_2<Term8iLast32f>;
+                    _gemm = QuantizedInnerProductGemm_2<Term8iLast32f>;
             }
         }
     }
@@ -125,6 +125,101 @@ namespace Simd
     typedef Array<uint16_t*> Array16up;
     typedef Array<const uint16_t*> Array16ucp;
 
+    //-------------------------------------------------------------------------------------------------
+
+    template <class T> struct SharedArray
+    {
+        T * const data;
+        size_t const size;
+
+        SIMD_INLINE SharedArray(size_t size_ = 0, bool clear = false)
+            : data(0)
+            , size(0)
+        {
+            Resize(size_, clear);
+        }
+
+        SIMD_INLINE void Resize(size_t size_, bool clear = false)
+        {
+            if (size_ != size || !Unique())
+            {
+                _array.reset(size_ ? new Array<T>(size_) : NULL);
+                *(T**)&data = size_ ? _array->data : NULL;
+                *(size_t*)&size = size_;
+            }
+            if (clear)
+                Clear();
+        }
+
+        SIMD_INLINE void Assign(const T * src, size_t size_)
+        {
+            Resize(size_, src == NULL);
+            if (src)
+                memcpy(data, src, RawSize());
+        }
+
+        SIMD_INLINE void Clear()
+        {
+            memset(data, 0, RawSize());
+        }
+
+        SIMD_INLINE void Swap(Array<T> & array)
+        {
+            if (!Unique())
+                Resize(0);
+            if (!_array)
+                _array.reset(new Array<T>());
+            _array->Swap(array);
+            *(T**)&data = _array->data;
+            *(size_t*)&size = _array->size;
+        }
+
+        SIMD_INLINE void Share(const SharedArray & array)
+        {
+            _array = array._array;
+            *(T**)&data = array.data;
+            *(size_t*)&size = array.size;
+        }
+
+        SIMD_INLINE void External(T * data_, size_t size_)
+        {
+            _array.reset();
+            *(T**)&data = data_;
+            *(size_t*)&size = size_;
+        }
+
+        SIMD_INLINE bool Unique() const
+        {
+            return _array ? _array.use_count() == 1 : data == NULL;
+        }
+
+        SIMD_INLINE T & operator[] (size_t i)
+        {
+            return data[i];
+        }
+
+        SIMD_INLINE const T & operator[] (size_t i) const
+        {
+            return data[i];
+        }
+
+        SIMD_INLINE size_t RawSize() const
+        {
+            return size * sizeof(T);
+        }
+
+        SIMD_INLINE bool Empty() const
+        {
+            return data == NULL;
+        }
+
+    private:
+        std::shared_ptr<Array<T>> _array;
+    };
+
+    typedef SharedArray<int8_t> SharedArray8i;
+    typedef SharedArray<uint16_t> SharedArray16u;
+
 #if defined(__GNUC__) && __GNUC__ >= 6
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wignored-attributes"
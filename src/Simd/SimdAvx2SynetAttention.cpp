@@ -0,0 +1,158 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetAttention.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx2
+    {
+        static void Convert32f(const uint8_t* src8, size_t count, size_t stride, size_t size, float scale, float* dst)
+        {
+            const float* src = (const float*)src8;
+            size_t sizeF = AlignLo(size, F);
+            __m256 _scale = _mm256_set1_ps(scale);
+            for (size_t i = 0; i < count; ++i, src += stride, dst += size)
+            {
+                size_t j = 0;
+                for (; j < sizeF; j += F)
+                    _mm256_storeu_ps(dst + j, _mm256_mul_ps(_mm256_loadu_ps(src + j), _scale));
+                for (; j < size; ++j)
+                    dst[j] = src[j] * scale;
+            }
+        }
+
+        static void Convert16b(const uint8_t* src8, size_t count, size_t stride, size_t size, float scale, float* dst)
+        {
+            const uint16_t* src = (const uint16_t*)src8;
+            size_t sizeF = AlignLo(size, F);
+            __m256 _scale = _mm256_set1_ps(scale);
+            for (size_t i = 0; i < count; ++i, src += stride, dst += size)
+            {
+                size_t j = 0;
+                for (; j < sizeF; j += F)
+                    _mm256_storeu_ps(dst + j, _mm256_mul_ps(BFloat16ToFloat32(_mm_loadu_si128((__m128i*)(src + j))), _scale));
+                for (; j < size; ++j)
+                    dst[j] = Base::BFloat16ToFloat32(src[j]) * scale;
+            }
+        }
+
+        static void Attention(const float* q, const float* k, const float* v, size_t stride, size_t keys, size_t size, float* buf, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F);
+            float max = -FLT_MAX, sum = 0.0f;
+            for (size_t j = 0; j < size; ++j)
+                dst[j] = 0.0f;
+            for (size_t t = 0; t < keys; t += Base::SynetAttention::KEY_TILE)
+            {
+                size_t n = Simd::Min(Base::SynetAttention::KEY_TILE, keys - t), nF = AlignLo(n, F), i;
+                float tileMax = -FLT_MAX;
+                for (i = 0; i < n; ++i)
+                {
+                    const float* ki = k + (t + i) * stride;
+                    __m256 _dot = _mm256_setzero_ps();
+                    size_t j = 0;
+                    for (; j < sizeF; j += F)
+                        _dot = _mm256_fmadd_ps(_mm256_loadu_ps(q + j), _mm256_loadu_ps(ki + j), _dot);
+                    float dot = ExtractSum(_dot);
+                    for (; j < size; ++j)
+                        dot += q[j] * ki[j];
+                    buf[i] = dot;
+                    tileMax = Simd::Max(tileMax, dot);
+                }
+                if (tileMax > max)
+                {
+                    __m256 corr = _mm256_set1_ps(::expf(max - tileMax));
+                    sum *= _mm256_cvtss_f32(corr);
+                    size_t j = 0;
+                    for (; j < sizeF; j += F)
+                        _mm256_storeu_ps(dst + j, _mm256_mul_ps(_mm256_loadu_ps(dst + j), corr));
+                    for (; j < size; ++j)
+                        dst[j] *= _mm256_cvtss_f32(corr);
+                    max = tileMax;
+                }
+                __m256 _max = _mm256_set1_ps(max), _sum = _mm256_setzero_ps();
+                for (i = 0; i < nF; i += F)
+                {
+                    __m256 p = Exponent(_mm256_sub_ps(_mm256_loadu_ps(buf + i), _max));
+                    _sum = _mm256_add_ps(_sum, p);
+                    _mm256_storeu_ps(buf + i, p);
+                }
+                for (; i < n; ++i)
+                {
+                    buf[i] = ::expf(buf[i] - max);
+                    sum += buf[i];
+                }
+                sum += ExtractSum(_sum);
+                for (i = 0; i < n; ++i)
+                {
+                    const float* vi = v + (t + i) * stride;
+                    __m256 p = _mm256_set1_ps(buf[i]);
+                    size_t j = 0;
+                    for (; j < sizeF; j += F)
+                        _mm256_storeu_ps(dst + j, _mm256_fmadd_ps(p, _mm256_loadu_ps(vi + j), _mm256_loadu_ps(dst + j)));
+                    for (; j < size; ++j)
+                        dst[j] += buf[i] * vi[j];
+                }
+            }
+            __m256 norm = _mm256_set1_ps(1.0f / sum);
+            size_t j = 0;
+            for (; j < sizeF; j += F)
+                _mm256_storeu_ps(dst + j, _mm256_mul_ps(_mm256_loadu_ps(dst + j), norm));
+            for (; j < size; ++j)
+                dst[j] *= _mm256_cvtss_f32(norm);
+        }
+
+        static void Store16b(const float* src, size_t size, uint8_t* dst)
+        {
+            Float32ToBFloat16(src, size, (uint16_t*)dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetAttention::SynetAttention(const AttentionParam& p)
+            : Base::SynetAttention(p)
+        {
+            _convert = p.srcType == SimdTensorData32f ? Convert32f : Convert16b;
+            _attention = Attention;
+            if (p.dstType == SimdTensorData16b)
+                _store = Store16b;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetAttentionInit(size_t batch, size_t heads, size_t queries, size_t keys, size_t size, SimdTensorDataType srcType, SimdTensorDataType dstType, float scale)
+        {
+            AttentionParam param(batch, heads, queries, keys, size, srcType, dstType, scale);
+            if (!param.Valid())
+                return NULL;
+            return new SynetAttention(param);
+        }
+    }
+#endif
+}
@@ -541,7 +541,7 @@ namespace Simd
                     _nhwcWeight.Resize(_gemmCb.At(0).BufferSize(_M*_merge, _N, _K));
                 }
                 else
-                    _nhwcWeight.Resize(Avx2::Gemm32fNNcbBufferSize(_M*_merge, _N, _K, GemmKernelAny, NHWC_GEMM_COMPATIBLE));
+                    _nhwcWeight.Resize(Avx2::Gemm32fNNcbBufferSize(_M*_merge, _N, _K, GemmKernelAny, _nhwcCompatible));
                 _nhwcRun = Avx2::Gemm32fNNcbRun;
                 _nhwcReorderB = Avx2::Gemm32fNNcbReorderB;
             }
@@ -102,9 +102,7 @@ namespace Simd
 
         SIMD_INLINE void ConvertBn(const float* src, size_t stride, uint16_t* dst)
         {
-            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(_mm256_castps_si256(_mm256_loadu_ps(src + 0 * stride)), Bf16::ROUND), Base::Bf16::SHIFT);
-            __m256i d1 = _mm256_and_si256(_mm256_add_epi32(_mm256_castps_si256(_mm256_loadu_ps(src + 1 * stride)), Bf16::ROUND), Bf16::MASK);
-            _mm256_storeu_si256((__m256i*)dst, _mm256_or_si256(d0, d1));
+            _mm256_storeu_si256((__m256i*)dst, Float32ToBFloat16Interlived(_mm256_loadu_ps(src + 0 * stride), _mm256_loadu_ps(src + 1 * stride)));
         }
 
         static void InnerProduct16bGemmNN_ConvertBn(const uint8_t* src8, const InnerProductParam16b& p, const AlgParam& a, size_t N, size_t K, uint16_t* dst)
@@ -0,0 +1,202 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx2
+    {
+        SIMD_INLINE const float* NormInput(const float* src, const float* add, size_t size, float* sum, float* dst)
+        {
+            if (add == NULL)
+                return src;
+            float* out = sum ? sum : dst;
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(src + i), _mm256_loadu_ps(add + i)));
+            for (; i < size; ++i)
+                out[i] = src[i] + add[i];
+            return out;
+        }
+
+        static void LayerNorm(const float* x, size_t size, const float* scale, const float* shift, float eps, float* dst)
+        {
+            float k = 1.0f / float(size);
+            size_t sizeF = AlignLo(size, F), i;
+            __m256 _sum = _mm256_setzero_ps();
+            for (i = 0; i < sizeF; i += F)
+                _sum = _mm256_add_ps(_mm256_loadu_ps(x + i), _sum);
+            float sum = ExtractSum(_sum);
+            for (; i < size; ++i)
+                sum += x[i];
+            float mean = sum * k;
+            __m256 _mean = _mm256_set1_ps(mean);
+            __m256 _sqsum = _mm256_setzero_ps();
+            for (i = 0; i < sizeF; i += F)
+            {
+                __m256 _d = _mm256_sub_ps(_mm256_loadu_ps(x + i), _mean);
+                _sqsum = _mm256_fmadd_ps(_d, _d, _sqsum);
+            }
+            float sqsum = ExtractSum(_sqsum);
+            for (; i < size; ++i)
+                sqsum += Simd::Square(x[i] - mean);
+            float norm = 1.0f / ::sqrt(sqsum * k + eps);
+            __m256 _norm = _mm256_set1_ps(norm);
+            if (shift)
+            {
+                for (i = 0; i < sizeF; i += F)
+                    _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(x + i), _mean), _norm), _mm256_loadu_ps(scale + i), _mm256_loadu_ps(shift + i)));
+                for (; i < size; ++i)
+                    dst[i] = (x[i] - mean) * norm * scale[i] + shift[i];
+            }
+            else
+            {
+                for (i = 0; i < sizeF; i += F)
+                    _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(x + i), _mean), _norm), _mm256_loadu_ps(scale + i)));
+                for (; i < size; ++i)
+                    dst[i] = (x[i] - mean) * norm * scale[i];
+            }
+        }
+
+        static void RmsNorm(const float* x, size_t size, const float* scale, float eps, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), i;
+            __m256 _sqsum = _mm256_setzero_ps();
+            for (i = 0; i < sizeF; i += F)
+            {
+                __m256 _x = _mm256_loadu_ps(x + i);
+                _sqsum = _mm256_fmadd_ps(_x, _x, _sqsum);
+            }
+            float sqsum = ExtractSum(_sqsum);
+            for (; i < size; ++i)
+                sqsum += Simd::Square(x[i]);
+            float norm = 1.0f / ::sqrt(sqsum / float(size) + eps);
+            __m256 _norm = _mm256_set1_ps(norm);
+            for (i = 0; i < sizeF; i += F)
+                _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(x + i), _norm), _mm256_loadu_ps(scale + i)));
+            for (; i < size; ++i)
+                dst[i] = x[i] * norm * scale[i];
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void SynetLayerNorm32f(const float* src, const float* add, size_t count, size_t size,
+            const float* scale, const float* shift, const float* eps, float* sum, float* dst)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                LayerNorm(NormInput(src, add, size, sum, dst), size, scale, shift, *eps, dst);
+                src += size;
+                dst += size;
+                if (add)
+                    add += size;
+                if (add && sum)
+                    sum += size;
+            }
+        }
+
+        void SynetRmsNorm32f(const float* src, const float* add, size_t count, size_t size,
+            const float* scale, const float* eps, float* sum, float* dst)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                RmsNorm(NormInput(src, add, size, sum, dst), size, scale, *eps, dst);
+                src += size;
+                dst += size;
+                if (add)
+                    add += size;
+                if (add && sum)
+                    sum += size;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE float* NormInput16b(const uint16_t* src, const uint16_t* add, size_t size, float* buf, uint16_t* sum)
+        {
+            BFloat16ToFloat32(src, size, buf);
+            if (add)
+            {
+                BFloat16ToFloat32(add, size, buf + size);
+                NormInput(buf, buf + size, size, NULL, buf);
+                if (sum)
+                    Float32ToBFloat16(buf, size, sum);
+            }
+            return buf;
+        }
+
+        void SynetLayerNorm16b(const uint16_t* src, const uint16_t* add, size_t count, size_t size,
+            const float* scale, const float* shift, const float* eps, float* buf, uint16_t* sum, uint16_t* dst)
+        {
+            Array32f _buf;
+            if (buf == NULL)
+            {
+                _buf.Resize(size * 2);
+                buf = _buf.data;
+            }
+            for (size_t i = 0; i < count; ++i)
+            {
+                float* x = NormInput16b(src, add, size, buf, sum);
+                LayerNorm(x, size, scale, shift, *eps, x);
+                Float32ToBFloat16(x, size, dst);
+                src += size;
+                dst += size;
+                if (add)
+                    add += size;
+                if (add && sum)
+                    sum += size;
+            }
+        }
+
+        void SynetRmsNorm16b(const uint16_t* src, const uint16_t* add, size_t count, size_t size,
+            const float* scale, const float* eps, float* buf, uint16_t* sum, uint16_t* dst)
+        {
+            Array32f _buf;
+            if (buf == NULL)
+            {
+                _buf.Resize(size * 2);
+                buf = _buf.data;
+            }
+            for (size_t i = 0; i < count; ++i)
+            {
+                float* x = NormInput16b(src, add, size, buf, sum);
+                RmsNorm(x, size, scale, *eps, x);
+                Float32ToBFloat16(x, size, dst);
+                src += size;
+                dst += size;
+                if (add)
+                    add += size;
+                if (add && sum)
+                    sum += size;
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,396 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+#include "Simd/SimdBFloat16.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE)  
+    namespace Avx2
+    {
+        SIMD_INLINE __m256 LoadAs32f(const float* src)
+        {
+            return _mm256_loadu_ps(src);
+        }
+
+        SIMD_INLINE __m256 LoadAs32f(const uint16_t* src)
+        {
+            return BFloat16ToFloat32(_mm_loadu_si128((__m128i*)src));
+        }
+
+        SIMD_INLINE float LoadAs32f(float src)
+        {
+            return src;
+        }
+
+        SIMD_INLINE float LoadAs32f(uint16_t src)
+        {
+            return Base::BFloat16ToFloat32(src);
+        }
+
+        SIMD_INLINE void SaveAs32f(float* dst, __m256 value)
+        {
+            _mm256_storeu_ps(dst, value);
+        }
+
+        SIMD_INLINE void SaveAs32f(uint16_t* dst, __m256 value)
+        {
+            _mm_storeu_si128((__m128i*)dst, PackFloat32ToBFloat16(value));
+        }
+
+        SIMD_INLINE void SaveAs32f(float* dst, float value)
+        {
+            *dst = value;
+        }
+
+        SIMD_INLINE void SaveAs32f(uint16_t* dst, float value)
+        {
+            *dst = Base::Float32ToBFloat16(value);
+        }
+
+        template<SimdSynetPoolingMethodType method> SIMD_INLINE __m256 PoolingAdaptive(__m256 acc, __m256 val)
+        {
+            return method == SimdSynetPoolingMethodMax ? _mm256_max_ps(acc, val) : _mm256_add_ps(acc, val);
+        }
+
+        template<SimdSynetPoolingMethodType method> SIMD_INLINE float PoolingAdaptive(float acc, float val)
+        {
+            return method == SimdSynetPoolingMethodMax ? Simd::Max(acc, val) : acc + val;
+        }
+
+        SIMD_INLINE float ExtractMax(__m256 a)
+        {
+            __m128 b = _mm_max_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+            b = _mm_max_ps(b, _mm_movehl_ps(b, b));
+            b = _mm_max_ss(b, _mm_shuffle_ps(b, b, 1));
+            return _mm_cvtss_f32(b);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<class T, SimdSynetPoolingMethodType method, int N> SIMD_INLINE void PoolingAdaptive32fNhwc(const T* src, size_t srcS, size_t srcC,
+            size_t kH, size_t kW, const __m256& init, const __m256& norm, T* dst)
+        {
+            __m256 acc0 = init, acc1 = init, acc2 = init, acc3 = init;
+            for (size_t h = 0; h < kH; ++h)
+            {
+                for (size_t w = 0; w < kW; ++w)
+                {
+                    const T* ps = src + w * srcC;
+                    if (N > 0) acc0 = PoolingAdaptive<method>(acc0, LoadAs32f(ps + 0 * F));
+                    if (N > 1) acc1 = PoolingAdaptive<method>(acc1, LoadAs32f(ps + 1 * F));
+                    if (N > 2) acc2 = PoolingAdaptive<method>(acc2, LoadAs32f(ps + 2 * F));
+                    if (N > 3) acc3 = PoolingAdaptive<method>(acc3, LoadAs32f(ps + 3 * F));
+                }
+                src += srcS;
+            }
+            if (method == SimdSynetPoolingMethodAverage)
+            {
+                if (N > 0) acc0 = _mm256_mul_ps(acc0, norm);
+                if (N > 1) acc1 = _mm256_mul_ps(acc1, norm);
+                if (N > 2) acc2 = _mm256_mul_ps(acc2, norm);
+                if (N > 3) acc3 = _mm256_mul_ps(acc3, norm);
+            }
+            if (N > 0) SaveAs32f(dst + 0 * F, acc0);
+            if (N > 1) SaveAs32f(dst + 1 * F, acc1);
+            if (N > 2) SaveAs32f(dst + 2 * F, acc2);
+            if (N > 3) SaveAs32f(dst + 3 * F, acc3);
+        }
+
+        template<class T, SimdSynetPoolingMethodType method> SIMD_INLINE void PoolingAdaptive32fNhwc1(const T* src, size_t srcS, size_t srcC,
+            size_t kH, size_t kW, float init, float norm, T* dst)
+        {
+            float acc = init;
+            for (size_t h = 0; h < kH; ++h, src += srcS)
+                for (size_t w = 0; w < kW; ++w)
+                    acc = PoolingAdaptive<method>(acc, LoadAs32f(src[w * srcC]));
+            SaveAs32f(dst, method == SimdSynetPoolingMethodAverage ? acc * norm : acc);
+        }
+
+        template<class T, SimdSynetPoolingMethodType method> void PoolingAdaptive32fNhwc(const T* src, size_t srcC, size_t srcH, size_t srcW, T* dst, size_t dstH, size_t dstW)
+        {
+            size_t srcCF = AlignLo(srcC, F), srcC4F = AlignLo(srcC, 4 * F), srcS = srcW * srcC;
+            float init = method == SimdSynetPoolingMethodMax ? -FLT_MAX : 0.0f;
+            __m256 _init = _mm256_set1_ps(init);
+            for (size_t dy = 0; dy < dstH; ++dy)
+            {
+                size_t yBeg = Base::AdaptivePoolingBeg(dy, srcH, dstH), yEnd = Base::AdaptivePoolingEnd(dy, srcH, dstH);
+                for (size_t dx = 0; dx < dstW; ++dx)
+                {
+                    size_t xBeg = Base::AdaptivePoolingBeg(dx, srcW, dstW), xEnd = Base::AdaptivePoolingEnd(dx, srcW, dstW);
+                    size_t kH = yEnd - yBeg, kW = xEnd - xBeg, c = 0;
+                    const T* ps = src + (yBeg * srcW + xBeg) * srcC;
+                    float norm = 1.0f / float(kH * kW);
+                    __m256 _norm = _mm256_set1_ps(norm);
+                    for (; c < srcC4F; c += 4 * F)
+                        PoolingAdaptive32fNhwc<T, method, 4>(ps + c, srcS, srcC, kH, kW, _init, _norm, dst + c);
+                    for (; c < srcCF; c += F)
+                        PoolingAdaptive32fNhwc<T, method, 1>(ps + c, srcS, srcC, kH, kW, _init, _norm, dst + c);
+                    for (; c < srcC; ++c)
+                        PoolingAdaptive32fNhwc1<T, method>(ps + c, srcS, srcC, kH, kW, init, norm, dst + c);
+                    dst += srcC;
+                }
+            }
+        }
+
+        template<class T, SimdSynetPoolingMethodType method> SIMD_INLINE void PoolingAdaptive32fNchw(const T* src, size_t size, __m256& acc, float & rem)
+        {
+            size_t i = 0, sizeF = AlignLo(size, F), size4F = AlignLo(size, 4 * F);
+            if (size4F)
+            {
+                __m256 acc1 = acc, acc2 = acc, acc3 = acc;
+                for (; i < size4F; i += 4 * F)
+                {
+                    acc = PoolingAdaptive<method>(acc, LoadAs32f(src + i + 0 * F));
+                    acc1 = PoolingAdaptive<method>(acc1, LoadAs32f(src + i + 1 * F));
+                    acc2 = PoolingAdaptive<method>(acc2, LoadAs32f(src + i + 2 * F));
+                    acc3 = PoolingAdaptive<method>(acc3, LoadAs32f(src + i + 3 * F));
+                }
+                acc = PoolingAdaptive<method>(PoolingAdaptive<method>(acc, acc1), PoolingAdaptive<method>(acc2, acc3));
+            }
+            for (; i < sizeF; i += F)
+                acc = PoolingAdaptive<method>(acc, LoadAs32f(src + i));
+            for (; i < size; ++i)
+                rem = PoolingAdaptive<method>(rem, LoadAs32f(src[i]));
+        }
+
+        template<class T, SimdSynetPoolingMethodType method> void PoolingAdaptive32fNchw(const T* src, size_t srcC, size_t srcH, size_t srcW, T* dst, size_t dstH, size_t dstW)
+        {
+            float init = method == SimdSynetPoolingMethodMax ? -FLT_MAX : 0.0f;
+            __m256 _init = _mm256_set1_ps(init);
+            for (size_t c = 0; c < srcC; ++c)
+            {
+                for (size_t dy = 0; dy < dstH; ++dy)
+                {
+                    size_t yBeg = Base::AdaptivePoolingBeg(dy, srcH, dstH), yEnd = Base::AdaptivePoolingEnd(dy, srcH, dstH);
+                    for (size_t dx = 0; dx < dstW; ++dx)
+                    {
+                        size_t xBeg = Base::AdaptivePoolingBeg(dx, srcW, dstW), xEnd = Base::AdaptivePoolingEnd(dx, srcW, dstW);
+                        __m256 acc = _init;
+                        float rem = init;
+                        if (xBeg == 0 && xEnd == srcW)
+                            PoolingAdaptive32fNchw<T, method>(src + yBeg * srcW, (yEnd - yBeg) * srcW, acc, rem);
+                        else
+                        {
+                            for (size_t sy = yBeg; sy < yEnd; ++sy)
+                                PoolingAdaptive32fNchw<T, method>(src + sy * srcW + xBeg, xEnd - xBeg, acc, rem);
+                        }
+                        if (method == SimdSynetPoolingMethodMax)
+                            SaveAs32f(dst, Simd::Max(ExtractMax(acc), rem));
+                        else
+                            SaveAs32f(dst, (ExtractSum(acc) + rem) / float((yEnd - yBeg) * (xEnd - xBeg)));
+                        dst += 1;
+                    }
+                }
+                src += srcH * srcW;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void PoolingAdaptiveMax8uNhwc(const uint8_t* src, size_t srcS, size_t srcC, size_t kH, size_t kW, uint8_t* dst)
+        {
+            __m256i max0 = _mm256_setzero_si256();
+            for (size_t h = 0; h < kH; ++h)
+            {
+                for (size_t w = 0; w < kW; ++w)
+                    max0 = _mm256_max_epu8(max0, _mm256_loadu_si256((__m256i*)(src + w * srcC)));
+                src += srcS;
+            }
+            _mm256_storeu_si256((__m256i*)dst, max0);
+        }
+
+        SIMD_INLINE void PoolingAdaptiveAverage8uNhwc(const uint8_t* src, size_t srcS, size_t srcC, size_t kH, size_t kW, uint32_t size, uint8_t* dst)
+        {
+            __m256i sum0 = _mm256_setzero_si256(), sum1 = _mm256_setzero_si256(), sum2 = _mm256_setzero_si256(), sum3 = _mm256_setzero_si256();
+            for (size_t h = 0; h < kH; ++h)
+            {
+                for (size_t w = 0; w < kW; ++w)
+                {
+                    const uint8_t* ps = src + w * srcC;
+                    sum0 = _mm256_add_epi32(sum0, _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(ps + 0 * F))));
+                    sum1 = _mm256_add_epi32(sum1, _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(ps + 1 * F))));
+                    sum2 = _mm256_add_epi32(sum2, _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(ps + 2 * F))));
+                    sum3 = _mm256_add_epi32(sum3, _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(ps + 3 * F))));
+                }
+                src += srcS;
+            }
+            SIMD_ALIGNED(32) uint32_t sum[A];
+            _mm256_store_si256((__m256i*)sum + 0, sum0);
+            _mm256_store_si256((__m256i*)sum + 1, sum1);
+            _mm256_store_si256((__m256i*)sum + 2, sum2);
+            _mm256_store_si256((__m256i*)sum + 3, sum3);
+            uint32_t half = size / 2;
+            for (size_t i = 0; i < A; ++i)
+                dst[i] = (uint8_t)((sum[i] + half) / size);
+        }
+
+        template<SimdSynetPoolingMethodType method> void PoolingAdaptive8uNhwc(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, uint8_t* dst, size_t dstH, size_t dstW)
+        {
+            size_t srcCA = AlignLo(srcC, A), srcS = srcW * srcC;
+            for (size_t dy = 0; dy < dstH; ++dy)
+            {
+                size_t yBeg = Base::AdaptivePoolingBeg(dy, srcH, dstH), yEnd = Base::AdaptivePoolingEnd(dy, srcH, dstH);
+                for (size_t dx = 0; dx < dstW; ++dx)
+                {
+                    size_t xBeg = Base::AdaptivePoolingBeg(dx, srcW, dstW), xEnd = Base::AdaptivePoolingEnd(dx, srcW, dstW);
+                    size_t kH = yEnd - yBeg, kW = xEnd - xBeg, c = 0;
+                    uint32_t size = uint32_t(kH * kW);
+                    const uint8_t* ps = src + (yBeg * srcW + xBeg) * srcC;
+                    for (; c < srcCA; c += A)
+                    {
+                        if (method == SimdSynetPoolingMethodMax)
+                            PoolingAdaptiveMax8uNhwc(ps + c, srcS, srcC, kH, kW, dst + c);
+                        else
+                            PoolingAdaptiveAverage8uNhwc(ps + c, srcS, srcC, kH, kW, size, dst + c);
+                    }
+                    for (; c < srcC; ++c)
+                    {
+                        uint32_t acc = 0;
+                        for (size_t h = 0; h < kH; ++h)
+                            for (size_t w = 0; w < kW; ++w)
+                                acc = method == SimdSynetPoolingMethodMax ? Simd::Max<uint32_t>(acc, ps[h * srcS + w * srcC + c]) : acc + ps[h * srcS + w * srcC + c];
+                        dst[c] = method == SimdSynetPoolingMethodMax ? (uint8_t)acc : (uint8_t)((acc + size / 2) / size);
+                    }
+                    dst += srcC;
+                }
+            }
+        }
+
+        template<SimdSynetPoolingMethodType method> SIMD_INLINE void PoolingAdaptive8uNchw(const uint8_t* src, size_t size, __m256i& acc, uint32_t & rem)
+        {
+            size_t i = 0, sizeA = AlignLo(size, A);
+            for (; i < sizeA; i += A)
+            {
+                __m256i _src = _mm256_loadu_si256((__m256i*)(src + i));
+                if (method == SimdSynetPoolingMethodMax)
+                    acc = _mm256_max_epu8(acc, _src);
+                else
+                    acc = _mm256_add_epi64(acc, _mm256_sad_epu8(_src, K_ZERO));
+            }
+            for (; i < size; ++i)
+                rem = method == SimdSynetPoolingMethodMax ? Simd::Max<uint32_t>(rem, src[i]) : rem + src[i];
+        }
+
+        SIMD_INLINE uint8_t ExtractMax8u(__m256i a)
+        {
+            __m128i b = _mm_max_epu8(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1));
+            b = _mm_max_epu8(b, _mm_srli_si128(b, 8));
+            b = _mm_max_epu8(b, _mm_srli_si128(b, 4));
+            b = _mm_max_epu8(b, _mm_srli_si128(b, 2));
+            b = _mm_max_epu8(b, _mm_srli_si128(b, 1));
+            return (uint8_t)_mm_cvtsi128_si32(b);
+        }
+
+        template<SimdSynetPoolingMethodType method> void PoolingAdaptive8uNchw(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, uint8_t* dst, size_t dstH, size_t dstW)
+        {
+            for (size_t c = 0; c < srcC; ++c)
+            {
+                for (size_t dy = 0; dy < dstH; ++dy)
+                {
+                    size_t yBeg = Base::AdaptivePoolingBeg(dy, srcH, dstH), yEnd = Base::AdaptivePoolingEnd(dy, srcH, dstH);
+                    for (size_t dx = 0; dx < dstW; ++dx)
+                    {
+                        size_t xBeg = Base::AdaptivePoolingBeg(dx, srcW, dstW), xEnd = Base::AdaptivePoolingEnd(dx, srcW, dstW);
+                        __m256i acc = _mm256_setzero_si256();
+                        uint32_t rem = 0;
+                        if (xBeg == 0 && xEnd == srcW)
+                            PoolingAdaptive8uNchw<method>(src + yBeg * srcW, (yEnd - yBeg) * srcW, acc, rem);
+                        else
+                        {
+                            for (size_t sy = yBeg; sy < yEnd; ++sy)
+                                PoolingAdaptive8uNchw<method>(src + sy * srcW + xBeg, xEnd - xBeg, acc, rem);
+                        }
+                        if (method == SimdSynetPoolingMethodMax)
+                            dst[0] = Simd::Max(ExtractMax8u(acc), (uint8_t)rem);
+                        else
+                        {
+                            uint64_t size = (yEnd - yBeg) * (xEnd - xBeg);
+                            dst[0] = (uint8_t)((ExtractSum<uint64_t>(acc) + rem + size / 2) / size);
+                        }
+                        dst += 1;
+                    }
+                }
+                src += srcH * srcW;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<class T, SimdSynetPoolingMethodType method> void SynetPoolingAdaptive32f(const T* src, size_t srcC, size_t srcH, size_t srcW,
+            T* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+        {
+            if (Base::NhwcCompatible(srcC, srcH * srcW, format))
+                PoolingAdaptive32fNhwc<T, method>(src, srcC, srcH, srcW, dst, dstH, dstW);
+            else
+                PoolingAdaptive32fNchw<T, method>(src, srcC, srcH, srcW, dst, dstH, dstW);
+        }
+
+        template<SimdSynetPoolingMethodType method> void SynetPoolingAdaptive8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW,
+            uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+        {
+            if (Base::NhwcCompatible(srcC, srcH * srcW, format))
+                PoolingAdaptive8uNhwc<method>(src, srcC, srcH, srcW, dst, dstH, dstW);
+            else
+                PoolingAdaptive8uNchw<method>(src, srcC, srcH, srcW, dst, dstH, dstW);
+        }
+
+        void SynetPoolingAdaptive(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, SimdTensorDataType type,
+            SimdSynetPoolingMethodType method, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+        {
+            bool max = method == SimdSynetPoolingMethodMax;
+            if (!max && method != SimdSynetPoolingMethodAverage)
+                assert(0);
+            else if (type == SimdTensorData32f)
+            {
+                if (max)
+                    SynetPoolingAdaptive32f<float, SimdSynetPoolingMethodMax>((float*)src, srcC, srcH, srcW, (float*)dst, dstH, dstW, format);
+                else
+                    SynetPoolingAdaptive32f<float, SimdSynetPoolingMethodAverage>((float*)src, srcC, srcH, srcW, (float*)dst, dstH, dstW, format);
+            }
+            else if (type == SimdTensorData16b)
+            {
+                if (max)
+                    SynetPoolingAdaptive32f<uint16_t, SimdSynetPoolingMethodMax>((uint16_t*)src, srcC, srcH, srcW, (uint16_t*)dst, dstH, dstW, format);
+                else
+                    SynetPoolingAdaptive32f<uint16_t, SimdSynetPoolingMethodAverage>((uint16_t*)src, srcC, srcH, srcW, (uint16_t*)dst, dstH, dstW, format);
+            }
+            else if (type == SimdTensorData8u)
+            {
+                if (max)
+                    SynetPoolingAdaptive8u<SimdSynetPoolingMethodMax>(src, srcC, srcH, srcW, dst, dstH, dstW, format);
+                else
+                    SynetPoolingAdaptive8u<SimdSynetPoolingMethodAverage>(src, srcC, srcH, srcW, dst, dstH, dstW, format);
+            }
+            else
+                assert(0);
+        }
+    }
+#endif
+}
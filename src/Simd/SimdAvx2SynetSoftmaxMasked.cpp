@@ -0,0 +1,143 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdArray.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetAdd16bCommon.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx2
+    {
+        template<class T> SIMD_INLINE __m256 LoadMasked(const T* src);
+
+        template<> SIMD_INLINE __m256 LoadMasked(const float* src)
+        {
+            return _mm256_loadu_ps(src);
+        }
+
+        template<> SIMD_INLINE __m256 LoadMasked(const uint16_t* src)
+        {
+            return BFloat16ToFloat32(_mm_loadu_si128((__m128i*)src));
+        }
+
+        template<class T> SIMD_INLINE void StoreMasked(T* dst, __m256 value);
+
+        template<> SIMD_INLINE void StoreMasked(float* dst, __m256 value)
+        {
+            _mm256_storeu_ps(dst, value);
+        }
+
+        template<> SIMD_INLINE void StoreMasked(uint16_t* dst, __m256 value)
+        {
+            _mm_storeu_si128((__m128i*)dst, PackFloat32ToBFloat16(value));
+        }
+
+        SIMD_INLINE float ExtractMax(__m256 value)
+        {
+            __m128 max = _mm_max_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1));
+            max = _mm_max_ps(max, _mm_movehl_ps(max, max));
+            max = _mm_max_ss(max, _mm_shuffle_ps(max, max, 1));
+            return _mm_cvtss_f32(max);
+        }
+
+        template<class T> void SynetSoftmaxMasked(const T* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, T* dst)
+        {
+            Exp exp;
+            Array32f _buf(count);
+            float* buf = _buf.data;
+            size_t countF = AlignLo(count, F), c;
+            for (size_t o = 0; o < outer; ++o)
+            {
+                const float* m = mask ? mask + (o % maskOuter) * count : NULL;
+                __m256 _max = _mm256_set1_ps(-FLT_MAX);
+                for (c = 0; c < countF; c += F)
+                {
+                    __m256 value = LoadMasked(src + c);
+                    if (m)
+                        value = _mm256_add_ps(value, _mm256_loadu_ps(m + c));
+                    _mm256_storeu_ps(buf + c, value);
+                    _max = _mm256_max_ps(_max, value);
+                }
+                float max = ExtractMax(_max);
+                for (; c < count; ++c)
+                {
+                    buf[c] = Base::Convert16b<T, float>(src[c]) + (m ? m[c] : 0.0f);
+                    max = Simd::Max(max, buf[c]);
+                }
+                _max = _mm256_set1_ps(max);
+                __m256 _sum = _mm256_setzero_ps();
+                for (c = 0; c < countF; c += F)
+                {
+                    __m256 value = exp.Exponent(_mm256_sub_ps(_mm256_loadu_ps(buf + c), _max));
+                    if (!log)
+                        _mm256_storeu_ps(buf + c, value);
+                    _sum = _mm256_add_ps(_sum, value);
+                }
+                float sum = ExtractSum(_sum);
+                for (; c < count; ++c)
+                {
+                    float value = ::exp(buf[c] - max);
+                    if (!log)
+                        buf[c] = value;
+                    sum += value;
+                }
+                if (log)
+                {
+                    float shift = ::log(sum);
+                    __m256 _shift = _mm256_set1_ps(shift);
+                    for (c = 0; c < countF; c += F)
+                        StoreMasked(dst + c, _mm256_sub_ps(_mm256_sub_ps(_mm256_loadu_ps(buf + c), _max), _shift));
+                    for (; c < count; ++c)
+                        dst[c] = Base::Convert16b<float, T>(buf[c] - max - shift);
+                }
+                else
+                {
+                    float k = 1.0f / sum;
+                    __m256 _k = _mm256_set1_ps(k);
+                    for (c = 0; c < countF; c += F)
+                        StoreMasked(dst + c, _mm256_mul_ps(_mm256_loadu_ps(buf + c), _k));
+                    for (; c < count; ++c)
+                        dst[c] = Base::Convert16b<float, T>(buf[c] * k);
+                }
+                src += count;
+                dst += count;
+            }
+        }
+
+        void SynetSoftmaxMasked32f(const float* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, float* dst)
+        {
+            SynetSoftmaxMasked(src, outer, count, mask, maskOuter, log, dst);
+        }
+
+        void SynetSoftmaxMasked16b(const uint16_t* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, uint16_t* dst)
+        {
+            SynetSoftmaxMasked(src, outer, count, mask, maskOuter, log, dst);
+        }
+    }
+#endif
+}
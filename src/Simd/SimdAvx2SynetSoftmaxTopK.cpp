@@ -0,0 +1,106 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetAdd16bCommon.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx2
+    {
+        template<class T> SIMD_INLINE __m256 LoadTopK(const T* src);
+
+        template<> SIMD_INLINE __m256 LoadTopK(const float* src)
+        {
+            return _mm256_loadu_ps(src);
+        }
+
+        template<> SIMD_INLINE __m256 LoadTopK(const uint16_t* src)
+        {
+            return BFloat16ToFloat32(_mm_loadu_si128((__m128i*)src));
+        }
+
+        template<class T> void SynetSoftmaxTopK(const T* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value)
+        {
+            Exp exp;
+            size_t countF = AlignLo(count, F);
+            for (size_t o = 0; o < outer; ++o)
+            {
+                size_t c = 0;
+                for (; c < k; ++c)
+                    Base::SynetSoftmaxTopKInsert(Base::Convert16b<T, float>(src[c]), (uint32_t)c, c + 1, value, index);
+                __m256 threshold = _mm256_set1_ps(value[k - 1]);
+                for (; c + F <= count; c += F)
+                {
+                    int mask = _mm256_movemask_ps(_mm256_cmp_ps(LoadTopK(src + c), threshold, _CMP_GT_OQ));
+                    if (mask)
+                    {
+                        for (size_t i = 0; i < F; ++i)
+                        {
+                            float val = Base::Convert16b<T, float>(src[c + i]);
+                            if ((mask & (1 << i)) && val > value[k - 1])
+                                Base::SynetSoftmaxTopKInsert(val, uint32_t(c + i), k, value, index);
+                        }
+                        threshold = _mm256_set1_ps(value[k - 1]);
+                    }
+                }
+                for (; c < count; ++c)
+                {
+                    float val = Base::Convert16b<T, float>(src[c]);
+                    if (val > value[k - 1])
+                        Base::SynetSoftmaxTopKInsert(val, (uint32_t)c, k, value, index);
+                }
+                __m256 max = _mm256_set1_ps(value[0]), sum0 = _mm256_setzero_ps(), sum1 = _mm256_setzero_ps();
+                for (c = 0; c + DF <= count; c += DF)
+                {
+                    sum0 = _mm256_add_ps(sum0, exp.Exponent(_mm256_sub_ps(LoadTopK(src + c + 0), max)));
+                    sum1 = _mm256_add_ps(sum1, exp.Exponent(_mm256_sub_ps(LoadTopK(src + c + F), max)));
+                }
+                for (; c < countF; c += F)
+                    sum0 = _mm256_add_ps(sum0, exp.Exponent(_mm256_sub_ps(LoadTopK(src + c), max)));
+                float sum = ExtractSum(_mm256_add_ps(sum0, sum1));
+                for (; c < count; ++c)
+                    sum += ::exp(Base::Convert16b<T, float>(src[c]) - value[0]);
+                Base::SynetSoftmaxTopKFinalize(sum, k, log, value);
+                src += count;
+                index += k;
+                value += k;
+            }
+        }
+
+        void SynetSoftmaxTopK32f(const float* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value)
+        {
+            SynetSoftmaxTopK(src, outer, count, k, log, index, value);
+        }
+
+        void SynetSoftmaxTopK16b(const uint16_t* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value)
+        {
+            SynetSoftmaxTopK(src, outer, count, k, log, index, value);
+        }
+    }
+#endif
+}
@@ -0,0 +1,161 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetAttention.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx512bw
+    {
+        static void Convert32f(const uint8_t* src8, size_t count, size_t stride, size_t size, float scale, float* dst)
+        {
+            const float* src = (const float*)src8;
+            size_t sizeF = AlignLo(size, F);
+            __mmask16 tail = TailMask16(size - sizeF);
+            __m512 _scale = _mm512_set1_ps(scale);
+            for (size_t i = 0; i < count; ++i, src += stride, dst += size)
+            {
+                size_t j = 0;
+                for (; j < sizeF; j += F)
+                    _mm512_storeu_ps(dst + j, _mm512_mul_ps(_mm512_loadu_ps(src + j), _scale));
+                if (j < size)
+                    _mm512_mask_storeu_ps(dst + j, tail, _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, src + j), _scale));
+            }
+        }
+
+        static void Convert16b(const uint8_t* src8, size_t count, size_t stride, size_t size, float scale, float* dst)
+        {
+            const uint16_t* src = (const uint16_t*)src8;
+            size_t sizeF = AlignLo(size, F);
+            __mmask16 tail = TailMask16(size - sizeF);
+            __m512 _scale = _mm512_set1_ps(scale);
+            for (size_t i = 0; i < count; ++i, src += stride, dst += size)
+            {
+                size_t j = 0;
+                for (; j < sizeF; j += F)
+                    _mm512_storeu_ps(dst + j, _mm512_mul_ps(BFloat16ToFloat32(_mm256_loadu_si256((__m256i*)(src + j))), _scale));
+                if (j < size)
+                    _mm512_mask_storeu_ps(dst + j, tail, _mm512_mul_ps(BFloat16ToFloat32(_mm256_maskz_loadu_epi16(tail, src + j)), _scale));
+            }
+        }
+
+        SIMD_INLINE float Dot(const float* a, const float* b, size_t sizeF, size_t size, __mmask16 tail)
+        {
+            __m512 dot = _mm512_setzero_ps();
+            size_t j = 0;
+            for (; j < sizeF; j += F)
+                dot = _mm512_fmadd_ps(_mm512_loadu_ps(a + j), _mm512_loadu_ps(b + j), dot);
+            if (j < size)
+                dot = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tail, a + j), _mm512_maskz_loadu_ps(tail, b + j), dot);
+            return ExtractSum(dot);
+        }
+
+        SIMD_INLINE void Scale(float* dst, __m512 scale, size_t sizeF, size_t size, __mmask16 tail)
+        {
+            size_t j = 0;
+            for (; j < sizeF; j += F)
+                _mm512_storeu_ps(dst + j, _mm512_mul_ps(_mm512_loadu_ps(dst + j), scale));
+            if (j < size)
+                _mm512_mask_storeu_ps(dst + j, tail, _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, dst + j), scale));
+        }
+
+        static void Attention(const float* q, const float* k, const float* v, size_t stride, size_t keys, size_t size, float* buf, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F);
+            __mmask16 tail = TailMask16(size - sizeF);
+            float max = -FLT_MAX, sum = 0.0f;
+            for (size_t j = 0; j < size; ++j)
+                dst[j] = 0.0f;
+            for (size_t t = 0; t < keys; t += Base::SynetAttention::KEY_TILE)
+            {
+                size_t n = Simd::Min(Base::SynetAttention::KEY_TILE, keys - t), i;
+                __m512 _max = _mm512_set1_ps(-FLT_MAX);
+                for (i = 0; i < n; ++i)
+                    buf[i] = Dot(q, k + (t + i) * stride, sizeF, size, tail);
+                for (i = 0; i < n; i += F)
+                    _max = _mm512_max_ps(_max, _mm512_mask_loadu_ps(_max, TailMask16(n - i), buf + i));
+                float tileMax = _mm512_reduce_max_ps(_max);
+                if (tileMax > max)
+                {
+                    float corr = ::expf(max - tileMax);
+                    sum *= corr;
+                    Scale(dst, _mm512_set1_ps(corr), sizeF, size, tail);
+                    max = tileMax;
+                }
+                __m512 _sum = _mm512_setzero_ps();
+                _max = _mm512_set1_ps(max);
+                for (i = 0; i < n; i += F)
+                {
+                    __mmask16 mask = TailMask16(n - i);
+                    __m512 p = _mm512_maskz_mov_ps(mask, Exponent(_mm512_sub_ps(_mm512_maskz_loadu_ps(mask, buf + i), _max)));
+                    _sum = _mm512_add_ps(_sum, p);
+                    _mm512_mask_storeu_ps(buf + i, mask, p);
+                }
+                sum += ExtractSum(_sum);
+                for (i = 0; i < n; ++i)
+                {
+                    const float* vi = v + (t + i) * stride;
+                    __m512 p = _mm512_set1_ps(buf[i]);
+                    size_t j = 0;
+                    for (; j < sizeF; j += F)
+                        _mm512_storeu_ps(dst + j, _mm512_fmadd_ps(p, _mm512_loadu_ps(vi + j), _mm512_loadu_ps(dst + j)));
+                    if (j < size)
+                        _mm512_mask_storeu_ps(dst + j, tail, _mm512_fmadd_ps(p, _mm512_maskz_loadu_ps(tail, vi + j), _mm512_maskz_loadu_ps(tail, dst + j)));
+                }
+            }
+            Scale(dst, _mm512_set1_ps(1.0f / sum), sizeF, size, tail);
+        }
+
+        static void Store16b(const float* src, size_t size, uint8_t* dst)
+        {
+            Float32ToBFloat16(src, size, (uint16_t*)dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetAttention::SynetAttention(const AttentionParam& p)
+            : Avx2::SynetAttention(p)
+        {
+            _convert = p.srcType == SimdTensorData32f ? Convert32f : Convert16b;
+            _attention = Attention;
+            if (p.dstType == SimdTensorData16b)
+                _store = Store16b;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetAttentionInit(size_t batch, size_t heads, size_t queries, size_t keys, size_t size, SimdTensorDataType srcType, SimdTensorDataType dstType, float scale)
+        {
+            AttentionParam param(batch, heads, queries, keys, size, srcType, dstType, scale);
+            if (!param.Valid())
+                return NULL;
+            return new SynetAttention(param);
+        }
+    }
+#endif
+}
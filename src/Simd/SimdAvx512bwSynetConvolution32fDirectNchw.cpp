@@ -436,6 +436,13 @@ namespace Simd
                 ) && p.trans == 0;
         }
 
+        bool SynetConvolution32fDirectNchw::Applicable(const ConvParam& p)
+        {
+            if (Avx2::SynetConvolution32fDirectNchw::Applicable(p))
+                return true;
+            return p.IsDilation(1) && (p.IsStride(1) || p.IsStride(2)) && (p.IsKernel(4) || p.IsKernel(5)) && p.dstW > F && p.trans == 0;
+        }
+
         template <int kernel, int stride> SynetConvolution32fDirectNchw::ConvolutionBiasActivationPtr SetConvolutionBiasActivation(::SimdConvolutionActivationType type)
         {
             switch (type)
@@ -624,7 +624,7 @@ namespace Simd
                     _nhwcWeight.Resize(_gemmCb.At(0).BufferSize(_M * _merge, _N, _K));
                 }
                 else
-                    _nhwcWeight.Resize(Avx512bw::Gemm32fNNcbBufferSize(_M * _merge, _N, _K, GemmKernelAny, NHWC_GEMM_COMPATIBLE));
+                    _nhwcWeight.Resize(Avx512bw::Gemm32fNNcbBufferSize(_M * _merge, _N, _K, GemmKernelAny, _nhwcCompatible));
                 _nhwcRun = Avx512bw::Gemm32fNNcbRun;
                 _nhwcReorderB = Avx512bw::Gemm32fNNcbReorderB;
             }
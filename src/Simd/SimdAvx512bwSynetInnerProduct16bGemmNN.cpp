@@ -88,9 +88,7 @@ namespace Simd
 
         SIMD_INLINE void ConvertBn(const float* src, size_t stride, uint16_t* dst)
         {
-            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(_mm512_castps_si512(_mm512_loadu_ps(src + 0 * stride)), Bf16::ROUND), Base::Bf16::SHIFT);
-            __m512i d1 = _mm512_and_si512(_mm512_add_epi32(_mm512_castps_si512(_mm512_loadu_ps(src + 1 * stride)), Bf16::ROUND), Bf16::MASK);
-            _mm512_storeu_si512((__m512i*)dst, _mm512_or_si512(d0, d1));
+            _mm512_storeu_si512((__m512i*)dst, Float32ToBFloat16Interlived(_mm512_loadu_ps(src + 0 * stride), _mm512_loadu_ps(src + 1 * stride)));
         }
 
         static void InnerProduct16bGemmNN_ConvertBn(const uint8_t* src8, const InnerProductParam16b& p, const AlgParam& a, size_t N, size_t K, uint16_t* dst)
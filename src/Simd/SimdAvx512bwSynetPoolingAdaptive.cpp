@@ -0,0 +1,403 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx512bw.h"
+#include "Simd/SimdBFloat16.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx512bw
+    {
+        template<class T> SIMD_INLINE __m512 LoadAs32f(const T* src, __mmask16 tail = -1);
+
+        template<> SIMD_INLINE __m512 LoadAs32f<float>(const float* src, __mmask16 tail)
+        {
+            return _mm512_maskz_loadu_ps(tail, src);
+        }
+
+        template<> SIMD_INLINE __m512 LoadAs32f<uint16_t>(const uint16_t* src, __mmask16 tail)
+        {
+            return BFloat16ToFloat32(_mm256_maskz_loadu_epi16(tail, src));
+        }
+
+        template<class T> SIMD_INLINE void SaveAs32f(T* dst, __m512 value, __mmask16 tail = -1);
+
+        template<> SIMD_INLINE void SaveAs32f<float>(float* dst, __m512 value, __mmask16 tail)
+        {
+            _mm512_mask_storeu_ps(dst, tail, value);
+        }
+
+        template<> SIMD_INLINE void SaveAs32f<uint16_t>(uint16_t* dst, __m512 value, __mmask16 tail)
+        {
+            _mm256_mask_storeu_epi16(dst, tail, PackFloat32ToBFloat16(value));
+        }
+
+        SIMD_INLINE void SaveAs32f(float* dst, float value)
+        {
+            *dst = value;
+        }
+
+        SIMD_INLINE void SaveAs32f(uint16_t* dst, float value)
+        {
+            *dst = Base::Float32ToBFloat16(value);
+        }
+
+        template<SimdSynetPoolingMethodType method> SIMD_INLINE __m512 PoolingAdaptive(__m512 acc, __m512 val, __mmask16 tail = -1)
+        {
+            return method == SimdSynetPoolingMethodMax ? _mm512_mask_max_ps(acc, tail, acc, val) : _mm512_mask_add_ps(acc, tail, acc, val);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<class T, SimdSynetPoolingMethodType method, int N> SIMD_INLINE void PoolingAdaptive32fNhwc(const T* src, size_t srcS, size_t srcC,
+            size_t kH, size_t kW, const __m512& init, const __m512& norm, T* dst, __mmask16 tail = -1)
+        {
+            __m512 acc0 = init, acc1 = init, acc2 = init, acc3 = init;
+            for (size_t h = 0; h < kH; ++h)
+            {
+                for (size_t w = 0; w < kW; ++w)
+                {
+                    const T* ps = src + w * srcC;
+                    if (N > 0) acc0 = PoolingAdaptive<method>(acc0, LoadAs32f(ps + 0 * F, tail));
+                    if (N > 1) acc1 = PoolingAdaptive<method>(acc1, LoadAs32f(ps + 1 * F));
+                    if (N > 2) acc2 = PoolingAdaptive<method>(acc2, LoadAs32f(ps + 2 * F));
+                    if (N > 3) acc3 = PoolingAdaptive<method>(acc3, LoadAs32f(ps + 3 * F));
+                }
+                src += srcS;
+            }
+            if (method == SimdSynetPoolingMethodAverage)
+            {
+                if (N > 0) acc0 = _mm512_mul_ps(acc0, norm);
+                if (N > 1) acc1 = _mm512_mul_ps(acc1, norm);
+                if (N > 2) acc2 = _mm512_mul_ps(acc2, norm);
+                if (N > 3) acc3 = _mm512_mul_ps(acc3, norm);
+            }
+            if (N > 0) SaveAs32f(dst + 0 * F, acc0, tail);
+            if (N > 1) SaveAs32f(dst + 1 * F, acc1);
+            if (N > 2) SaveAs32f(dst + 2 * F, acc2);
+            if (N > 3) SaveAs32f(dst + 3 * F, acc3);
+        }
+
+        template<class T, SimdSynetPoolingMethodType method> void PoolingAdaptive32fNhwc(const T* src, size_t srcC, size_t srcH, size_t srcW, T* dst, size_t dstH, size_t dstW)
+        {
+            size_t srcCF = AlignLo(srcC, F), srcC4F = AlignLo(srcC, 4 * F), srcS = srcW * srcC;
+            __mmask16 tail = TailMask16(srcC - srcCF);
+            __m512 init = _mm512_set1_ps(method == SimdSynetPoolingMethodMax ? -FLT_MAX : 0.0f);
+            for (size_t dy = 0; dy < dstH; ++dy)
+            {
+                size_t yBeg = Base::AdaptivePoolingBeg(dy, srcH, dstH), yEnd = Base::AdaptivePoolingEnd(dy, srcH, dstH);
+                for (size_t dx = 0; dx < dstW; ++dx)
+                {
+                    size_t xBeg = Base::AdaptivePoolingBeg(dx, srcW, dstW), xEnd = Base::AdaptivePoolingEnd(dx, srcW, dstW);
+                    size_t kH = yEnd - yBeg, kW = xEnd - xBeg, c = 0;
+                    const T* ps = src + (yBeg * srcW + xBeg) * srcC;
+                    __m512 norm = _mm512_set1_ps(1.0f / float(kH * kW));
+                    for (; c < srcC4F; c += 4 * F)
+                        PoolingAdaptive32fNhwc<T, method, 4>(ps + c, srcS, srcC, kH, kW, init, norm, dst + c);
+                    for (; c < srcCF; c += F)
+                        PoolingAdaptive32fNhwc<T, method, 1>(ps + c, srcS, srcC, kH, kW, init, norm, dst + c);
+                    if (c < srcC)
+                        PoolingAdaptive32fNhwc<T, method, 1>(ps + c, srcS, srcC, kH, kW, init, norm, dst + c, tail);
+                    dst += srcC;
+                }
+            }
+        }
+
+        template<SimdSynetPoolingMethodType method> SIMD_INLINE void PoolingAdaptive32fNchw(const float* src, size_t size, __m512 & acc)
+        {
+            size_t i = 0, sizeF = AlignLo(size, F), size4F = AlignLo(size, 4 * F);
+            if (size4F)
+            {
+                __m512 acc1 = acc, acc2 = acc, acc3 = acc;
+                for (; i < size4F; i += 4 * F)
+                {
+                    acc = PoolingAdaptive<method>(acc, _mm512_loadu_ps(src + i + 0 * F));
+                    acc1 = PoolingAdaptive<method>(acc1, _mm512_loadu_ps(src + i + 1 * F));
+                    acc2 = PoolingAdaptive<method>(acc2, _mm512_loadu_ps(src + i + 2 * F));
+                    acc3 = PoolingAdaptive<method>(acc3, _mm512_loadu_ps(src + i + 3 * F));
+                }
+                acc = PoolingAdaptive<method>(PoolingAdaptive<method>(acc, acc1), PoolingAdaptive<method>(acc2, acc3));
+            }
+            for (; i < sizeF; i += F)
+                acc = PoolingAdaptive<method>(acc, _mm512_loadu_ps(src + i));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                acc = PoolingAdaptive<method>(acc, _mm512_maskz_loadu_ps(tail, src + i), tail);
+            }
+        }
+
+        template<SimdSynetPoolingMethodType method> SIMD_INLINE void PoolingAdaptive32fNchw(const uint16_t* src, size_t size, __m512& acc)
+        {
+            size_t i = 0, sizeF = AlignLo(size, F), size2F = AlignLo(size, 2 * F);
+            if (size2F)
+            {
+                __m512 acc1 = acc;
+                for (; i < size2F; i += 2 * F)
+                {
+                    __m512i src01 = _mm512_loadu_si512((__m512i*)(src + i));
+                    acc = PoolingAdaptive<method>(acc, BFloat16ToFloat32Even(src01));
+                    acc1 = PoolingAdaptive<method>(acc1, BFloat16ToFloat32Odd(src01));
+                }
+                acc = PoolingAdaptive<method>(acc, acc1);
+            }
+            for (; i < sizeF; i += F)
+                acc = PoolingAdaptive<method>(acc, LoadAs32f(src + i));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                acc = PoolingAdaptive<method>(acc, LoadAs32f(src + i, tail), tail);
+            }
+        }
+
+        template<class T, SimdSynetPoolingMethodType method> void PoolingAdaptive32fNchw(const T* src, size_t srcC, size_t srcH, size_t srcW, T* dst, size_t dstH, size_t dstW)
+        {
+            __m512 init = _mm512_set1_ps(method == SimdSynetPoolingMethodMax ? -FLT_MAX : 0.0f);
+            for (size_t c = 0; c < srcC; ++c)
+            {
+                for (size_t dy = 0; dy < dstH; ++dy)
+                {
+                    size_t yBeg = Base::AdaptivePoolingBeg(dy, srcH, dstH), yEnd = Base::AdaptivePoolingEnd(dy, srcH, dstH);
+                    for (size_t dx = 0; dx < dstW; ++dx)
+                    {
+                        size_t xBeg = Base::AdaptivePoolingBeg(dx, srcW, dstW), xEnd = Base::AdaptivePoolingEnd(dx, srcW, dstW);
+                        __m512 acc = init;
+                        if (xBeg == 0 && xEnd == srcW)
+                            PoolingAdaptive32fNchw<method>(src + yBeg * srcW, (yEnd - yBeg) * srcW, acc);
+                        else
+                        {
+                            for (size_t sy = yBeg; sy < yEnd; ++sy)
+                                PoolingAdaptive32fNchw<method>(src + sy * srcW + xBeg, xEnd - xBeg, acc);
+                        }
+                        if (method == SimdSynetPoolingMethodMax)
+                            SaveAs32f(dst, _mm512_reduce_max_ps(acc));
+                        else
+                            SaveAs32f(dst, ExtractSum(acc) / float((yEnd - yBeg) * (xEnd - xBeg)));
+                        dst += 1;
+                    }
+                }
+                src += srcH * srcW;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> SIMD_INLINE void PoolingAdaptiveMax8uNhwc(const uint8_t* src, size_t srcS, size_t srcC, size_t kH, size_t kW, uint8_t* dst, __mmask64 tail = -1)
+        {
+            __m512i max0 = _mm512_setzero_si512(), max1 = _mm512_setzero_si512();
+            for (size_t h = 0; h < kH; ++h)
+            {
+                for (size_t w = 0; w < kW; ++w)
+                {
+                    const uint8_t* ps = src + w * srcC;
+                    if (N > 0) max0 = _mm512_max_epu8(max0, _mm512_maskz_loadu_epi8(tail, ps + 0 * A));
+                    if (N > 1) max1 = _mm512_max_epu8(max1, _mm512_loadu_si512((__m512i*)(ps + 1 * A)));
+                }
+                src += srcS;
+            }
+            if (N > 0) _mm512_mask_storeu_epi8(dst + 0 * A, tail, max0);
+            if (N > 1) _mm512_storeu_si512((__m512i*)(dst + 1 * A), max1);
+        }
+
+        SIMD_INLINE void PoolingAdaptiveAverage8uNhwc(const uint8_t* src, size_t srcS, size_t srcC, size_t kH, size_t kW, uint32_t size, uint8_t* dst, size_t count = A, __mmask64 tail = -1)
+        {
+            __m512i sum0 = _mm512_setzero_si512(), sum1 = _mm512_setzero_si512(), sum2 = _mm512_setzero_si512(), sum3 = _mm512_setzero_si512();
+            for (size_t h = 0; h < kH; ++h)
+            {
+                for (size_t w = 0; w < kW; ++w)
+                {
+                    __m512i _src = _mm512_maskz_loadu_epi8(tail, src + w * srcC);
+                    sum0 = _mm512_add_epi32(sum0, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(_src, 0)));
+                    sum1 = _mm512_add_epi32(sum1, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(_src, 1)));
+                    sum2 = _mm512_add_epi32(sum2, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(_src, 2)));
+                    sum3 = _mm512_add_epi32(sum3, _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(_src, 3)));
+                }
+                src += srcS;
+            }
+            SIMD_ALIGNED(64) uint32_t sum[A];
+            _mm512_store_si512((__m512i*)sum + 0, sum0);
+            _mm512_store_si512((__m512i*)sum + 1, sum1);
+            _mm512_store_si512((__m512i*)sum + 2, sum2);
+            _mm512_store_si512((__m512i*)sum + 3, sum3);
+            uint32_t half = size / 2;
+            for (size_t i = 0; i < count; ++i)
+                dst[i] = (uint8_t)((sum[i] + half) / size);
+        }
+
+        template<SimdSynetPoolingMethodType method> void PoolingAdaptive8uNhwc(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, uint8_t* dst, size_t dstH, size_t dstW)
+        {
+            size_t srcCA = AlignLo(srcC, A), srcC2A = AlignLo(srcC, 2 * A), srcS = srcW * srcC;
+            __mmask64 tail = TailMask64(srcC - srcCA);
+            for (size_t dy = 0; dy < dstH; ++dy)
+            {
+                size_t yBeg = Base::AdaptivePoolingBeg(dy, srcH, dstH), yEnd = Base::AdaptivePoolingEnd(dy, srcH, dstH);
+                for (size_t dx = 0; dx < dstW; ++dx)
+                {
+                    size_t xBeg = Base::AdaptivePoolingBeg(dx, srcW, dstW), xEnd = Base::AdaptivePoolingEnd(dx, srcW, dstW);
+                    size_t kH = yEnd - yBeg, kW = xEnd - xBeg, c = 0;
+                    const uint8_t* ps = src + (yBeg * srcW + xBeg) * srcC;
+                    if (method == SimdSynetPoolingMethodMax)
+                    {
+                        for (; c < srcC2A; c += 2 * A)
+                            PoolingAdaptiveMax8uNhwc<2>(ps + c, srcS, srcC, kH, kW, dst + c);
+                        for (; c < srcCA; c += A)
+                            PoolingAdaptiveMax8uNhwc<1>(ps + c, srcS, srcC, kH, kW, dst + c);
+                        if (c < srcC)
+                            PoolingAdaptiveMax8uNhwc<1>(ps + c, srcS, srcC, kH, kW, dst + c, tail);
+                    }
+                    else
+                    {
+                        for (; c < srcCA; c += A)
+                            PoolingAdaptiveAverage8uNhwc(ps + c, srcS, srcC, kH, kW, uint32_t(kH * kW), dst + c);
+                        if (c < srcC)
+                            PoolingAdaptiveAverage8uNhwc(ps + c, srcS, srcC, kH, kW, uint32_t(kH * kW), dst + c, srcC - c, tail);
+                    }
+                    dst += srcC;
+                }
+            }
+        }
+
+        SIMD_INLINE void PoolingAdaptiveMax8uNchw(const uint8_t* src, size_t size, __m512i& max)
+        {
+            size_t i = 0, sizeA = AlignLo(size, A);
+            for (; i < sizeA; i += A)
+                max = _mm512_max_epu8(max, _mm512_loadu_si512((__m512i*)(src + i)));
+            if (i < size)
+                max = _mm512_max_epu8(max, _mm512_maskz_loadu_epi8(TailMask64(size - i), src + i));
+        }
+
+        SIMD_INLINE void PoolingAdaptiveSum8uNchw(const uint8_t* src, size_t size, __m512i& sum)
+        {
+            size_t i = 0, sizeA = AlignLo(size, A);
+            for (; i < sizeA; i += A)
+                sum = _mm512_add_epi64(sum, _mm512_sad_epu8(_mm512_loadu_si512((__m512i*)(src + i)), K_ZERO));
+            if (i < size)
+                sum = _mm512_add_epi64(sum, _mm512_sad_epu8(_mm512_maskz_loadu_epi8(TailMask64(size - i), src + i), K_ZERO));
+        }
+
+        SIMD_INLINE uint8_t ExtractMax8u(__m512i a)
+        {
+            a = _mm512_max_epu8(a, _mm512_shuffle_i64x2(a, a, 0x4E));
+            a = _mm512_max_epu8(a, _mm512_shuffle_i64x2(a, a, 0xB1));
+            __m128i b = _mm512_castsi512_si128(a);
+            b = _mm_max_epu8(b, _mm_srli_si128(b, 8));
+            b = _mm_max_epu8(b, _mm_srli_si128(b, 4));
+            b = _mm_max_epu8(b, _mm_srli_si128(b, 2));
+            b = _mm_max_epu8(b, _mm_srli_si128(b, 1));
+            return (uint8_t)_mm_cvtsi128_si32(b);
+        }
+
+        template<SimdSynetPoolingMethodType method> void PoolingAdaptive8uNchw(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, uint8_t* dst, size_t dstH, size_t dstW)
+        {
+            for (size_t c = 0; c < srcC; ++c)
+            {
+                for (size_t dy = 0; dy < dstH; ++dy)
+                {
+                    size_t yBeg = Base::AdaptivePoolingBeg(dy, srcH, dstH), yEnd = Base::AdaptivePoolingEnd(dy, srcH, dstH);
+                    for (size_t dx = 0; dx < dstW; ++dx)
+                    {
+                        size_t xBeg = Base::AdaptivePoolingBeg(dx, srcW, dstW), xEnd = Base::AdaptivePoolingEnd(dx, srcW, dstW);
+                        __m512i acc = _mm512_setzero_si512();
+                        bool full = xBeg == 0 && xEnd == srcW;
+                        for (size_t sy = yBeg; sy < (full ? yBeg + 1 : yEnd); ++sy)
+                        {
+                            const uint8_t* ps = src + sy * srcW + xBeg;
+                            size_t size = full ? (yEnd - yBeg) * srcW : xEnd - xBeg;
+                            if (method == SimdSynetPoolingMethodMax)
+                                PoolingAdaptiveMax8uNchw(ps, size, acc);
+                            else
+                                PoolingAdaptiveSum8uNchw(ps, size, acc);
+                        }
+                        if (method == SimdSynetPoolingMethodMax)
+                            dst[0] = ExtractMax8u(acc);
+                        else
+                        {
+                            uint64_t size = (yEnd - yBeg) * (xEnd - xBeg);
+                            dst[0] = (uint8_t)((ExtractSum<uint64_t>(acc) + size / 2) / size);
+                        }
+                        dst += 1;
+                    }
+                }
+                src += srcH * srcW;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<class T, SimdSynetPoolingMethodType method> void SynetPoolingAdaptive32f(const T* src, size_t srcC, size_t srcH, size_t srcW,
+            T* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+        {
+            if (Base::NhwcCompatible(srcC, srcH * srcW, format))
+                PoolingAdaptive32fNhwc<T, method>(src, srcC, srcH, srcW, dst, dstH, dstW);
+            else
+                PoolingAdaptive32fNchw<T, method>(src, srcC, srcH, srcW, dst, dstH, dstW);
+        }
+
+        template<SimdSynetPoolingMethodType method> void SynetPoolingAdaptive8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW,
+            uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+        {
+            if (Base::NhwcCompatible(srcC, srcH * srcW, format))
+                PoolingAdaptive8uNhwc<method>(src, srcC, srcH, srcW, dst, dstH, dstW);
+            else
+                PoolingAdaptive8uNchw<method>(src, srcC, srcH, srcW, dst, dstH, dstW);
+        }
+
+        void SynetPoolingAdaptive(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, SimdTensorDataType type,
+            SimdSynetPoolingMethodType method, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+        {
+            bool max = method == SimdSynetPoolingMethodMax;
+            if (!max && method != SimdSynetPoolingMethodAverage)
+                assert(0);
+            else if (type == SimdTensorData32f)
+            {
+                if (max)
+                    SynetPoolingAdaptive32f<float, SimdSynetPoolingMethodMax>((float*)src, srcC, srcH, srcW, (float*)dst, dstH, dstW, format);
+                else
+                    SynetPoolingAdaptive32f<float, SimdSynetPoolingMethodAverage>((float*)src, srcC, srcH, srcW, (float*)dst, dstH, dstW, format);
+            }
+            else if (type == SimdTensorData16b)
+            {
+                if (max)
+                    SynetPoolingAdaptive32f<uint16_t, SimdSynetPoolingMethodMax>((uint16_t*)src, srcC, srcH, srcW, (uint16_t*)dst, dstH, dstW, format);
+                else
+                    SynetPoolingAdaptive32f<uint16_t, SimdSynetPoolingMethodAverage>((uint16_t*)src, srcC, srcH, srcW, (uint16_t*)dst, dstH, dstW, format);
+            }
+            else if (type == SimdTensorData8u)
+            {
+                if (max)
+                    SynetPoolingAdaptive8u<SimdSynetPoolingMethodMax>(src, srcC, srcH, srcW, dst, dstH, dstW, format);
+                else
+                    SynetPoolingAdaptive8u<SimdSynetPoolingMethodAverage>(src, srcC, srcH, srcW, dst, dstH, dstW, format);
+            }
+            else
+                assert(0);
+        }
+    }
+#endif
+}
@@ -0,0 +1,124 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdArray.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx512bw
+    {
+        template<class T> SIMD_INLINE __m512 LoadMasked(const T* src, __mmask16 mask);
+
+        template<> SIMD_INLINE __m512 LoadMasked(const float* src, __mmask16 mask)
+        {
+            return _mm512_maskz_loadu_ps(mask, src);
+        }
+
+        template<> SIMD_INLINE __m512 LoadMasked(const uint16_t* src, __mmask16 mask)
+        {
+            return BFloat16ToFloat32(_mm256_maskz_loadu_epi16(mask, src));
+        }
+
+        template<class T> SIMD_INLINE void StoreMasked(T* dst, __m512 value, __mmask16 mask);
+
+        template<> SIMD_INLINE void StoreMasked(float* dst, __m512 value, __mmask16 mask)
+        {
+            _mm512_mask_storeu_ps(dst, mask, value);
+        }
+
+        template<> SIMD_INLINE void StoreMasked(uint16_t* dst, __m512 value, __mmask16 mask)
+        {
+            _mm256_mask_storeu_epi16(dst, mask, PackFloat32ToBFloat16(value));
+        }
+
+        template<class T> void SynetSoftmaxMasked(const T* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, T* dst)
+        {
+            Exp exp;
+            Array32f _buf(count);
+            float* buf = _buf.data;
+            size_t countF = AlignLo(count, F), c;
+            __mmask16 tail = TailMask16(count - countF);
+            for (size_t o = 0; o < outer; ++o)
+            {
+                const float* m = mask ? mask + (o % maskOuter) * count : NULL;
+                __m512 _max = _mm512_set1_ps(-FLT_MAX);
+                for (c = 0; c < count; c += F)
+                {
+                    __mmask16 load = c < countF ? __mmask16(-1) : tail;
+                    __m512 value = LoadMasked(src + c, load);
+                    if (m)
+                        value = _mm512_add_ps(value, _mm512_maskz_loadu_ps(load, m + c));
+                    _mm512_mask_storeu_ps(buf + c, load, value);
+                    _max = _mm512_mask_max_ps(_max, load, _max, value);
+                }
+                _max = _mm512_set1_ps(_mm512_reduce_max_ps(_max));
+                __m512 _sum = _mm512_setzero_ps();
+                for (c = 0; c < count; c += F)
+                {
+                    __mmask16 load = c < countF ? __mmask16(-1) : tail;
+                    __m512 value = exp.Exponent(_mm512_sub_ps(_mm512_maskz_loadu_ps(load, buf + c), _max));
+                    if (!log)
+                        _mm512_mask_storeu_ps(buf + c, load, value);
+                    _sum = _mm512_mask_add_ps(_sum, load, _sum, value);
+                }
+                float sum = ExtractSum(_sum);
+                if (log)
+                {
+                    __m512 _shift = _mm512_set1_ps(::log(sum));
+                    for (c = 0; c < count; c += F)
+                    {
+                        __mmask16 store = c < countF ? __mmask16(-1) : tail;
+                        StoreMasked(dst + c, _mm512_sub_ps(_mm512_sub_ps(_mm512_maskz_loadu_ps(store, buf + c), _max), _shift), store);
+                    }
+                }
+                else
+                {
+                    __m512 _k = _mm512_set1_ps(1.0f / sum);
+                    for (c = 0; c < count; c += F)
+                    {
+                        __mmask16 store = c < countF ? __mmask16(-1) : tail;
+                        StoreMasked(dst + c, _mm512_mul_ps(_mm512_maskz_loadu_ps(store, buf + c), _k), store);
+                    }
+                }
+                src += count;
+                dst += count;
+            }
+        }
+
+        void SynetSoftmaxMasked32f(const float* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, float* dst)
+        {
+            SynetSoftmaxMasked(src, outer, count, mask, maskOuter, log, dst);
+        }
+
+        void SynetSoftmaxMasked16b(const uint16_t* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, uint16_t* dst)
+        {
+            SynetSoftmaxMasked(src, outer, count, mask, maskOuter, log, dst);
+        }
+    }
+#endif
+}
@@ -0,0 +1,103 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetAdd16bCommon.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx512bw
+    {
+        template<class T> SIMD_INLINE __m512 LoadTopK(const T* src, __mmask16 mask = -1);
+
+        template<> SIMD_INLINE __m512 LoadTopK(const float* src, __mmask16 mask)
+        {
+            return _mm512_maskz_loadu_ps(mask, src);
+        }
+
+        template<> SIMD_INLINE __m512 LoadTopK(const uint16_t* src, __mmask16 mask)
+        {
+            return BFloat16ToFloat32(_mm256_maskz_loadu_epi16(mask, src));
+        }
+
+        template<class T> void SynetSoftmaxTopK(const T* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value)
+        {
+            Exp exp;
+            size_t countF = AlignLo(count, F), countDF = AlignLo(count, DF);
+            __mmask16 tail = TailMask16(count - countF);
+            for (size_t o = 0; o < outer; ++o)
+            {
+                size_t c = 0;
+                for (; c < k; ++c)
+                    Base::SynetSoftmaxTopKInsert(Base::Convert16b<T, float>(src[c]), (uint32_t)c, c + 1, value, index);
+                __m512 threshold = _mm512_set1_ps(value[k - 1]);
+                for (; c < count; c += F)
+                {
+                    __mmask16 load = c + F <= count ? __mmask16(-1) : TailMask16(count - c);
+                    __mmask16 mask = _mm512_mask_cmp_ps_mask(load, LoadTopK(src + c, load), threshold, _CMP_GT_OQ);
+                    if (mask)
+                    {
+                        for (size_t i = 0; i < F; ++i)
+                        {
+                            if ((mask & (1 << i)) == 0)
+                                continue;
+                            float val = Base::Convert16b<T, float>(src[c + i]);
+                            if (val > value[k - 1])
+                                Base::SynetSoftmaxTopKInsert(val, uint32_t(c + i), k, value, index);
+                        }
+                        threshold = _mm512_set1_ps(value[k - 1]);
+                    }
+                }
+                __m512 max = _mm512_set1_ps(value[0]), sum0 = _mm512_setzero_ps(), sum1 = _mm512_setzero_ps();
+                for (c = 0; c < countDF; c += DF)
+                {
+                    sum0 = _mm512_add_ps(sum0, exp.Exponent(_mm512_sub_ps(LoadTopK(src + c + 0), max)));
+                    sum1 = _mm512_add_ps(sum1, exp.Exponent(_mm512_sub_ps(LoadTopK(src + c + F), max)));
+                }
+                for (; c < countF; c += F)
+                    sum0 = _mm512_add_ps(sum0, exp.Exponent(_mm512_sub_ps(LoadTopK(src + c), max)));
+                if (tail)
+                    sum1 = _mm512_mask_add_ps(sum1, tail, sum1, exp.Exponent(_mm512_sub_ps(LoadTopK(src + c, tail), max)));
+                Base::SynetSoftmaxTopKFinalize(ExtractSum(_mm512_add_ps(sum0, sum1)), k, log, value);
+                src += count;
+                index += k;
+                value += k;
+            }
+        }
+
+        void SynetSoftmaxTopK32f(const float* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value)
+        {
+            SynetSoftmaxTopK(src, outer, count, k, log, index, value);
+        }
+
+        void SynetSoftmaxTopK16b(const uint16_t* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value)
+        {
+            SynetSoftmaxTopK(src, outer, count, k, log, index, value);
+        }
+    }
+#endif
+}
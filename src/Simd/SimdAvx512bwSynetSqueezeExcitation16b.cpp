@@ -0,0 +1,130 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetSqueezeExcitation16b.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx512bw
+    {
+        static void ChannelSum32f(const uint8_t* src8, size_t channels, size_t spatial, float* sum)
+        {
+            const float* src = (const float*)src8;
+            size_t channelsF = AlignLo(channels, F), spatial4 = AlignLo(spatial, 4), c, s;
+            __mmask16 tail = TailMask16(channels - channelsF);
+            for (c = 0; c < channelsF; c += F)
+                _mm512_storeu_ps(sum + c, _mm512_setzero_ps());
+            if (tail)
+                _mm512_mask_storeu_ps(sum + c, tail, _mm512_setzero_ps());
+            for (s = 0; s < spatial4; s += 4, src += 4 * channels)
+            {
+                const float* src0 = src + 0 * channels;
+                const float* src1 = src + 1 * channels;
+                const float* src2 = src + 2 * channels;
+                const float* src3 = src + 3 * channels;
+                for (c = 0; c < channelsF; c += F)
+                {
+                    __m512 sum01 = _mm512_add_ps(_mm512_loadu_ps(src0 + c), _mm512_loadu_ps(src1 + c));
+                    __m512 sum23 = _mm512_add_ps(_mm512_loadu_ps(src2 + c), _mm512_loadu_ps(src3 + c));
+                    _mm512_storeu_ps(sum + c, _mm512_add_ps(_mm512_loadu_ps(sum + c), _mm512_add_ps(sum01, sum23)));
+                }
+                if (tail)
+                {
+                    __m512 sum01 = _mm512_add_ps(_mm512_maskz_loadu_ps(tail, src0 + c), _mm512_maskz_loadu_ps(tail, src1 + c));
+                    __m512 sum23 = _mm512_add_ps(_mm512_maskz_loadu_ps(tail, src2 + c), _mm512_maskz_loadu_ps(tail, src3 + c));
+                    _mm512_mask_storeu_ps(sum + c, tail, _mm512_add_ps(_mm512_maskz_loadu_ps(tail, sum + c), _mm512_add_ps(sum01, sum23)));
+                }
+            }
+            for (; s < spatial; s += 1, src += channels)
+            {
+                for (c = 0; c < channelsF; c += F)
+                    _mm512_storeu_ps(sum + c, _mm512_add_ps(_mm512_loadu_ps(sum + c), _mm512_loadu_ps(src + c)));
+                if (tail)
+                    _mm512_mask_storeu_ps(sum + c, tail, _mm512_add_ps(_mm512_maskz_loadu_ps(tail, sum + c), _mm512_maskz_loadu_ps(tail, src + c)));
+            }
+        }
+
+        static void ChannelSum16b(const uint8_t* src, size_t channels, size_t spatial, float* sum)
+        {
+            SynetChannelSum16b((const uint16_t*)src, channels, spatial, SimdTensorFormatNhwc, sum);
+        }
+
+        static void Excitation(const float* sum, const SqueezeExcitation16bParam& p, const float* weight0, const float* bias0,
+            const float* params, const float* weight1, const float* bias1, float* hidden, float* scale)
+        {
+            size_t channels = p.channels, squeeze = p.squeeze, channelsF = AlignLo(channels, F), channelsDF = AlignLo(channels, DF), c;
+            __mmask16 tail = TailMask16(channels - channelsF);
+            float norm = 1.0f / float(p.spatial);
+            for (size_t j = 0; j < squeeze; ++j, weight0 += channels)
+            {
+                __m512 dot0 = _mm512_setzero_ps(), dot1 = _mm512_setzero_ps();
+                for (c = 0; c < channelsDF; c += DF)
+                {
+                    dot0 = _mm512_fmadd_ps(_mm512_loadu_ps(sum + c + 0), _mm512_loadu_ps(weight0 + c + 0), dot0);
+                    dot1 = _mm512_fmadd_ps(_mm512_loadu_ps(sum + c + F), _mm512_loadu_ps(weight0 + c + F), dot1);
+                }
+                for (; c < channelsF; c += F)
+                    dot0 = _mm512_fmadd_ps(_mm512_loadu_ps(sum + c), _mm512_loadu_ps(weight0 + c), dot0);
+                if (tail)
+                    dot1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tail, sum + c), _mm512_maskz_loadu_ps(tail, weight0 + c), dot1);
+                hidden[j] = ExtractSum(_mm512_add_ps(dot0, dot1)) * norm;
+            }
+            ConvolutionBiasAndActivation(bias0, squeeze, 1, p.activation, params, SimdTrue, hidden);
+            Exp exp(-1.0f);
+            for (c = 0; c < channels; c += F)
+            {
+                __mmask16 mask = c < channelsF ? __mmask16(-1) : tail;
+                __m512 _scale = _mm512_maskz_loadu_ps(mask, bias1 + c);
+                const float* w = weight1 + c;
+                for (size_t j = 0; j < squeeze; ++j, w += channels)
+                    _scale = _mm512_fmadd_ps(_mm512_set1_ps(hidden[j]), _mm512_maskz_loadu_ps(mask, w), _scale);
+                _mm512_mask_storeu_ps(scale + c, mask, exp.Sigmoid(_scale));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetSqueezeExcitation16b::SynetSqueezeExcitation16b(const SqueezeExcitation16bParam& p)
+            : Base::SynetSqueezeExcitation16b(p, SynetScale16bInit(p.channels, p.spatial, p.sType, p.dType, SimdTensorFormatNhwc, SimdTrue, SimdFalse))
+        {
+            _channelSum = p.sType == SimdTensorData32f ? ChannelSum32f : ChannelSum16b;
+            _excitation = Excitation;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetSqueezeExcitation16bInit(size_t batch, size_t channels, size_t spatial, size_t squeeze, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdConvolutionActivationType activation)
+        {
+            SqueezeExcitation16bParam param(batch, channels, spatial, squeeze, srcType, dstType, activation);
+            if (!param.Valid())
+                return NULL;
+            return new SynetSqueezeExcitation16b(param);
+        }
+    }
+#endif
+}
@@ -595,8 +595,8 @@ namespace Simd
             {
                 __mmask16 tail = TailMask16(srcC - srcCF);
                 __m512 tmp[25];
-                WinogradKernel2x2Block4x4SetInput16t(src + srcC - F, srcS, srcC, rowB, rowE, colB, colE, tmp, tail);
-                WinogradKernel2x2Block4x4SetInputStore(tmp, dst + srcC - F, dstStride, tail);
+                WinogradKernel2x2Block4x4SetInput16t(src + srcCF, srcS, srcC, rowB, rowE, colB, colE, tmp, tail);
+                WinogradKernel2x2Block4x4SetInputStore(tmp, dst + srcCF, dstStride, tail);
             }
         }
 
@@ -599,6 +599,21 @@ namespace Simd
         void SynetNormalizeLayerForward16bV2(const uint16_t* src, size_t batch, size_t channels, size_t spatial,
             const float* scale, const float* shift, const float* eps, SimdTensorFormatType format, float* buf, uint16_t* dst);
 
+        void SynetLayerNorm32f(const float* src, const float* add, size_t count, size_t size,
+            const float* scale, const float* shift, const float* eps, float* sum, float* dst);
+
+        void SynetRmsNorm32f(const float* src, const float* add, size_t count, size_t size,
+            const float* scale, const float* eps, float* sum, float* dst);
+
+        void SynetLayerNorm16b(const uint16_t* src, const uint16_t* add, size_t count, size_t size,
+            const float* scale, const float* shift, const float* eps, float* buf, uint16_t* sum, uint16_t* dst);
+
+        void SynetRmsNorm16b(const uint16_t* src, const uint16_t* add, size_t count, size_t size,
+            const float* scale, const float* eps, float* buf, uint16_t* sum, uint16_t* dst);
+
+        void SynetPoolingAdaptive(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, SimdTensorDataType type,
+            SimdSynetPoolingMethodType method, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
+
         void SynetPoolingAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
             size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
 
@@ -644,6 +659,14 @@ namespace Simd
 
         void SynetSoftmax16b(const uint16_t* src, size_t outer, size_t count, size_t inner, uint16_t* dst);
 
+        void SynetSoftmaxMasked32f(const float* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, float* dst);
+
+        void SynetSoftmaxMasked16b(const uint16_t* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, uint16_t* dst);
+
+        void SynetSoftmaxTopK32f(const float* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value);
+
+        void SynetSoftmaxTopK16b(const uint16_t* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value);
+
         void SynetSoftplus32f(const float* src, size_t size, const float* beta, const float* threshold, float* dst);
 
         void SynetSwish32f(const float* src, size_t size, const float* slope, float* dst);
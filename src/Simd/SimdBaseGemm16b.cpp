@@ -0,0 +1,124 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdGemm16b.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    SIMD_INLINE SimdTensorDataType Gemm16bInnerType(SimdTensorDataType type)
+    {
+        return type == SimdTensorData16f ? SimdTensorData32f : type;
+    }
+
+    Gemm16b::Gemm16b(const Gemm16bParam& p, SynetInnerProduct16b* gemm, Float16ToFloat32Ptr toF32, Float32ToFloat16Ptr toF16)
+        : _param(p)
+        , _gemm(gemm)
+        , _toF32(toF32)
+        , _toF16(toF16)
+    {
+        _sizeA = p.typeA == SimdTensorData16f ? p.M * p.K : 0;
+        _sizeB = p.typeB == SimdTensorData16f && !p.constB ? p.K * p.N : 0;
+        _sizeC = p.typeC == SimdTensorData16f ? p.M * p.N : 0;
+        if (!p.constB)
+            _gemm->SetParams(NULL, NULL, NULL);
+    }
+
+    Gemm16b::~Gemm16b()
+    {
+        delete _gemm;
+    }
+
+    size_t Gemm16b::ExternalBufferSize() const
+    {
+        size_t size = _gemm->ExternalBufferSize() + SIMD_ALIGN;
+        if (_sizeA)
+            size += _sizeA * sizeof(float) + SIMD_ALIGN;
+        if (_sizeB)
+            size += _sizeB * sizeof(float) + SIMD_ALIGN;
+        if (_sizeC)
+            size += _sizeC * sizeof(float) + SIMD_ALIGN;
+        return size;
+    }
+
+    void Gemm16b::SetB(const uint8_t* B)
+    {
+        const Gemm16bParam& p = _param;
+        assert(p.constB && B);
+        if (p.typeB == SimdTensorData32f)
+            _gemm->SetParams((float*)B, NULL, NULL);
+        else
+        {
+            Array32f b32f(p.K * p.N);
+            if (p.typeB == SimdTensorData16b)
+                Base::BFloat16ToFloat32((uint16_t*)B, b32f.size, b32f.data);
+            else
+                _toF32((uint16_t*)B, b32f.size, b32f.data);
+            _gemm->SetParams(b32f.data, NULL, NULL);
+        }
+    }
+
+    void Gemm16b::Run(const uint8_t* A, const uint8_t* B, uint8_t* buf, uint8_t* C)
+    {
+        if (buf == NULL)
+        {
+            _buffer.Resize(ExternalBufferSize());
+            buf = _buffer.data;
+        }
+        if (_sizeA)
+        {
+            float* bufA = Allocate<float>(buf, _sizeA);
+            _toF32((uint16_t*)A, _sizeA, bufA);
+            A = (uint8_t*)bufA;
+        }
+        if (_sizeB)
+        {
+            float* bufB = Allocate<float>(buf, _sizeB);
+            _toF32((uint16_t*)B, _sizeB, bufB);
+            B = (uint8_t*)bufB;
+        }
+        float* bufC = _sizeC ? Allocate<float>(buf, _sizeC) : NULL;
+        buf = (uint8_t*)AlignHi(buf, SIMD_ALIGN);
+        _gemm->Forward(A, B, buf, bufC ? (uint8_t*)bufC : C);
+        if (_sizeC)
+            _toF16(bufC, _sizeC, (uint16_t*)C);
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        void* Gemm16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB,
+            SynetInnerProduct16bInitPtr init, Float16ToFloat32Ptr toF32, Float32ToFloat16Ptr toF16)
+        {
+            Gemm16bParam param(M, N, K, typeA, typeB, typeC, transB, constB);
+            if (!param.Valid())
+                return NULL;
+            SynetInnerProduct16b* gemm = (SynetInnerProduct16b*)init(M, N, K, Gemm16bInnerType(typeA), Gemm16bInnerType(typeB), 
+                Gemm16bInnerType(typeC), transB, constB, SimdFalse, SimdConvolutionActivationIdentity);
+            if (gemm == NULL)
+                return NULL;
+            return new Gemm16b(param, gemm, toF32, toF16);
+        }
+    }
+}
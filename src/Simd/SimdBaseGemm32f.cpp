@@ -22,6 +22,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdDefs.h"
+#include "Simd/SimdGemm.h"
 
 namespace Simd
 {
@@ -64,5 +65,79 @@ namespace Simd
                 }
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE size_t Gemm32fBatchedThreadNumber(size_t batch, size_t M, size_t N, size_t K)
+        {
+            size_t size = M * N * K;
+            if (batch < 2 || size >= GEMM_BATCHED_ITEM_SIZE_MAX || size * batch < GEMM_BATCHED_THREAD_SIZE_MIN)
+                return 1;
+            return Simd::Min(Base::GetThreadNumber(), batch);
+        }
+
+        void Gemm32fBatched(Gemm32fPtr gemm, size_t batch, size_t M, size_t N, size_t K, const float* alpha, 
+            const float* const* A, size_t lda, const float* const* B, size_t ldb, const float* beta, float* const* C, size_t ldc)
+        {
+            Simd::Parallel(0, batch, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t b = begin; b < end; ++b)
+                    gemm(M, N, K, alpha, A[b], lda, B[b], ldb, beta, C[b], ldc);
+            }, Gemm32fBatchedThreadNumber(batch, M, N, K));
+        }
+
+        void Gemm32fStridedBatched(Gemm32fPtr gemm, size_t batch, size_t M, size_t N, size_t K, const float* alpha, 
+            const float* A, size_t lda, size_t strideA, const float* B, size_t ldb, size_t strideB, const float* beta, float* C, size_t ldc, size_t strideC)
+        {
+            if (strideB == 0 && strideA == M * lda && strideC == M * ldc)
+            {
+                gemm(batch * M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+                return;
+            }
+            Simd::Parallel(0, batch, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t b = begin; b < end; ++b)
+                    gemm(M, N, K, alpha, A + b * strideA, lda, B + b * strideB, ldb, beta, C + b * strideC, ldc);
+            }, Gemm32fBatchedThreadNumber(batch, M, N, K));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t Gemm32fNNcbBufferSize(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility)
+        {
+            return N * K;
+        }
+
+        void Gemm32fNNcbReorderB(size_t M, size_t N, size_t K, const float* B, float* pB, GemmKernelType type, bool compatibility)
+        {
+            memcpy(pB, B, N * K * sizeof(float));
+        }
+
+        void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float* A, const float* pB, float* C, GemmKernelType type, bool compatibility)
+        {
+            const float alpha = 1.0f, beta = 1.0f;
+            memset(C, 0, M * N * sizeof(float));
+            Gemm32fNN(M, N, K, &alpha, A, K, pB, N, &beta, C, N);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        Gemm32fNNcbContext::Gemm32fNNcbContext(size_t N, size_t K, const float* B, Gemm32fNNcbBufferSizePtr bufferSize, Gemm32fNNcbReorderBPtr reorderB, Gemm32fNNcbRunPtr run)
+            : _N(N)
+            , _K(K)
+            , _run(run)
+        {
+            _pB.Resize(bufferSize(1, N, K, GemmKernelAny, true));
+            reorderB(1, N, K, B, _pB.data, GemmKernelAny, true);
+        }
+
+        void Gemm32fNNcbContext::Run(size_t M, const float* A, float* C)
+        {
+            size_t threadNumber = Simd::RestrictRange(M * _N * _K / GEMM_NNCB_THREAD_SIZE_MIN, size_t(1), Base::GetThreadNumber());
+            Simd::Parallel(0, M, [&](size_t thread, size_t begin, size_t end)
+            {
+                _run(end - begin, _N, _K, A + begin * _K, _pB.data, C + begin * _N, GemmKernelAny, true);
+            }, threadNumber, 12);
+        }
     }
 }
@@ -0,0 +1,113 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdGemm8u8i32i.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    Gemm8u8i32i::Gemm8u8i32i(const Gemm8u8i32iParam& p, SynetQuantizedInnerProduct* gemm)
+        : _param(p)
+        , _gemm(gemm)
+        , _zero(false)
+    {
+    }
+
+    Gemm8u8i32i::~Gemm8u8i32i()
+    {
+        delete _gemm;
+    }
+
+    size_t Gemm8u8i32i::ExternalBufferSize() const
+    {
+        return _gemm->ExternalBufferSize();
+    }
+
+    void Gemm8u8i32i::SetB(const int8_t* B, const int32_t* bZero, const float* bScale)
+    {
+        const Gemm8u8i32iParam& p = _param;
+        assert(B);
+        _zero = false;
+        _bZero.Resize(p.N, true);
+        if (bZero)
+        {
+            for (size_t j = 0; j < p.N; ++j)
+            {
+                _bZero[j] = bZero[j];
+                _zero = _zero || bZero[j] != 0;
+            }
+        }
+        _bScale.Resize(p.N);
+        for (size_t j = 0; j < p.N; ++j)
+            _bScale[j] = bScale ? bScale[j] : 1.0f;
+        float aScale = 1.0f;
+        _gemm->SetParams(&aScale, NULL, B, _bScale.data, NULL, NULL, NULL);
+    }
+
+    void Gemm8u8i32i::Run(const uint8_t* A, uint8_t* buf, uint8_t* C)
+    {
+        const Gemm8u8i32iParam& p = _param;
+        _gemm->Forward(A, NULL, buf, C);
+        if (p.typeC == SimdTensorData32i && !_zero)
+            return;
+        for (size_t i = 0; i < p.M; ++i)
+        {
+            int32_t sum = 0;
+            if (_zero)
+            {
+                const uint8_t* a = A + i * p.K;
+                for (size_t k = 0; k < p.K; ++k)
+                    sum += a[k];
+            }
+            int32_t* c = (int32_t*)C + i * p.N;
+            if (p.typeC == SimdTensorData32f)
+            {
+                for (size_t j = 0; j < p.N; ++j)
+                    ((float*)c)[j] = float(c[j] - sum * _bZero[j]) * _bScale[j];
+            }
+            else
+            {
+                for (size_t j = 0; j < p.N; ++j)
+                    c[j] -= sum * _bZero[j];
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        void* Gemm8u8i32iInit(size_t M, size_t N, size_t K, SimdTensorDataType typeC, SimdBool transB, SynetQuantizedInnerProductInitPtr init)
+        {
+            Gemm8u8i32iParam param(M, N, K, typeC, transB);
+            if (!param.Valid())
+                return NULL;
+            SynetQuantizedInnerProduct* gemm = (SynetQuantizedInnerProduct*)init(M, N, K, SimdTensorData8u, SimdTensorData8i, SimdTensorData32i, transB, SimdTrue, SimdFalse);
+            if (gemm == NULL)
+                return NULL;
+            return new Gemm8u8i32i(param, gemm);
+        }
+    }
+#endif
+}
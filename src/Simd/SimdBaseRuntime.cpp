@@ -0,0 +1,140 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdRuntime.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <fstream>
+
+namespace Simd
+{
+    namespace Base
+    {
+        const char * const RUNTIME_CACHE_SIGNATURE = "Simd::Runtime cache";
+        const int RUNTIME_CACHE_VERSION = 1;
+
+        struct RuntimeCache
+        {
+            typedef std::map<String, String> Map;
+
+            std::mutex mutex;
+            Map map;
+
+            static RuntimeCache & Instance()
+            {
+                static RuntimeCache cache;
+                return cache;
+            }
+        };
+
+        SIMD_INLINE String RuntimeCacheKey(const String & key)
+        {
+            std::stringstream ss;
+            ss << Cpu::CPU_MODEL << "\t" << GetThreadNumber() << "\t" << key;
+            return ss.str();
+        }
+
+        bool RuntimeCacheGet(const String & key, String & name)
+        {
+            RuntimeCache & cache = RuntimeCache::Instance();
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            RuntimeCache::Map::const_iterator it = cache.map.find(RuntimeCacheKey(key));
+            if (it == cache.map.end())
+                return false;
+            name = it->second;
+            return true;
+        }
+
+        void RuntimeCacheSet(const String & key, const String & name)
+        {
+            RuntimeCache & cache = RuntimeCache::Instance();
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            cache.map[RuntimeCacheKey(key)] = name;
+        }
+
+        void RuntimeCacheClear()
+        {
+            RuntimeCache & cache = RuntimeCache::Instance();
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            cache.map.clear();
+        }
+
+        bool RuntimeCacheSave(const char * path)
+        {
+            std::ofstream ofs(path);
+            if (!ofs.is_open())
+                return false;
+            RuntimeCache & cache = RuntimeCache::Instance();
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            ofs << RUNTIME_CACHE_SIGNATURE << " " << RUNTIME_CACHE_VERSION << std::endl;
+            for (RuntimeCache::Map::const_iterator it = cache.map.begin(); it != cache.map.end(); ++it)
+                ofs << it->first << "\t" << it->second << std::endl;
+            return (bool)ofs;
+        }
+
+        bool RuntimeCacheLoad(const char * path)
+        {
+            std::ifstream ifs(path);
+            if (!ifs.is_open())
+                return false;
+            String line;
+            std::stringstream header;
+            header << RUNTIME_CACHE_SIGNATURE << " " << RUNTIME_CACHE_VERSION;
+            if (!std::getline(ifs, line) || line != header.str())
+                return false;
+            RuntimeCache::Map map;
+            while (std::getline(ifs, line))
+            {
+                if (line.empty())
+                    continue;
+                size_t pos = line.find_last_of('\t');
+                if (pos == String::npos || pos == 0 || pos + 1 == line.size())
+                    return false;
+                map[line.substr(0, pos)] = line.substr(pos + 1);
+            }
+            RuntimeCache & cache = RuntimeCache::Instance();
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            for (RuntimeCache::Map::const_iterator it = map.begin(); it != map.end(); ++it)
+                cache.map[it->first] = it->second;
+            return true;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static std::atomic<bool> g_tuningMode(false);
+
+        bool GetTuningMode()
+        {
+            return g_tuningMode.load();
+        }
+
+        void SetTuningMode(bool value)
+        {
+            g_tuningMode.store(value);
+        }
+    }
+}
@@ -0,0 +1,191 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetAttention.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        static void Convert32f(const uint8_t* src8, size_t count, size_t stride, size_t size, float scale, float* dst)
+        {
+            const float* src = (const float*)src8;
+            for (size_t i = 0; i < count; ++i, src += stride, dst += size)
+                for (size_t j = 0; j < size; ++j)
+                    dst[j] = src[j] * scale;
+        }
+
+        static void Convert16b(const uint8_t* src8, size_t count, size_t stride, size_t size, float scale, float* dst)
+        {
+            const uint16_t* src = (const uint16_t*)src8;
+            for (size_t i = 0; i < count; ++i, src += stride, dst += size)
+                for (size_t j = 0; j < size; ++j)
+                    dst[j] = BFloat16ToFloat32(src[j]) * scale;
+        }
+
+        static void Attention(const float* q, const float* k, const float* v, size_t stride, size_t keys, size_t size, float* buf, float* dst)
+        {
+            float max = -FLT_MAX, sum = 0.0f;
+            for (size_t j = 0; j < size; ++j)
+                dst[j] = 0.0f;
+            for (size_t t = 0; t < keys; t += SynetAttention::KEY_TILE)
+            {
+                size_t n = Simd::Min(SynetAttention::KEY_TILE, keys - t);
+                float tileMax = -FLT_MAX;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    const float* ki = k + (t + i) * stride;
+                    float dot = 0.0f;
+                    for (size_t j = 0; j < size; ++j)
+                        dot += q[j] * ki[j];
+                    buf[i] = dot;
+                    tileMax = Simd::Max(tileMax, dot);
+                }
+                if (tileMax > max)
+                {
+                    float corr = Exp(max - tileMax);
+                    sum *= corr;
+                    for (size_t j = 0; j < size; ++j)
+                        dst[j] *= corr;
+                    max = tileMax;
+                }
+                for (size_t i = 0; i < n; ++i)
+                {
+                    const float* vi = v + (t + i) * stride;
+                    float p = Exp(buf[i] - max);
+                    sum += p;
+                    for (size_t j = 0; j < size; ++j)
+                        dst[j] += p * vi[j];
+                }
+            }
+            float norm = 1.0f / sum;
+            for (size_t j = 0; j < size; ++j)
+                dst[j] *= norm;
+        }
+
+        static void Store32f(const float* src, size_t size, uint8_t* dst)
+        {
+            memcpy(dst, src, size * sizeof(float));
+        }
+
+        static void Store16b(const float* src, size_t size, uint8_t* dst)
+        {
+            Float32ToBFloat16(src, size, (uint16_t*)dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetAttention::SynetAttention(const AttentionParam& p)
+            : Simd::SynetAttention(p)
+        {
+            _threadNumber = p.Flop() >= SYNET_ATTENTION_THREAD_FLOP_MIN ? Base::GetThreadNumber() : 1;
+            _queryBlocks = DivHi(p.queries, QUERY_BLOCK);
+            _stride = p.heads * p.size;
+            _convert = p.srcType == SimdTensorData32f ? Convert32f : Convert16b;
+            _attention = Attention;
+            _store = p.dstType == SimdTensorData32f ? Store32f : Store16b;
+        }
+
+        String SynetAttention::Desc() const
+        {
+            return Ext() + "::StreamingSoftmax";
+        }
+
+        size_t SynetAttention::ExternalBufferSize() const
+        {
+            const AttentionParam& p = _param;
+            size_t size = AlignHi(p.size, SIMD_ALIGN / sizeof(float)) * 2 + KEY_TILE;
+            if (p.srcType != SimdTensorData32f)
+                size += p.keys * p.size * 2;
+            return AlignHi(size * sizeof(float), SIMD_ALIGN) * _threadNumber;
+        }
+
+        void SynetAttention::Forward(const uint8_t* q, const uint8_t* k, const uint8_t* v, uint8_t* buf, uint8_t* dst)
+        {
+            const AttentionParam& p = _param;
+            buf = Buffer(buf);
+            size_t items = p.batch * p.heads * _queryBlocks, bufSize = ExternalBufferSize() / _threadNumber;
+            Simd::Parallel(0, items, [&](size_t thread, size_t begin, size_t end)
+            {
+                ForwardItems(q, k, v, begin, end, buf + thread * bufSize, dst);
+            }, _threadNumber);
+        }
+
+        void SynetAttention::ForwardItems(const uint8_t* q, const uint8_t* k, const uint8_t* v, size_t begin, size_t end, uint8_t* buf, uint8_t* dst)
+        {
+            const AttentionParam& p = _param;
+            size_t srcE = p.srcType == SimdTensorData32f ? 4 : 2, dstE = p.dstType == SimdTensorData32f ? 4 : 2;
+            size_t sizeA = AlignHi(p.size, SIMD_ALIGN / sizeof(float));
+            float* bq = (float*)buf, * ba = bq + sizeA, * bs = ba + sizeA, * bk = bs + KEY_TILE, * bv = bk + p.keys * p.size;
+            size_t last = SIZE_MAX;
+            for (size_t item = begin; item < end; ++item)
+            {
+                size_t qb = item % _queryBlocks, bh = item / _queryBlocks, h = bh % p.heads, b = bh / p.heads;
+                size_t offs = h * p.size;
+                const float* pk, * pv;
+                size_t stride;
+                if (p.srcType == SimdTensorData32f)
+                {
+                    pk = (const float*)k + b * p.keys * _stride + offs;
+                    pv = (const float*)v + b * p.keys * _stride + offs;
+                    stride = _stride;
+                }
+                else
+                {
+                    if (bh != last)
+                    {
+                        _convert(k + (b * p.keys * _stride + offs) * srcE, p.keys, _stride, p.size, 1.0f, bk);
+                        _convert(v + (b * p.keys * _stride + offs) * srcE, p.keys, _stride, p.size, 1.0f, bv);
+                        last = bh;
+                    }
+                    pk = bk;
+                    pv = bv;
+                    stride = p.size;
+                }
+                for (size_t i = qb * QUERY_BLOCK, n = Simd::Min(i + QUERY_BLOCK, p.queries); i < n; ++i)
+                {
+                    size_t offset = (b * p.queries + i) * _stride + offs;
+                    _convert(q + offset * srcE, 1, _stride, p.size, p.scale, bq);
+                    _attention(bq, pk, pv, stride, p.keys, p.size, bs, ba);
+                    _store(ba, p.size, dst + offset * dstE);
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetAttentionInit(size_t batch, size_t heads, size_t queries, size_t keys, size_t size, SimdTensorDataType srcType, SimdTensorDataType dstType, float scale)
+        {
+            AttentionParam param(batch, heads, queries, keys, size, srcType, dstType, scale);
+            if (!param.Valid())
+                return NULL;
+            return new SynetAttention(param);
+        }
+    }
+#endif
+}
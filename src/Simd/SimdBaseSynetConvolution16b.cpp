@@ -24,6 +24,7 @@
 #include "Simd/SimdSynetConvolution16b.h"
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynetConvolution32fCommon.h"
+#include "Simd/SimdSynetWeightBlob.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdBFloat16.h"
@@ -44,6 +45,7 @@ namespace Simd
         _elemS = _src16b ? 2 : 4;
         _elemD = _dst16b ? 2 : 4;
         _is1x1 = p.Is1x1();
+        _threadNumber = p.Flop() < SYNET_CONVOLUTION_16B_THREAD_FLOP_MIN ? 1 : Base::GetThreadNumber();
     }
 
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
@@ -116,6 +118,35 @@ namespace Simd
         }
     }
 
+    bool SynetConvolution16b::Share(const SynetConvolution16b& other)
+    {
+        if (&other == this)
+            return true;
+        if (other._bias.Empty() || !_param.Equal(other._param) || Desc() != other.Desc() || ExternalBufferSize() != other.ExternalBufferSize())
+            return false;
+        _weight.Share(other._weight);
+        _bias.Assign(other._bias.data, other._bias.size);
+        _params.Assign(other._params.data, other._params.size);
+        return true;
+    }
+
+    size_t SynetConvolution16b::Export(uint8_t* blob, size_t size) const
+    {
+        if (_bias.Empty())
+            return 0;
+        SynetWeightBlobWriter writer(blob, size, _param, Desc());
+        writer.Write(_weight);
+        writer.Write(_bias);
+        writer.Write(_params);
+        return writer.Finish();
+    }
+
+    bool SynetConvolution16b::Import(const uint8_t* blob, size_t size)
+    {
+        SynetWeightBlobReader reader(blob, size, _param, Desc());
+        return reader.Ok() && reader.Read(_weight) && reader.Read(_bias) && reader.Read(_params);
+    }
+
     //-------------------------------------------------------------------------------------------------
 
     namespace Base
@@ -172,6 +203,7 @@ namespace Simd
         void SynetConvolution16bGemm::SetParams(const float* weight, const float* bias, const float* params)
         {
             const ConvParam& p = _param;
+            _weight.Resize(_weight.size);
             Float32ToBFloat16(weight, _weight.size, _weight.data);
             SynetConvolution16b::SetBias(bias, Alignment());
             SynetConvolution16b::SetParams(params, Alignment());
@@ -320,6 +352,8 @@ namespace Simd
             ConvParam param(batch, conv, compatibility);
             if (!param.Valid(SimdTensorData32f, SimdTensorData16b))
                 return NULL;
+            if (Base::SynetConvolution16bNhwcWinograd::Preferable(param))
+                return new Base::SynetConvolution16bNhwcWinograd(param);
             if (Base::SynetConvolution16bNhwcDepthwise::Preferable(param))
                 return new Base::SynetConvolution16bNhwcDepthwise(param);
             return new SynetConvolution16bGemm(param);
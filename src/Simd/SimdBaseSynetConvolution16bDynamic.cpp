@@ -0,0 +1,150 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution16b.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        SynetConvolution16bDynamic::SynetConvolution16bDynamic(SynetConvolution16b* conv, SynetConvolution16bInitPtr init)
+            : SynetConvolution16b(conv->Param())
+            , _init(init)
+            , _conv(conv)
+            , _used(0)
+            , _weightF(NULL)
+            , _biasF(NULL)
+            , _paramsF(NULL)
+        {
+            _convs[Shape(_param.batch, _param.srcH, _param.srcW)] = Conv(_conv, _used);
+        }
+
+        SynetConvolution16bDynamic::~SynetConvolution16bDynamic()
+        {
+            for (Convs::iterator it = _convs.begin(); it != _convs.end(); ++it)
+                delete it->second.conv;
+        }
+
+        size_t SynetConvolution16bDynamic::ExternalBufferSize() const
+        {
+            return _conv->ExternalBufferSize();
+        }
+
+        size_t SynetConvolution16bDynamic::InternalBufferSize() const
+        {
+            size_t size = 0;
+            for (Convs::const_iterator it = _convs.begin(); it != _convs.end(); ++it)
+                size += it->second.conv->InternalBufferSize();
+            return size;
+        }
+
+        void SynetConvolution16bDynamic::SetParams(const float* weight, const float* bias, const float* params)
+        {
+            _weightF = weight;
+            _biasF = bias;
+            _paramsF = params;
+            for (Convs::iterator it = _convs.begin(); it != _convs.end(); ++it)
+                it->second.conv->SetParams(weight, bias, params);
+        }
+
+        bool SynetConvolution16bDynamic::Share(const SynetConvolution16b& other)
+        {
+            if (&other == this)
+                return true;
+            if (!_param.Equal(other.Param()) || Desc() != other.Desc())
+                return false;
+            const SynetConvolution16bDynamic& dynamic = (const SynetConvolution16bDynamic&)other;
+            if (dynamic._weightF == NULL || !_conv->Share(*dynamic._conv))
+                return false;
+            _weightF = dynamic._weightF;
+            _biasF = dynamic._biasF;
+            _paramsF = dynamic._paramsF;
+            for (Convs::iterator it = _convs.begin(); it != _convs.end(); ++it)
+            {
+                if (it->second.conv == _conv)
+                    continue;
+                Convs::const_iterator src = dynamic._convs.find(it->first);
+                if (src == dynamic._convs.end() || !it->second.conv->Share(*src->second.conv))
+                    it->second.conv->SetParams(_weightF, _biasF, _paramsF);
+            }
+            return true;
+        }
+
+        void SynetConvolution16bDynamic::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        {
+            _conv->Forward(src, buf, dst);
+        }
+
+        bool SynetConvolution16bDynamic::Reshape(size_t batch, size_t srcH, size_t srcW)
+        {
+            Shape shape(batch, srcH, srcW);
+            Convs::iterator it = _convs.find(shape);
+            if (it == _convs.end())
+            {
+                ConvParam p = _param;
+                size_t kernelY = p.dilationY * (p.kernelY - 1) + 1, kernelX = p.dilationX * (p.kernelX - 1) + 1;
+                if (batch == 0 || srcH + p.padY + p.padH < kernelY || srcW + p.padX + p.padW < kernelX)
+                    return false;
+                p.batch = batch;
+                p.srcH = srcH;
+                p.srcW = srcW;
+                p.dstH = (srcH + p.padY + p.padH - kernelY) / p.strideY + 1;
+                p.dstW = (srcW + p.padX + p.padW - kernelX) / p.strideX + 1;
+                SynetConvolution16b* conv = (SynetConvolution16b*)_init(batch, &p, p.compatibility);
+                if (conv == NULL)
+                    return false;
+                if (_weightF)
+                    conv->SetParams(_weightF, _biasF, _paramsF);
+                if (_convs.size() >= CAPACITY)
+                {
+                    Convs::iterator lru = _convs.end();
+                    for (Convs::iterator i = _convs.begin(); i != _convs.end(); ++i)
+                        if (i->second.conv != _conv && (lru == _convs.end() || i->second.used < lru->second.used))
+                            lru = i;
+                    delete lru->second.conv;
+                    _convs.erase(lru);
+                }
+                it = _convs.insert(Convs::value_type(shape, Conv(conv))).first;
+            }
+            it->second.used = ++_used;
+            _conv = it->second.conv;
+            _param = _conv->Param();
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+            _perf = NULL;
+#endif
+            return true;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetConvolution16bInitDynamic(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility, SynetConvolution16bInitPtr init)
+        {
+            SynetConvolution16b* first = (SynetConvolution16b*)init(batch, conv, compatibility);
+            if (first == NULL)
+                return NULL;
+            return new SynetConvolution16bDynamic(first, init);
+        }
+    }
+#endif
+}
@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdSynetConvolution16b.h"
 #include "Simd/SimdSynetConvolution16bCommon.h"
+#include "Simd/SimdSynetWeightBlob.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdBFloat16.h"
@@ -142,6 +143,32 @@ namespace Simd
             SynetConvolution16b::SetParams(params, SIMD_ALIGN);
         }
 
+        bool SynetConvolution16bNhwcDepthwise::Share(const SynetConvolution16b& other)
+        {
+            if (!SynetConvolution16b::Share(other))
+                return false;
+            const SynetConvolution16bNhwcDepthwise& depthwise = (const SynetConvolution16bNhwcDepthwise&)other;
+            _weight.Assign(depthwise._weight.data, depthwise._weight.size);
+            return true;
+        }
+
+        size_t SynetConvolution16bNhwcDepthwise::Export(uint8_t* blob, size_t size) const
+        {
+            if (_bias.Empty())
+                return 0;
+            SynetWeightBlobWriter writer(blob, size, _param, Desc());
+            writer.Write(_weight);
+            writer.Write(_bias);
+            writer.Write(_params);
+            return writer.Finish();
+        }
+
+        bool SynetConvolution16bNhwcDepthwise::Import(const uint8_t* blob, size_t size)
+        {
+            SynetWeightBlobReader reader(blob, size, _param, Desc());
+            return reader.Ok() && reader.Read(_weight) && reader.Read(_bias) && reader.Read(_params);
+        }
+
         void SynetConvolution16bNhwcDepthwise::Forward(const uint8_t* src, uint8_t* buf8, uint8_t* dst)
         {
             const ConvParam& p = _param;
@@ -28,6 +28,7 @@
 #include "Simd/SimdBase.h"
 #include "Simd/SimdBFloat16.h"
 #include "Simd/SimdAlignment.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -69,13 +70,15 @@ namespace Simd
             a.macroK = Simd::RestrictRange(AlignLo(L1 / a.microD / 2, a.microK), a.microK, a.bufK);
             a.batch = 1;
             size_t bufSize = a.M * a.bufK * 2;
-            if (bufSize * 2 <= L2 && p.batch > 1)
+            if (bufSize * 2 <= L2 && p.batch > 1 && _threadNumber == 1)
             {
                 for (size_t batch = 1; batch <= p.batch; ++batch)
                     if (p.batch % batch == 0 && batch * bufSize <= L2)
                         a.batch = batch;
             }
             a.macroH = Simd::RestrictRange(L2 / a.macroK / p.dstW / 2, size_t(1), p.dstH * a.batch);
+            if (_threadNumber > 1)
+                a.macroH = Simd::Min(a.macroH, DivHi(p.dstH, _threadNumber));
             a.macroD = Simd::RestrictRange(AlignLoAny(L3 / a.macroK / 2, a.microD), a.microD, a.bufD);
             a.bufM = a.batch * p.dstH * AlignHi(p.dstW, a.F);
             a.elem = _elemD;
@@ -94,10 +97,10 @@ namespace Simd
             const AlgParam& a = _alg;
             size_t size = 0;
             if(_convert)
-                size += a.bufM * a.bufK * sizeof(uint16_t);
+                size += AlignHi(a.bufM * a.bufK * sizeof(uint16_t), SIMD_ALIGN);
             if (a.sumBuf)
-                size += a.macroD * a.bufM * sizeof(float);
-            return size;
+                size += AlignHi(a.macroD * a.bufM * sizeof(float), SIMD_ALIGN);
+            return size * _threadNumber;
         }
 
         void SynetConvolution16bNhwcGemmV0::SetParams(const float* weight, const float* bias, const float* params)
@@ -139,24 +142,26 @@ namespace Simd
             const ConvParam& p = _param;
             const AlgParam& a = _alg;
             buf8 = Buffer(buf8);
-            uint16_t* bufB = _convert ? Allocate<uint16_t>(buf8, a.bufM * a.bufK) : NULL;
-            float* bufS = a.sumBuf ? Allocate<float>(buf8, a.macroD * a.bufM) : NULL;
+            size_t bufSize = ExternalBufferSize() / _threadNumber;
             for (size_t b = 0; b < p.batch; b += a.batch)
             {
-                uint16_t* buf = _convert ? bufB : (uint16_t*)src;
-                float* sum = a.sumBuf ? bufS : (float*)dst;
-                Forward(src, buf, sum, dst);
+                Simd::Parallel(0, p.dstH * a.batch, [&](size_t thread, size_t yBeg, size_t yEnd)
+                {
+                    uint8_t* buf = buf8 + thread * bufSize;
+                    uint16_t* bufB = _convert ? Allocate<uint16_t>(buf, a.bufM * a.bufK) : (uint16_t*)src;
+                    float* bufS = a.sumBuf ? Allocate<float>(buf, a.macroD * a.bufM) : (float*)dst;
+                    Forward(src, bufB, bufS, dst, yBeg, yEnd);
+                }, _threadNumber);
                 src += _stepS;
                 dst += _stepD;
             }
         }
 
-        void SynetConvolution16bNhwcGemmV0::Forward(const uint8_t* src, uint16_t* buf, float* sum, uint8_t* dst)
+        void SynetConvolution16bNhwcGemmV0::Forward(const uint8_t* src, uint16_t* buf, float* sum, uint8_t* dst, size_t begin, size_t end)
         {
             const ConvParam& p = _param;
             const AlgParam& a = _alg;
             const float* bias = _bias.data, * params = _params.data;
-            size_t dstH = p.dstH * a.batch;
             for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
             {
                 size_t macroD = Simd::Min(p.dstC, dc + a.macroD) - dc;
@@ -164,9 +169,9 @@ namespace Simd
                 for (size_t mak = 0; mak < a.K; mak += a.macroK)
                 {
                     size_t macroK = Simd::Min(a.bufK, mak + a.macroK) - mak;
-                    for (size_t yBeg = 0; yBeg < dstH;)
+                    for (size_t yBeg = begin; yBeg < end;)
                     {
-                        size_t yEnd = Simd::Min(yBeg + a.macroH, dstH);
+                        size_t yEnd = Simd::Min(yBeg + a.macroH, end);
                         size_t bufOffs = (a.macroK < a.bufK || _convert == NULL) ? 
                             yBeg * (_convert ? AlignHi(p.dstW, a.F) : p.dstW) * a.bufK + (a.reorderType ? mak * a.F : mak) : 0;
                         size_t sumOffs = a.macroK < a.bufK ? yBeg * (a.microK > 2 ? AlignHi(p.dstW, a.F) : p.dstW)* a.dB : 0;
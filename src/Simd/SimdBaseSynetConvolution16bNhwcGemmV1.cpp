@@ -28,6 +28,7 @@
 #include "Simd/SimdBase.h"
 #include "Simd/SimdBFloat16.h"
 #include "Simd/SimdAlignment.h"
+#include "Simd/SimdParallel.hpp"
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdCpu.h"
 
@@ -120,13 +121,15 @@ namespace Simd
             a.bufK = AlignHi(a.K, microK);
             a.batch = 1;
             size_t bufSize = a.M * a.bufK * 2;
-            if (bufSize * 2 <= L2 && p.batch > 1)
+            if (bufSize * 2 <= L2 && p.batch > 1 && _threadNumber == 1)
             {
                 for (size_t batch = 1; batch <= p.batch; ++batch)
                     if (p.batch % batch == 0 && batch * bufSize <= L2)
                         a.batch = batch;
             }
             a.macroH = Simd::RestrictRange(L2 / a.bufK / p.dstW / 2, size_t(1), p.dstH * a.batch);
+            if (_threadNumber > 1)
+                a.macroH = Simd::Min(a.macroH, DivHi(p.dstH, _threadNumber));
             a.macroD = Simd::RestrictRange(AlignLoAny(L3 / a.bufK / 2, a.miniD), a.miniD, a.bufD);
             if (CanDir1x4(p))
             {
@@ -148,9 +151,9 @@ namespace Simd
             const AlgParam& a = _alg;
             size_t size = 0;
             if(_convert)
-                size += a.bufM * a.bufK * sizeof(uint16_t);
-            size += a.miniD * a.microM * sizeof(float) * 2;
-            return size;
+                size += AlignHi(a.bufM * a.bufK * sizeof(uint16_t), SIMD_ALIGN);
+            size += AlignHi(a.miniD * a.microM * sizeof(float) * 2, SIMD_ALIGN);
+            return size * _threadNumber;
         }
 
         void SynetConvolution16bNhwcGemmV1::SetParams(const float* weight, const float* bias, const float* params)
@@ -192,28 +195,32 @@ namespace Simd
             const ConvParam& p = _param;
             const AlgParam& a = _alg;
             buf8 = Buffer(buf8);
-            uint16_t* bufB = _convert ? Allocate<uint16_t>(buf8, a.bufM * a.bufK) : NULL;
-            float* bufS = Allocate<float>(buf8, a.microD * a.microM);
+            size_t bufSize = ExternalBufferSize() / _threadNumber;
+            bool inv = a.inv && CanInv2x2_old(_param);
             for (size_t b = 0; b < p.batch; b += a.batch)
             {
-                uint16_t* buf = _convert ? bufB : (uint16_t*)src;
-                if(a.inv && CanInv2x2_old(_param))
-                    ForwardInv(src, buf, bufS, dst);
-                else
-                    ForwardDir(src, buf, bufS, dst);
+                Simd::Parallel(0, p.dstH * a.batch, [&](size_t thread, size_t yBeg, size_t yEnd)
+                {
+                    uint8_t* buf = buf8 + thread * bufSize;
+                    uint16_t* bufB = _convert ? Allocate<uint16_t>(buf, a.bufM * a.bufK) : (uint16_t*)src;
+                    float* bufS = Allocate<float>(buf, a.microD * a.microM);
+                    if (inv)
+                        ForwardInv(src, bufB, bufS, dst, yBeg, yEnd);
+                    else
+                        ForwardDir(src, bufB, bufS, dst, yBeg, yEnd);
+                }, _threadNumber);
                 src += _stepS;
                 dst += _stepD;
             }
         }
 
-        void SynetConvolution16bNhwcGemmV1::ForwardDir(const uint8_t* src, uint16_t* buf, float* sum, uint8_t* dst)
+        void SynetConvolution16bNhwcGemmV1::ForwardDir(const uint8_t* src, uint16_t* buf, float* sum, uint8_t* dst, size_t begin, size_t end)
         {
             const ConvParam& p = _param;
             const AlgParam& a = _alg;
-            size_t dstH = p.dstH * a.batch;
-            for (size_t yBeg = 0; yBeg < dstH;)
+            for (size_t yBeg = begin; yBeg < end;)
             {
-                size_t yEnd = Simd::Min(yBeg + a.macroH, dstH);
+                size_t yEnd = Simd::Min(yBeg + a.macroH, end);
                 size_t bufOffs = _convert == NULL ? yBeg * p.dstW * p.srcC : 0;
                 size_t dstOffs = yBeg * p.dstW * p.dstC * _elemD;
                 if (_convert)
@@ -233,19 +240,18 @@ namespace Simd
             }
         }
 
-        void SynetConvolution16bNhwcGemmV1::ForwardInv(const uint8_t* src, uint16_t* buf, float* sum, uint8_t* dst)
+        void SynetConvolution16bNhwcGemmV1::ForwardInv(const uint8_t* src, uint16_t* buf, float* sum, uint8_t* dst, size_t begin, size_t end)
         {
             const ConvParam& p = _param;
             const AlgParam& a = _alg;
             const float* bias = _bias.data, * params = _params.data;
-            size_t dstH = p.dstH * a.batch;
             for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
             {
                 size_t macroD = Simd::Min(p.dstC, dc + a.macroD) - dc;
                 const uint16_t* weight = _weight.data + dc * a.bufK;
-                for (size_t yBeg = 0; yBeg < dstH;)
+                for (size_t yBeg = begin; yBeg < end;)
                 {
-                    size_t yEnd = Simd::Min(yBeg + a.macroH, dstH);
+                    size_t yEnd = Simd::Min(yBeg + a.macroH, end);
                     size_t bufOffs = (_convert == NULL || a.macroD < p.dstC) ? yBeg * (_convert ? AlignHi(p.dstW, 16) : p.dstW) * a.bufK : 0;
                     size_t dstOffs = yBeg * p.dstW * p.dstC * _elemD;
                     if (dc == 0 && _convert)
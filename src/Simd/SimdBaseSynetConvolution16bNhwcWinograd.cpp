@@ -0,0 +1,197 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution16b.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        SynetConvolution16bNhwcWinograd::SynetConvolution16bNhwcWinograd(const ConvParam& p)
+            : SynetConvolution16b(p)
+        {
+            if ((p.compatibility & SimdSynetCompatibility16bWinograd4x4) && p.srcH >= 8 && p.srcW >= 8 && p.srcH * p.srcW * p.batch >= 144)
+            {
+                SetBlock(4, 4);
+                _setFilter = Base::WinogradKernel3x3Block4x4SetFilter;
+                _setInput = Base::WinogradKernel3x3Block4x4SetInput;
+                _setOutput = Base::WinogradKernel3x3Block4x4SetOutput;
+            }
+            else
+            {
+                SetBlock(2, 2);
+                _setFilter = Base::WinogradKernel3x3Block2x2SetFilter;
+                _setInput = Base::WinogradKernel3x3Block2x2SetInput;
+                _setOutput = Base::WinogradKernel3x3Block2x2SetOutput;
+            }
+            SetGemm(Base::SynetInnerProduct16bInit);
+            _biasAndActivation = Base::ConvolutionBiasAndActivation;
+            _bFloat16ToFloat32 = Base::BFloat16ToFloat32;
+            _float32ToBFloat16 = Base::Float32ToBFloat16;
+        }
+
+        SynetConvolution16bNhwcWinograd::~SynetConvolution16bNhwcWinograd()
+        {
+            Release();
+        }
+
+        String SynetConvolution16bNhwcWinograd::Desc() const
+        {
+            std::stringstream desc;
+            desc << Ext() << "::NhwcWinograd F(" << _blockY << "x" << _blockX << ",3x3)";
+            if (_merge > 1)
+                desc << "-" << _merge;
+            return desc.str();
+        }
+
+        void SynetConvolution16bNhwcWinograd::SetBlock(size_t blockY, size_t blockX)
+        {
+            const ConvParam& p = _param;
+            _blockY = blockY;
+            _blockX = blockX;
+            _count = (_blockY + p.kernelY - 1) * (_blockX + p.kernelX - 1);
+            _tileH = DivHi(p.dstH, _blockY);
+            _tileW = DivHi(p.dstW, _blockX);
+            _M = _tileH * _tileW;
+            _merge = 1;
+            for (size_t merge = 1; merge <= p.batch; ++merge)
+                if (p.batch % merge == 0 && _M * merge <= 256)
+                    _merge = merge;
+            _sizeS = p.srcC * p.srcH * p.srcW;
+            _sizeD = p.dstC * p.dstH * p.dstW;
+            _strideS = p.srcC * _M;
+            _strideD = p.dstC * _M;
+            _stepS = _sizeS * _merge * _elemS;
+            _stepD = _sizeD * _merge * _elemD;
+        }
+
+        void SynetConvolution16bNhwcWinograd::SetGemm(SynetInnerProduct16bInitPtr init)
+        {
+            const ConvParam& p = _param;
+            Release();
+            _gemms.resize(_count, NULL);
+            for (size_t i = 0; i < _count; ++i)
+                _gemms[i] = (SynetInnerProduct16b*)init(_M * _merge, p.dstC, p.srcC, SimdTensorData32f, SimdTensorData32f, 
+                    SimdTensorData32f, SimdFalse, SimdTrue, SimdFalse, SimdConvolutionActivationIdentity);
+        }
+
+        void SynetConvolution16bNhwcWinograd::Release()
+        {
+            for (size_t i = 0; i < _gemms.size(); ++i)
+                delete _gemms[i];
+            _gemms.clear();
+        }
+
+        size_t SynetConvolution16bNhwcWinograd::GemmBufferSize() const
+        {
+            return AlignHi(_gemms[0]->ExternalBufferSize(), SIMD_ALIGN) + 4 * SIMD_ALIGN;
+        }
+
+        size_t SynetConvolution16bNhwcWinograd::ExternalBufferSize() const
+        {
+            size_t size = SIMD_ALIGN;
+            size += AlignHi((_strideS + _strideD) * _merge * _count * sizeof(float), SIMD_ALIGN);
+            if (_src16b)
+                size += AlignHi(_sizeS * sizeof(float), SIMD_ALIGN);
+            if (_dst16b)
+                size += AlignHi(_sizeD * sizeof(float), SIMD_ALIGN);
+            size += GemmBufferSize() * Simd::Min(_threadNumber, _count);
+            return size;
+        }
+
+        size_t SynetConvolution16bNhwcWinograd::InternalBufferSize() const
+        {
+            size_t size = SynetConvolution16b::InternalBufferSize();
+            for (size_t i = 0; i < _gemms.size(); ++i)
+                size += _gemms[i]->InternalBufferSize();
+            return size;
+        }
+
+        void SynetConvolution16bNhwcWinograd::SetParams(const float* weight, const float* bias, const float* params)
+        {
+            const ConvParam& p = _param;
+            size_t size = p.srcC * p.dstC;
+            Array32f filter(size * _count);
+            _setFilter(weight, size, filter.data, SimdTrue);
+            for (size_t i = 0; i < _count; ++i)
+                _gemms[i]->SetParams(filter.data + i * size, NULL, NULL);
+            SynetConvolution16b::SetBias(bias, SIMD_ALIGN / sizeof(float));
+            SynetConvolution16b::SetParams(params, SIMD_ALIGN / sizeof(float));
+        }
+
+        void SynetConvolution16bNhwcWinograd::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        {
+            const ConvParam& p = _param;
+            buf = Buffer(buf);
+            float* bufS = Allocate<float>(buf, _strideS * _merge * _count);
+            float* bufD = Allocate<float>(buf, _strideD * _merge * _count);
+            float* bufSrc = _src16b ? Allocate<float>(buf, _sizeS) : NULL;
+            float* bufDst = _dst16b ? Allocate<float>(buf, _sizeD) : NULL;
+            size_t threads = Simd::Min(_threadNumber, _count), gemmSize = GemmBufferSize();
+            uint8_t* bufG = Allocate<uint8_t>(buf, gemmSize * threads);
+            for (size_t b = 0; b < p.batch; b += _merge)
+            {
+                for (size_t m = 0; m < _merge; ++m)
+                {
+                    const float* ps = (float*)src + m * _sizeS;
+                    if (_src16b)
+                    {
+                        _bFloat16ToFloat32((uint16_t*)src + m * _sizeS, _sizeS, bufSrc);
+                        ps = bufSrc;
+                    }
+                    _setInput(ps, p.srcC, p.srcH, p.srcW, p.padY, p.padX, p.padH, p.padW, bufS + m * _strideS, _strideS * _merge, SimdTrue);
+                }
+                Simd::Parallel(0, _count, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                        _gemms[i]->Forward((uint8_t*)(bufS + i * _strideS * _merge), NULL, bufG + thread * gemmSize, (uint8_t*)(bufD + i * _strideD * _merge));
+                }, threads);
+                for (size_t m = 0; m < _merge; ++m)
+                {
+                    float* pd = _dst16b ? bufDst : (float*)dst + m * _sizeD;
+                    _setOutput(bufD + m * _strideD, _strideD * _merge, pd, p.dstC, p.dstH, p.dstW, SimdTrue);
+                    _biasAndActivation(_bias.data, p.dstC, p.dstH * p.dstW, p.activation, _params.data, SimdTrue, pd);
+                    if (_dst16b)
+                        _float32ToBFloat16(bufDst, _sizeD, (uint16_t*)dst + m * _sizeD);
+                }
+                src += _stepS;
+                dst += _stepD;
+            }
+        }
+
+        bool SynetConvolution16bNhwcWinograd::Preferable(const ConvParam& p)
+        {
+            if ((p.compatibility & SimdSynetCompatibility16bWinogradMask) == 0)
+                return false;
+            if (!p.trans || !p.IsKernel(3) || !p.IsDilation(1) || !p.IsStride(1) || p.group != 1 || !(p.IsPad(0) || p.IsPad(1)))
+                return false;
+            return p.srcC >= 16 && p.dstC >= 16 && p.srcH >= 4 && p.srcW >= 4 && p.srcH * p.srcW * p.batch >= 36;
+        }
+    }
+#endif
+}
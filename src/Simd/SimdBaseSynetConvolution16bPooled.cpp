@@ -0,0 +1,132 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution16b.h"
+#include "Simd/SimdCpu.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        SynetConvolution16bPooled::SynetConvolution16bPooled(const ConvParam& p, const ConvPoolParam& pool, SynetConvolution16b* conv, Float32ToBFloat16Ptr toBf16)
+            : SynetConvolution16b(p)
+            , _pool(pool)
+            , _conv(conv)
+            , _toBf16(toBf16)
+        {
+            _sizeB = AlignHi(_pool.bandH * p.dstW * p.dstC * sizeof(float), SIMD_ALIGN);
+            _sizeS = _pool.stage ? AlignHi(p.srcC * _pool.conv.srcH * p.srcW * _elemS, SIMD_ALIGN) : 0;
+            _sizeP = _dst16b || (!p.trans && _pool.bands.size() > 1) ? AlignHi(_pool.bandH / _pool.kernelY * _pool.dstW * p.dstC * sizeof(float), SIMD_ALIGN) : 0;
+        }
+
+        SynetConvolution16bPooled::~SynetConvolution16bPooled()
+        {
+            delete _conv;
+        }
+
+        size_t SynetConvolution16bPooled::ExternalBufferSize() const
+        {
+            return _sizeB + _sizeS + _sizeP + _conv->ExternalBufferSize();
+        }
+
+        size_t SynetConvolution16bPooled::InternalBufferSize() const
+        {
+            return _buffer.RawSize() + _conv->InternalBufferSize();
+        }
+
+        void SynetConvolution16bPooled::SetParams(const float* weight, const float* bias, const float* params)
+        {
+            _conv->SetParams(weight, bias, params);
+        }
+
+        void SynetConvolution16bPooled::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        {
+            const ConvParam& p = _param;
+            buf = Buffer(buf);
+            float* band = (float*)buf, * pool = (float*)(buf + _sizeB + _sizeS);
+            uint8_t* stage = buf + _sizeB, * convBuf = buf + _sizeB + _sizeS + _sizeP;
+            size_t sizeS = p.srcC * p.srcH * p.srcW, sizeD = p.dstC * _pool.dstH * _pool.dstW;
+            for (size_t b = 0; b < p.batch; ++b)
+            {
+                for (size_t i = 0; i < _pool.bands.size(); ++i)
+                {
+                    const ConvPoolParam::Band& bnd = _pool.bands[i];
+                    const uint8_t* ps = stage;
+                    if (bnd.stage)
+                        _pool.Stage(src, p, _elemS, bnd.srcY, stage);
+                    else
+                        ps = src + bnd.srcY * p.srcW * p.srcC * _elemS;
+                    _conv->Forward(ps, convBuf, (uint8_t*)band);
+                    size_t dY = bnd.dstY / _pool.kernelY, dH = DivHi(bnd.dstH, _pool.kernelY);
+                    if (p.trans)
+                    {
+                        size_t offset = dY * _pool.dstW * p.dstC;
+                        if (_dst16b)
+                        {
+                            _pool.Pool(band, p, bnd, pool);
+                            _toBf16(pool, dH * _pool.dstW * p.dstC, (uint16_t*)dst + offset);
+                        }
+                        else
+                            _pool.Pool(band, p, bnd, (float*)dst + offset);
+                    }
+                    else if (dH == _pool.dstH && !_dst16b)
+                        _pool.Pool(band, p, bnd, (float*)dst);
+                    else
+                    {
+                        _pool.Pool(band, p, bnd, pool);
+                        for (size_t c = 0; c < p.dstC; ++c)
+                        {
+                            size_t offset = (c * _pool.dstH + dY) * _pool.dstW;
+                            if (_dst16b)
+                                _toBf16(pool + c * dH * _pool.dstW, dH * _pool.dstW, (uint16_t*)dst + offset);
+                            else
+                                memcpy((float*)dst + offset, pool + c * dH * _pool.dstW, dH * _pool.dstW * sizeof(float));
+                        }
+                    }
+                }
+                src += sizeS * _elemS;
+                dst += sizeD * _elemD;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetConvolution16bInitPooled(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility,
+            SimdSynetPoolingMethodType method, size_t kernelY, size_t kernelX, SynetConvolution16bInitPtr init,
+            SynetPoolingMax32fPtr poolingMax, SynetPoolingAverage32fPtr poolingAverage, Float32ToBFloat16Ptr toBf16)
+        {
+            ConvParam param(batch, conv, compatibility);
+            ConvPoolParam pool(param, method, kernelY, kernelX, poolingMax, poolingAverage);
+            if (!param.Valid(SimdTensorData32f, SimdTensorData16b) || !pool.Valid(param))
+                return NULL;
+            pool.SetBands(param, Base::AlgCacheL2() / 2);
+            pool.conv.dstT = SimdTensorData32f;
+            SynetConvolution16b* c = (SynetConvolution16b*)init(1, &pool.conv, compatibility);
+            if (c == NULL)
+                return NULL;
+            return new SynetConvolution16bPooled(param, pool, c, toBf16);
+        }
+    }
+#endif
+}
@@ -36,6 +36,19 @@ namespace Simd
             if (!param.Valid(SimdTensorData32f))
                 return NULL;
 #if !defined(SIMD_BASE_ONLY_GEMM_NN)
+            if (GetTuningMode())
+            {
+                SynetConvolution32fTuned::Convs convs;
+                SynetConvolution32fTuned::Add<SynetConvolution32fDepthwiseDotProduct>(param, convs);
+                SynetConvolution32fTuned::Add<SynetConvolution32fWinograd>(param, convs);
+                SynetConvolution32fTuned::Add<SynetConvolution32fGemmNT>(param, convs);
+                SynetConvolution32fTuned::Add<SynetConvolution32fDirectNchw>(param, convs);
+                SynetConvolution32fTuned::Add<SynetConvolution32fNhwcDirect>(param, convs);
+                SynetConvolution32fTuned::Add<SynetConvolution32fNhwcDepthwise>(param, convs);
+                SynetConvolution32fTuned::Add<SynetConvolution32fNhwcGroupedBlock1x2>(param, convs);
+                convs.push_back(new SynetConvolution32fGemmNN(param));
+                return SynetConvolution32fTuned::Create(param, convs);
+            }
             if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
                 return new SynetConvolution32fDepthwiseDotProduct(param);
             else if (SynetConvolution32fWinograd::Preferable(param))
@@ -94,6 +94,17 @@ namespace Simd
             return k < 2.0 && (p.IsKernel(2) || p.IsKernel(3)) && p.trans == 0;
         }
 
+        bool SynetConvolution32fDirectNchw::Applicable(const ConvParam & p)
+        {
+            if (!p.IsDilation(1) || p.trans)
+                return false;
+            if (p.IsStride(1))
+                return p.IsKernel(1) || p.IsKernel(2) || p.IsKernel(3);
+            if (p.IsStride(2))
+                return p.IsKernel(2) || p.IsKernel(3);
+            return p.IsStride(3) && p.IsKernel(3);
+        }
+
         void SynetConvolution32fDirectNchw::Pad(const float * src, float * dst) const
         {
             const ConvParam & p = _param;
@@ -331,6 +342,11 @@ namespace Simd
                 return false;
             return p.trans == 0;
         }
+
+        bool SynetConvolution32fDepthwiseDotProduct::Applicable(const ConvParam & p)
+        {
+            return Preferable(p);
+        }
     }
 #endif
 }
@@ -0,0 +1,125 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution32f.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        SynetConvolution32fDynamic::SynetConvolution32fDynamic(SynetConvolution32f* conv, SynetConvolution32fInitPtr init)
+            : SynetConvolution32f(conv->Param())
+            , _init(init)
+            , _conv(conv)
+            , _used(0)
+        {
+            _weight = NULL;
+            _bias = NULL;
+            _params = NULL;
+            _convs[Shape(_param.batch, _param.srcH, _param.srcW)] = Conv(_conv, _used);
+        }
+
+        SynetConvolution32fDynamic::~SynetConvolution32fDynamic()
+        {
+            for (Convs::iterator it = _convs.begin(); it != _convs.end(); ++it)
+                delete it->second.conv;
+        }
+
+        size_t SynetConvolution32fDynamic::ExternalBufferSize() const
+        {
+            return _conv->ExternalBufferSize();
+        }
+
+        size_t SynetConvolution32fDynamic::InternalBufferSize() const
+        {
+            size_t size = 0;
+            for (Convs::const_iterator it = _convs.begin(); it != _convs.end(); ++it)
+                size += it->second.conv->InternalBufferSize();
+            return size;
+        }
+
+        void SynetConvolution32fDynamic::SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params)
+        {
+            SynetConvolution32f::SetParams(weight, internal, bias, params);
+            for (Convs::iterator it = _convs.begin(); it != _convs.end(); ++it)
+                it->second.conv->SetParams(weight, NULL, bias, params);
+        }
+
+        void SynetConvolution32fDynamic::Forward(const float* src, float* buf, float* dst)
+        {
+            _conv->Forward(src, buf, dst);
+        }
+
+        bool SynetConvolution32fDynamic::Reshape(size_t batch, size_t srcH, size_t srcW)
+        {
+            Shape shape(batch, srcH, srcW);
+            Convs::iterator it = _convs.find(shape);
+            if (it == _convs.end())
+            {
+                ConvParam p = _param;
+                size_t kernelY = p.dilationY * (p.kernelY - 1) + 1, kernelX = p.dilationX * (p.kernelX - 1) + 1;
+                if (batch == 0 || srcH + p.padY + p.padH < kernelY || srcW + p.padX + p.padW < kernelX)
+                    return false;
+                p.batch = batch;
+                p.srcH = srcH;
+                p.srcW = srcW;
+                p.dstH = (srcH + p.padY + p.padH - kernelY) / p.strideY + 1;
+                p.dstW = (srcW + p.padX + p.padW - kernelX) / p.strideX + 1;
+                SynetConvolution32f* conv = (SynetConvolution32f*)_init(batch, &p);
+                if (conv == NULL)
+                    return false;
+                if (_weight)
+                    conv->SetParams(_weight, NULL, _bias, _params);
+                if (_convs.size() >= CAPACITY)
+                {
+                    Convs::iterator lru = _convs.end();
+                    for (Convs::iterator i = _convs.begin(); i != _convs.end(); ++i)
+                        if (i->second.conv != _conv && (lru == _convs.end() || i->second.used < lru->second.used))
+                            lru = i;
+                    delete lru->second.conv;
+                    _convs.erase(lru);
+                }
+                it = _convs.insert(Convs::value_type(shape, Conv(conv))).first;
+            }
+            it->second.used = ++_used;
+            _conv = it->second.conv;
+            _param = _conv->Param();
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+            _perf = NULL;
+#endif
+            return true;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetConvolution32fInitDynamic(size_t batch, const SimdConvolutionParameters* conv, SynetConvolution32fInitPtr init)
+        {
+            SynetConvolution32f* first = (SynetConvolution32f*)init(batch, conv);
+            if (first == NULL)
+                return NULL;
+            return new SynetConvolution32fDynamic(first, init);
+        }
+    }
+#endif
+}
@@ -362,6 +362,7 @@ namespace Simd
                     if (_batch%merge == 0 && _M*merge*_K*sizeof(float) <= Base::AlgCacheL2())
                         _merge = merge;
             }
+            _nhwcCompatible = NHWC_GEMM_COMPATIBLE || _threadNumber > 1;
             _gemm.Init(InitGemmFuncs(Base::Gemm32fNN, "Base"));
             _biasAndActivation = Base::ConvolutionBiasAndActivation;
         }
@@ -382,7 +383,7 @@ namespace Simd
                 if (_gemmCb.Size())
                     _gemmCb.At(0).ReorderB(_M*_merge, _N, _K, weight, _nhwcWeight.data);
                 else
-                    _nhwcReorderB(_M*_merge, _N, _K, weight, _nhwcWeight.data, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
+                    _nhwcReorderB(_M*_merge, _N, _K, weight, _nhwcWeight.data, GemmKernelAny, _nhwcCompatible);
                 if (internal)
                     *internal = SimdTrue;
             }
@@ -404,17 +405,22 @@ namespace Simd
                             ImgToRow(src + m * _sizeS, buf + m * _sizeB);
                         tmp = buf;
                     }
-                    if (_nhwcWeight.data)
+                    if (_threadNumber > 1 && GemmReady())
+                        GemmRows(tmp, _M * _merge, dst);
+                    else
                     {
-                        if (_gemmCb.Size())
-                            _gemmCb.Run(GemmCbArgs(_M*_merge, _N, _K, tmp, _nhwcWeight.data, dst));
+                        if (_nhwcWeight.data)
+                        {
+                            if (_gemmCb.Size())
+                                _gemmCb.Run(GemmCbArgs(_M * _merge, _N, _K, tmp, _nhwcWeight.data, dst));
+                            else
+                                _nhwcRun(_M * _merge, _N, _K, tmp, _nhwcWeight.data, dst, GemmKernelAny, _nhwcCompatible);
+                        }
                         else
-                            _nhwcRun(_M*_merge, _N, _K, tmp, _nhwcWeight.data, dst, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
+                            _gemm.Run(GemmArgs(_M * _merge, _N, _K, &_1, tmp, _ldS, _weight, _ldW, &_0, dst, _ldD));
+                        for (size_t m = 0; m < _merge; ++m)
+                            _biasAndActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, p.trans, dst + m * _sizeD);
                     }
-                    else
-                        _gemm.Run(GemmArgs(_M*_merge, _N, _K, &_1, tmp, _ldS, _weight, _ldW, &_0, dst, _ldD));
-                    for (size_t m = 0; m < _merge; ++m)
-                        _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst + m * _sizeD);
                     src += _sizeS * _merge;
                     dst += _sizeD * _merge;
                 }
@@ -432,6 +438,13 @@ namespace Simd
                             ImgToCol(src, buf);
                         tmp = buf;
                     }
+                    if (p.trans && p.group == 1 && _threadNumber > 1 && GemmReady())
+                    {
+                        GemmRows(tmp, _M, dst);
+                        src += _sizeS;
+                        dst += _sizeD;
+                        continue;
+                    }
                     for (size_t g = 0; g < p.group; ++g)
                     {
                         if (p.trans)
@@ -441,7 +454,7 @@ namespace Simd
                                 if (_gemmCb.Size())
                                     _gemmCb.Run(GemmCbArgs(_M, _N, _K, tmp, _nhwcWeight.data, dst));
                                 else
-                                    _nhwcRun(_M, _N, _K, tmp, _nhwcWeight.data, dst, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
+                                    _nhwcRun(_M, _N, _K, tmp, _nhwcWeight.data, dst, GemmKernelAny, _nhwcCompatible);
                             }
                             else
                                 _gemm.Run(GemmArgs(_M, _N, _K, &_1, tmp + _grS * g, _ldS, _weight + _grW * g, _ldW, &_0, dst + _grD * g, _ldD));
@@ -456,6 +469,26 @@ namespace Simd
             }
         }
 
+        void SynetConvolution32fGemmNN::GemmRows(const float * src, size_t M, float * dst)
+        {
+            const ConvParam & p = _param;
+            Simd::Parallel(0, M, [&](size_t thread, size_t begin, size_t end)
+            {
+                const float * A = src + begin * _ldS;
+                float * C = dst + begin * _ldD;
+                if (_nhwcWeight.data)
+                {
+                    if (_gemmCb.Size())
+                        _gemmCb.Run(GemmCbArgs(end - begin, _N, _K, A, _nhwcWeight.data, C));
+                    else
+                        _nhwcRun(end - begin, _N, _K, A, _nhwcWeight.data, C, GemmKernelAny, _nhwcCompatible);
+                }
+                else
+                    _gemm.Run(GemmArgs(end - begin, _N, _K, &_1, A, _ldS, _weight, _ldW, &_0, C, _ldD));
+                _biasAndActivation(_bias, p.dstC, end - begin, p.activation, _params, p.trans, C);
+            }, _threadNumber, 12);
+        }
+
         void SynetConvolution32fGemmNN::ImgToCol(const float * src, float * dst)
         {
             const ConvParam & p = _param;
@@ -649,6 +682,16 @@ namespace Simd
                 return p.srcH < 6 && p.srcW < 6;
         }
 
+        bool SynetConvolution32fGemmNT::Applicable(const ConvParam & p)
+        {
+            if (p.group != 1)
+                return false;
+            if (p.trans)
+                return p.Is1x1() && p.dstC == 1;
+            else
+                return !p.IsKernel(1) || p.IsPad(0);
+        }
+
         void SynetConvolution32fGemmNT::ImgToRow(const float * src, const ConvParam & p, float * dst)
         {
             const size_t K = p.kernelX * p.kernelY*p.srcC, N = p.dstH * p.dstW;
@@ -814,7 +857,8 @@ namespace Simd
         
         size_t SynetConvolution32fWinograd::ExternalBufferSize() const
         {
-            return (_strideS + _strideD)*_count*_merge;
+            size_t threads = _split > 1 ? Simd::Min(_threadNumber, _split) : 1;
+            return (_strideS + _strideD)*_count*_merge*threads;
         }
 
         size_t SynetConvolution32fWinograd::InternalBufferSize() const
@@ -906,6 +950,21 @@ namespace Simd
             return false;
         }
 
+        bool SynetConvolution32fWinograd::Applicable(const ConvParam & p)
+        {
+            if (!p.IsDilation(1) || !p.IsStride(1) || p.group != 1)
+                return false;
+            if (p.IsKernel(1, 3))
+                return (p.IsPad(0) || (p.padX == 1 && p.padW == 1)) && p.trans && p.srcW >= 8;
+            else if (p.IsKernel(1, 5))
+                return (p.IsPad(0) || (p.padX == 2 && p.padW == 2)) && p.trans && p.srcW >= 8;
+            else if (p.IsKernel(2))
+                return (p.IsPad(0) || (p.padY + p.padH == 1 && p.padX + p.padW == 1)) && p.trans && p.srcH >= 4 && p.srcW >= 4;
+            else if (p.IsKernel(3))
+                return (p.IsPad(0) || p.IsPad(1)) && (p.trans ? p.srcH >= 4 && p.srcW >= 4 : p.srcH >= 6 && p.srcW >= 6);
+            return false;
+        }
+
         void SynetConvolution32fWinograd::SetBlock(size_t blockY, size_t blockX)
         {
             const ConvParam & p = _param;
@@ -961,22 +1020,16 @@ namespace Simd
         void SynetConvolution32fWinograd::ForwardMerged(const float * src, float * bufS, float * bufD, float * dst)
         {
             const ConvParam & p = _param;
+            size_t threads = _threadNumber > 1 && GemmReady() ? _threadNumber : 1;
             for (size_t b = 0; b < _batch; b += _merge)
             {
                 for (size_t m = 0; m < _merge; ++m)
                     _setInput(src + m * _sizeS, p.srcC, p.srcH, p.srcW, p.padY, p.padX, p.padH, p.padW, bufS + m * _strideS, _strideS * _merge, p.trans);
-                for (size_t i = 0; i < _count; ++i)
+                Simd::Parallel(0, _count, [&](size_t thread, size_t begin, size_t end)
                 {
-                    if (_nhwcWeight.data)
-                    {
-                        if (_gemmCb.Size())
-                            _gemmCb.Run(GemmCbArgs(_M * _merge, _N, _K, bufS + i * _strideS * _merge, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD * _merge));
-                        else
-                            _nhwcRun(_M * _merge, _N, _K, bufS + i * _strideS * _merge, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD * _merge, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
-                    }
-                    else
-                        _gemm.Run(GemmArgs(_M * _merge, _N, _K, &_1, bufS + i * _strideS * _merge, _K, _winogradWeight.data + i * _strideW, _N, &_0, bufD + i * _strideD * _merge, _N));
-                }
+                    for (size_t i = begin; i < end; ++i)
+                        Gemm(i, _M * _merge, bufS + i * _strideS * _merge, bufD + i * _strideD * _merge);
+                }, threads);
                 for (size_t m = 0; m < _merge; ++m)
                 {
                     _setOutput(bufD + m * _strideD, _strideD * _merge, dst + m * _sizeD, p.dstC, p.dstH, p.dstW, p.trans);
@@ -989,38 +1042,49 @@ namespace Simd
 
         void SynetConvolution32fWinograd::ForwardSplitted(const float* src, float* bufS, float* bufD, float* dst)
         {
-            const ConvParam& p = _param;
+            size_t threads = _threadNumber > 1 && GemmReady() ? Simd::Min(_threadNumber, _split) : 1;
+            size_t size = (_strideS + _strideD) * _count;
             for (size_t b = 0; b < _batch; ++b)
             {
-                for (size_t s = 0; s < _split; ++s)
+                Simd::Parallel(0, _split, [&](size_t thread, size_t begin, size_t end)
                 {
-                    size_t padY = s ? 0 : p.padY;
-                    size_t padH = s == _split - 1 ? p.padH : 0;
-                    size_t srcY = s * _tileHs * _blockY + padY - p.padY;
-                    size_t srcH = Simd::Min(_tileHs * _blockY + p.kernelY - 1 - padY - padH, p.srcH - srcY);
-                    size_t M = _tileW * Simd::Min(_tileHs, _tileH - s * _tileHs);
-                    size_t dstY = s * _tileHs * _blockY;
-                    size_t dstH = Simd::Min(_tileHs * _blockY, p.dstH - dstY);
-                    _setInput(src + srcY * p.srcC * p.srcW, p.srcC, srcH, p.srcW, padY, p.padX, padH, p.padW, bufS, _strideS, p.trans);
-                    for (size_t i = 0; i < _count; ++i)
-                    {
-                        if (_nhwcWeight.data)
-                        {
-                            if (_gemmCb.Size())
-                                _gemmCb.Run(GemmCbArgs(M, _N, _K, bufS + i * _strideS, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD));
-                            else
-                                _nhwcRun(M, _N, _K, bufS + i * _strideS, _nhwcWeight.data + i * _nhwcStrideW, bufD + i * _strideD, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
-                        }
-                        else
-                            _gemm.Run(GemmArgs(M, _N, _K, &_1, bufS + i * _strideS, _K, _winogradWeight.data + i * _strideW, _N, &_0, bufD + i * _strideD, _N));
-                    }
-                    _setOutput(bufD, _strideD, dst + dstY * p.dstC * p.dstW, p.dstC, dstH, p.dstW, p.trans);
-                    _biasAndActivation(_bias, p.dstC, dstH * p.dstW, p.activation, _params, p.trans, dst + dstY * p.dstC * p.dstW);
-                }
+                    for (size_t s = begin; s < end; ++s)
+                        ForwardSplit(src, s, bufS + thread * size, bufD + thread * size, dst);
+                }, threads);
                 src += _sizeS;
                 dst += _sizeD;
             }
         }
+
+        void SynetConvolution32fWinograd::ForwardSplit(const float* src, size_t s, float* bufS, float* bufD, float* dst)
+        {
+            const ConvParam& p = _param;
+            size_t padY = s ? 0 : p.padY;
+            size_t padH = s == _split - 1 ? p.padH : 0;
+            size_t srcY = s * _tileHs * _blockY + padY - p.padY;
+            size_t srcH = Simd::Min(_tileHs * _blockY + p.kernelY - 1 - padY - padH, p.srcH - srcY);
+            size_t M = _tileW * Simd::Min(_tileHs, _tileH - s * _tileHs);
+            size_t dstY = s * _tileHs * _blockY;
+            size_t dstH = Simd::Min(_tileHs * _blockY, p.dstH - dstY);
+            _setInput(src + srcY * p.srcC * p.srcW, p.srcC, srcH, p.srcW, padY, p.padX, padH, p.padW, bufS, _strideS, p.trans);
+            for (size_t i = 0; i < _count; ++i)
+                Gemm(i, M, bufS + i * _strideS, bufD + i * _strideD);
+            _setOutput(bufD, _strideD, dst + dstY * p.dstC * p.dstW, p.dstC, dstH, p.dstW, p.trans);
+            _biasAndActivation(_bias, p.dstC, dstH * p.dstW, p.activation, _params, p.trans, dst + dstY * p.dstC * p.dstW);
+        }
+
+        void SynetConvolution32fWinograd::Gemm(size_t i, size_t M, const float* bufS, float* bufD)
+        {
+            if (_nhwcWeight.data)
+            {
+                if (_gemmCb.Size())
+                    _gemmCb.Run(GemmCbArgs(M, _N, _K, bufS, _nhwcWeight.data + i * _nhwcStrideW, bufD));
+                else
+                    _nhwcRun(M, _N, _K, bufS, _nhwcWeight.data + i * _nhwcStrideW, bufD, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
+            }
+            else
+                _gemm.Run(GemmArgs(M, _N, _K, &_1, bufS, _K, _winogradWeight.data + i * _strideW, _N, &_0, bufD, _N));
+        }
     }
 #endif
 }
@@ -26,6 +26,7 @@
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -142,13 +143,21 @@ namespace Simd
                 if(_old.enable)
                     _old.convolution(src, _param, _old.alg, _weight, _bias, _params, dst);
                 else
-                _run.Run(RunArgs(src, _param, _weight, _bias, _params, dst));
+                _run.Run(RunArgs(src, _param, _weight, _bias, _params, dst, _threadNumber));
                 src += _sizeS;
                 dst += _sizeD;
             }
         }
 
-        void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst)
+        void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst, size_t threads)
+        {
+            Simd::Parallel(0, p.dstH, [&](size_t thread, size_t yBeg, size_t yEnd)
+            {
+                Forward(src, p, a, yBeg, yEnd, weight, bias, params, dst);
+            }, threads);
+        }
+
+        void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam& p, const AlgParam& a, size_t yBeg, size_t yEnd, const float* weight, const float* bias, const float* params, float* dst)
         {
             for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
             {
@@ -156,14 +165,14 @@ namespace Simd
                 for (size_t sc = 0; sc < p.srcC; sc += a.macroC)
                 {
                     size_t macroC = Simd::Min(p.srcC, sc + a.macroC) - sc;
-                    for (size_t yBeg = 0; yBeg < p.dstH;)
+                    for (size_t yB = yBeg; yB < yEnd;)
                     {
-                        size_t yEnd = Simd::Min(yBeg + a.macroH, p.dstH);
+                        size_t yE = Simd::Min(yB + a.macroH, yEnd);
                         if (sc + macroC == p.srcC)
-                            a.convolutions[TermLast](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, macroC == p.srcC ? 1 : 0);
+                            a.convolutions[TermLast](src + sc, p, a, macroD, yB, yE, macroC, weight, bias + dc, params, dst + dc, macroC == p.srcC ? 1 : 0);
                         else
-                            a.convolutions[TermInterim](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, sc == 0 ? 1 : 0);
-                        yBeg = yEnd;
+                            a.convolutions[TermInterim](src + sc, p, a, macroD, yB, yE, macroC, weight, bias + dc, params, dst + dc, sc == 0 ? 1 : 0);
+                        yB = yE;
                     }
                     weight += a.F * macroC;
                 }
@@ -284,6 +293,11 @@ namespace Simd
         {
             return false;
         }
+
+        bool SynetConvolution32fNhwcDirect::Applicable(const ConvParam & p)
+        {
+            return false;
+        }
     }
 #endif
 }
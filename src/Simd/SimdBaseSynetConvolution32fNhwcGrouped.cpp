@@ -26,6 +26,7 @@
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -101,12 +102,11 @@ namespace Simd
 
         void SynetConvolution32fNhwcGroupedBlock1x2::Forward(const float* src, float* buf, float* dst)
         {
-            for (size_t b = 0; b < _batch; ++b)
+            Simd::Parallel(0, _batch, [&](size_t thread, size_t begin, size_t end)
             {
-                _convolution(src, _param, _weight, _bias, _params, dst);
-                src += _sizeS;
-                dst += _sizeD;
-            }
+                for (size_t b = begin; b < end; ++b)
+                    _convolution(src + b * _sizeS, _param, _weight, _bias, _params, dst + b * _sizeD);
+            }, _threadNumber);
         }
 
         bool SynetConvolution32fNhwcGroupedBlock1x2::Preferable(const ConvParam& p)
@@ -115,6 +115,11 @@ namespace Simd
                 return false;
             return p.group == p.srcC && p.dstC == 2 * p.srcC;
         }
+
+        bool SynetConvolution32fNhwcGroupedBlock1x2::Applicable(const ConvParam& p)
+        {
+            return Preferable(p);
+        }
     }
 #endif
 }
@@ -0,0 +1,118 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdCpu.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        SynetConvolution32fPooled::SynetConvolution32fPooled(const ConvParam& p, const ConvPoolParam& pool, SynetConvolution32f* conv)
+            : SynetConvolution32f(p)
+            , _pool(pool)
+            , _conv(conv)
+        {
+            const size_t F = SIMD_ALIGN / sizeof(float);
+            _sizeB = AlignHi(_pool.bandH * p.dstW * p.dstC, F);
+            _sizeS = _pool.stage ? AlignHi(p.srcC * _pool.conv.srcH * p.srcW, F) : 0;
+            _sizeP = p.trans || _pool.bands.size() == 1 ? 0 : AlignHi(_pool.bandH / _pool.kernelY * _pool.dstW * p.dstC, F);
+        }
+
+        SynetConvolution32fPooled::~SynetConvolution32fPooled()
+        {
+            delete _conv;
+        }
+
+        size_t SynetConvolution32fPooled::ExternalBufferSize() const
+        {
+            return _sizeB + _sizeS + _sizeP + _conv->ExternalBufferSize();
+        }
+
+        size_t SynetConvolution32fPooled::InternalBufferSize() const
+        {
+            return _buffer.size + _conv->InternalBufferSize();
+        }
+
+        void SynetConvolution32fPooled::SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params)
+        {
+            SynetConvolution32f::SetParams(weight, internal, bias, params);
+            SimdBool one = SimdFalse;
+            _conv->SetParams(weight, &one, bias, params);
+            if (internal)
+                *internal = one;
+        }
+
+        void SynetConvolution32fPooled::Forward(const float* src, float* buf, float* dst)
+        {
+            const ConvParam& p = _param;
+            buf = Buffer(buf);
+            float* band = buf, * stage = band + _sizeB, * pool = stage + _sizeS, * convBuf = pool + _sizeP;
+            size_t sizeS = p.srcC * p.srcH * p.srcW, sizeD = p.dstC * _pool.dstH * _pool.dstW;
+            for (size_t b = 0; b < p.batch; ++b)
+            {
+                for (size_t i = 0; i < _pool.bands.size(); ++i)
+                {
+                    const ConvPoolParam::Band& bnd = _pool.bands[i];
+                    const float* ps = stage;
+                    if (bnd.stage)
+                        _pool.Stage((uint8_t*)src, p, sizeof(float), bnd.srcY, (uint8_t*)stage);
+                    else
+                        ps = src + bnd.srcY * p.srcW * p.srcC;
+                    _conv->Forward(ps, convBuf, band);
+                    size_t dY = bnd.dstY / _pool.kernelY, dH = DivHi(bnd.dstH, _pool.kernelY);
+                    if (p.trans)
+                        _pool.Pool(band, p, bnd, dst + dY * _pool.dstW * p.dstC);
+                    else if (dH == _pool.dstH)
+                        _pool.Pool(band, p, bnd, dst);
+                    else
+                    {
+                        _pool.Pool(band, p, bnd, pool);
+                        for (size_t c = 0; c < p.dstC; ++c)
+                            memcpy(dst + (c * _pool.dstH + dY) * _pool.dstW, pool + c * dH * _pool.dstW, dH * _pool.dstW * sizeof(float));
+                    }
+                }
+                src += sizeS;
+                dst += sizeD;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetConvolution32fInitPooled(size_t batch, const SimdConvolutionParameters* conv, SimdSynetPoolingMethodType method, size_t kernelY, size_t kernelX,
+            SynetConvolution32fInitPtr init, SynetPoolingMax32fPtr poolingMax, SynetPoolingAverage32fPtr poolingAverage)
+        {
+            ConvParam param(batch, conv);
+            ConvPoolParam pool(param, method, kernelY, kernelX, poolingMax, poolingAverage);
+            if (!param.Valid(SimdTensorData32f) || !pool.Valid(param))
+                return NULL;
+            pool.SetBands(param, Base::AlgCacheL2() / 2);
+            SynetConvolution32f* c = (SynetConvolution32f*)init(1, &pool.conv);
+            if (c == NULL)
+                return NULL;
+            return new SynetConvolution32fPooled(param, pool, c);
+        }
+    }
+#endif
+}
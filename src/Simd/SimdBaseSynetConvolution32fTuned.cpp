@@ -0,0 +1,127 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution32f.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        SynetConvolution32fTuned::SynetConvolution32fTuned(const ConvParam& p, const Convs& convs)
+            : SynetConvolution32f(p)
+            , _convs(convs)
+            , _best(NULL)
+        {
+            assert(_convs.size() > 1);
+            _ext = _convs[0]->Ext();
+            RunFuncs funcs;
+            for (size_t i = 0; i < _convs.size(); ++i)
+                funcs.push_back(RunFunc(_convs[i]));
+            _run.Init(funcs);
+        }
+
+        SynetConvolution32fTuned::~SynetConvolution32fTuned()
+        {
+            for (size_t i = 0; i < _convs.size(); ++i)
+                if (_convs[i])
+                    delete _convs[i];
+        }
+
+        String SynetConvolution32fTuned::Desc() const
+        {
+            if (_best)
+                return _best->Desc();
+            std::stringstream ss;
+            ss << Ext() << "::Tuned {";
+            for (size_t i = 0; i < _convs.size(); ++i)
+                ss << (i ? ", " : "") << _convs[i]->Desc();
+            ss << "}";
+            return ss.str();
+        }
+
+        size_t SynetConvolution32fTuned::ExternalBufferSize() const
+        {
+            if (_best)
+                return _best->ExternalBufferSize();
+            size_t size = 1;
+            for (size_t i = 0; i < _convs.size(); ++i)
+                size = Max(size, _convs[i]->ExternalBufferSize());
+            return size;
+        }
+
+        size_t SynetConvolution32fTuned::InternalBufferSize() const
+        {
+            size_t size = _buffer.size;
+            for (size_t i = 0; i < _convs.size(); ++i)
+                if (_convs[i])
+                    size += _convs[i]->InternalBufferSize();
+            return size;
+        }
+
+        void SynetConvolution32fTuned::SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params)
+        {
+            SynetConvolution32f::SetParams(weight, internal, bias, params);
+            bool all = true;
+            for (size_t i = 0; i < _convs.size(); ++i)
+            {
+                if (_convs[i])
+                {
+                    SimdBool copied = SimdFalse;
+                    _convs[i]->SetParams(weight, &copied, bias, params);
+                    all = all && copied == SimdTrue;
+                }
+            }
+            if (internal)
+                *internal = all ? SimdTrue : SimdFalse;
+        }
+
+        void SynetConvolution32fTuned::Forward(const float* src, float* buf, float* dst)
+        {
+            buf = Buffer(buf);
+            _run.Run(RunArgs(src, buf, dst, _param));
+            if (_best == NULL && _run.Ready())
+            {
+                _best = _run.Selected()->Conv();
+                for (size_t i = 0; i < _convs.size(); ++i)
+                {
+                    if (_convs[i] != _best)
+                    {
+                        delete _convs[i];
+                        _convs[i] = NULL;
+                    }
+                }
+                _buffer.Resize(0);
+            }
+        }
+
+        void* SynetConvolution32fTuned::Create(const ConvParam& p, const Convs& convs)
+        {
+            assert(convs.size());
+            if (convs.size() == 1)
+                return convs[0];
+            return new SynetConvolution32fTuned(p, convs);
+        }
+    }
+#endif
+}
@@ -23,11 +23,13 @@
 */
 #include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetConvolution8iCommon.h"
+#include "Simd/SimdSynetWeightBlob.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdLog.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -74,6 +76,7 @@ namespace Simd
         _sizeS = p.srcC * p.srcH * p.srcW;
         _sizeD = p.dstC * p.dstH * p.dstW;
         _merge = 1;
+        _threadNumber = p.batch > 1 && p.Flop() >= SYNET_CONVOLUTION_8I_THREAD_FLOP_MIN ? Simd::Min(Base::GetThreadNumber(), p.batch) : 1;
         _src8u = p.srcT == SimdTensorData8u;
         _dst8u = p.dstT == SimdTensorData8u;
         _weight.Resize(p.kernelY * p.kernelX * p.srcC / p.group * p.dstC);
@@ -83,6 +86,11 @@ namespace Simd
     }
 
     size_t SynetConvolution8i::ExternalBufferSize() const
+    {
+        return AlignHi(ThreadBufferSize(), SIMD_ALIGN) * _threadNumber;
+    }
+
+    size_t SynetConvolution8i::ThreadBufferSize() const
     {
         size_t size = SIMD_ALIGN;
         if (!_src8u)
@@ -99,6 +107,7 @@ namespace Simd
     void SynetConvolution8i::SetParams(const float* weight, const float* bias, const float* params, const float* const* stats)
     {
         const ConvParam& p = _param;
+        _weight.Resize(p.kernelY * p.kernelX * p.srcC / p.group * p.dstC);
         _srcCvt.Init(stats[0], stats[1], p.srcC, p.compatibility);
         _dstCvt.Init(stats[2], stats[3], p.dstC, p.compatibility);
         size_t G = p.group, D = p.dstC / G, C = p.srcC / G, K = p.kernelY * p.kernelX, CK = C * K, GD = G * D;
@@ -239,6 +248,69 @@ namespace Simd
         }
     }
 
+    bool SynetConvolution8i::Share(const SynetConvolution8i& other)
+    {
+        if (&other == this)
+            return true;
+        if (other._params.Empty() || !_param.Equal(other._param) || Desc() != other.Desc() || ExternalBufferSize() != other.ExternalBufferSize())
+            return false;
+        _srcCvt.Assign(other._srcCvt);
+        _dstCvt.Assign(other._dstCvt);
+        _weight.Share(other._weight);
+        _norm.Assign(other._norm.data, other._norm.size);
+        _bias.Assign(other._bias.data, other._bias.size);
+        _params.Assign(other._params.data, other._params.size);
+        return true;
+    }
+
+    SIMD_INLINE void WriteCvtParam(SynetWeightBlobWriter& writer, const CvtParam& cvt)
+    {
+        int32_t values[5] = { cvt.neg ? 1 : 0, cvt.iMin, cvt.iMax, cvt.uMin, cvt.uMax };
+        writer.Write(cvt.zero);
+        writer.Write(cvt.scale);
+        writer.Write(cvt.shift);
+        writer.Write(cvt.iScale);
+        writer.Write(cvt.iShift);
+        writer.Write(values, 5);
+    }
+
+    SIMD_INLINE bool ReadCvtParam(SynetWeightBlobReader& reader, CvtParam& cvt)
+    {
+        size_t size;
+        if (!(reader.Read(cvt.zero) && reader.Read(cvt.scale) && reader.Read(cvt.shift) && reader.Read(cvt.iScale) && reader.Read(cvt.iShift)))
+            return false;
+        const int32_t* values = reader.Read<int32_t>(size);
+        if (values == NULL || size != 5)
+            return false;
+        cvt.neg = values[0] != 0;
+        cvt.iMin = values[1];
+        cvt.iMax = values[2];
+        cvt.uMin = values[3];
+        cvt.uMax = values[4];
+        return true;
+    }
+
+    size_t SynetConvolution8i::Export(uint8_t* blob, size_t size) const
+    {
+        if (_params.Empty())
+            return 0;
+        SynetWeightBlobWriter writer(blob, size, _param, Desc());
+        writer.Write(_weight);
+        writer.Write(_norm);
+        writer.Write(_bias);
+        writer.Write(_params);
+        WriteCvtParam(writer, _srcCvt);
+        WriteCvtParam(writer, _dstCvt);
+        return writer.Finish();
+    }
+
+    bool SynetConvolution8i::Import(const uint8_t* blob, size_t size)
+    {
+        SynetWeightBlobReader reader(blob, size, _param, Desc());
+        return reader.Ok() && reader.Read(_weight) && reader.Read(_norm) && reader.Read(_bias) && reader.Read(_params) &&
+            ReadCvtParam(reader, _srcCvt) && ReadCvtParam(reader, _dstCvt);
+    }
+
     void SynetConvolution8i::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
     {
         if (buf == NULL)
@@ -247,13 +319,18 @@ namespace Simd
             buf = _buffer.data;
         }
         const ConvParam& p = _param;
-        uint8_t* src8u = _src8u ? NULL : Allocate<uint8_t>(buf, _sizeS * _merge);
-        for (size_t b = 0; b < p.batch; b += _merge)
+        size_t bufSize = AlignHi(ThreadBufferSize(), SIMD_ALIGN);
+        Simd::Parallel(0, p.batch, [&](size_t thread, size_t begin, size_t end)
         {
-            if (!_src8u)
-                _convertSrc((float*)src + b * _sizeS, _merge, p.srcC, p.srcH, p.srcW, p.srcF, _srcCvt.scale.data, _srcCvt.shift.data, src8u, p.compatibility);
-            Forward8u(_src8u ? src + b * _sizeS : src8u, buf, dst + b * _sizeD * (_dst8u ? sizeof(uint8_t) : sizeof(float)));
-        }
+            uint8_t* bufT = buf + thread * bufSize;
+            uint8_t* src8u = _src8u ? NULL : Allocate<uint8_t>(bufT, _sizeS * _merge);
+            for (size_t b = begin; b < end; b += _merge)
+            {
+                if (!_src8u)
+                    _convertSrc((float*)src + b * _sizeS, _merge, p.srcC, p.srcH, p.srcW, p.srcF, _srcCvt.scale.data, _srcCvt.shift.data, src8u, p.compatibility);
+                Forward8u(_src8u ? src + b * _sizeS : src8u, bufT, dst + b * _sizeD * (_dst8u ? sizeof(uint8_t) : sizeof(float)));
+            }
+        }, _threadNumber);
     }
 
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
@@ -303,9 +380,9 @@ namespace Simd
             _siS = p.dstH * p.dstW;
         }
 
-        size_t SynetConvolution8iGemmNN::ExternalBufferSize() const
+        size_t SynetConvolution8iGemmNN::ThreadBufferSize() const
         {
-            size_t size = SynetConvolution8i::ExternalBufferSize();
+            size_t size = SynetConvolution8i::ThreadBufferSize();
             if(!_skipConv)
                 size += AlignHi(_sizeB * _merge * sizeof(uint8_t), SIMD_ALIGN);
             size += AlignHi(_sizeD * _merge * sizeof(int32_t), SIMD_ALIGN);
@@ -413,10 +490,10 @@ namespace Simd
             return size;
         }
 
-        size_t SynetConvolution8iNhwcDirect::ExternalBufferSize() const
+        size_t SynetConvolution8iNhwcDirect::ThreadBufferSize() const
         {
             const ConvParam& p = _param;
-            size_t size = SynetConvolution8i::ExternalBufferSize();
+            size_t size = SynetConvolution8i::ThreadBufferSize();
             size += AlignHi(_sizeP * sizeof(uint8_t), SIMD_ALIGN);
             size += AlignHi(_sizeB * sizeof(int32_t), SIMD_ALIGN);
             return size;
@@ -430,6 +507,24 @@ namespace Simd
             _alg.upper = Set4(_dstCvt.uMax);
         }
 
+        bool SynetConvolution8iNhwcDirect::Share(const SynetConvolution8i& other)
+        {
+            if (!SynetConvolution8i::Share(other))
+                return false;
+            _alg.zero = Set4(_srcCvt.zero[0]);
+            _alg.upper = Set4(_dstCvt.uMax);
+            return true;
+        }
+
+        bool SynetConvolution8iNhwcDirect::Import(const uint8_t* blob, size_t size)
+        {
+            if (!SynetConvolution8i::Import(blob, size))
+                return false;
+            _alg.zero = Set4(_srcCvt.zero[0]);
+            _alg.upper = Set4(_dstCvt.uMax);
+            return true;
+        }
+
         bool SynetConvolution8iNhwcDirect::Preferable(const ConvParam& p)
         {
             return false;
@@ -619,6 +714,26 @@ namespace Simd
             _alg.size = (_param.dstT == SimdTensorData32f ? 4 : 1);
         }
 
+        bool SynetConvolution8iNhwcDepthwise::Share(const SynetConvolution8i& other)
+        {
+            if (!SynetConvolution8i::Share(other))
+                return false;
+            _alg.zero = _srcCvt.zero[0];
+            _alg.upper = Set4(_dstCvt.uMax);
+            _alg.size = (_param.dstT == SimdTensorData32f ? 4 : 1);
+            return true;
+        }
+
+        bool SynetConvolution8iNhwcDepthwise::Import(const uint8_t* blob, size_t size)
+        {
+            if (!SynetConvolution8i::Import(blob, size))
+                return false;
+            _alg.zero = _srcCvt.zero[0];
+            _alg.upper = Set4(_dstCvt.uMax);
+            _alg.size = (_param.dstT == SimdTensorData32f ? 4 : 1);
+            return true;
+        }
+
         bool SynetConvolution8iNhwcDepthwise::Preferable(const ConvParam& p)
         {
             return false;
@@ -29,6 +29,7 @@
 #include "Simd/SimdBFloat16.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -364,11 +365,16 @@ namespace Simd
                 default: assert(0);
                 }
             }
+            int64_t flop = 0;
+            for (size_t i = 0; i < p.count; ++i)
+                flop += p.conv[i].Flop();
+            _threadNumber = p.conv[0].batch > 1 && flop >= SYNET_MERGED_CONVOLUTION_THREAD_FLOP_MIN ? Simd::Min(Base::GetThreadNumber(), p.conv[0].batch) : 1;
         }
 
         size_t SynetMergedConvolution16b::ExternalBufferSize() const
         {
-            return (_sizeB[0] + _sizeB[2]) * 2 + (_sizeB[1] + _sizeB[3] + _sizeB[4]) * 4 + SIMD_ALIGN * 3;
+            size_t size = (_sizeB[0] + _sizeB[2]) * 2 + (_sizeB[1] + _sizeB[3] + _sizeB[4]) * 4 + SIMD_ALIGN * 3;
+            return AlignHi(size, SIMD_ALIGN) * _threadNumber;
         }
 
         size_t SynetMergedConvolution16b::InternalBufferSize() const
@@ -580,7 +586,17 @@ namespace Simd
 
         void SynetMergedConvolution16b::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
         {
+            const MergConvParam& p = _param;
             buf = Buffer(buf);
+            size_t bufSize = ExternalBufferSize() / _threadNumber;
+            Simd::Parallel(0, p.conv[0].batch, [&](size_t thread, size_t begin, size_t end)
+            {
+                ForwardBatch(src + begin * _sizeS * _alg.elem[0], buf + thread * bufSize, dst + begin * _sizeD * _alg.elem[1], end - begin);
+            }, _threadNumber);
+        }
+
+        void SynetMergedConvolution16b::ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch)
+        {
             uint16_t* buf0 = Allocate<uint16_t>(buf, _sizeB[0]);
             float* buf1 = Allocate<float>(buf, _sizeB[1]);
             uint16_t* buf2 = Allocate<uint16_t>(buf, _sizeB[2]);
@@ -590,7 +606,7 @@ namespace Simd
             const ConvParam& c1 = p.conv[1];
             const ConvParam& c2 = p.conv[2];
             const AlgParam& a = _alg;
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t b = 0; b < batch; ++b)
             {
                 if (_dw0)
                 {
@@ -638,7 +654,7 @@ namespace Simd
         {
         }
 
-        void SynetMergedConvolution16bCdc::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        void SynetMergedConvolution16bCdc::ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch)
         {
             const MergConvParam& p = _param;
             const ConvParam& c0 = p.conv[0];
@@ -646,7 +662,6 @@ namespace Simd
             const ConvParam& c2 = p.conv[2];
             const AlgParam& a = _alg;
 
-            buf = Buffer(buf);
             uint16_t* buf0 = Allocate<uint16_t>(buf, _sizeB[0]);
             SetGap(buf);
             float* buf1 = Allocate<float>(buf, _sizeB[1]);
@@ -656,7 +671,7 @@ namespace Simd
             SetGap(buf);
             float* buf4 = Allocate<float>(buf, _sizeB[4]);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t b = 0; b < batch; ++b)
             {
                 for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
                 {
@@ -770,21 +785,20 @@ namespace Simd
         {
         }
 
-        void SynetMergedConvolution16bCd::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        void SynetMergedConvolution16bCd::ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch)
         {
             const MergConvParam& p = _param;
             const ConvParam& c0 = p.conv[0];
             const ConvParam& c1 = p.conv[1];
             const AlgParam& a = _alg;
 
-            buf = Buffer(buf);
             uint16_t* buf0 = Allocate<uint16_t>(buf, _sizeB[0]);
             SetGap(buf);
             float* buf1 = Allocate<float>(buf, _sizeB[1]);
             SetGap(buf);
             float* buf4 = Allocate<float>(buf, _sizeB[4]);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t b = 0; b < batch; ++b)
             {
                 for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
                 {
@@ -878,20 +892,19 @@ namespace Simd
         {
         }
 
-        void SynetMergedConvolution16bDc::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        void SynetMergedConvolution16bDc::ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch)
         {
             const MergConvParam& p = _param;
             const ConvParam& c0 = p.conv[0];
             const ConvParam& c1 = p.conv[1];
             const AlgParam& a = _alg;
 
-            buf = Buffer(buf);
             uint16_t* buf2 = Allocate<uint16_t>(buf, _sizeB[2]);
             float* buf3 = Allocate<float>(buf, _sizeB[3]);
             SetGap(buf);
             float* buf4 = Allocate<float>(buf, _sizeB[4]);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t b = 0; b < batch; ++b)
             {
                 for (size_t c = 0, C = c0.dstC; c < C; c += a.maC)
                 {
@@ -27,6 +27,7 @@
 #include "Simd/SimdUpdate.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -142,11 +143,15 @@ namespace Simd
                 default: assert(0);
                 }
             }
+            int64_t flop = 0;
+            for (size_t i = 0; i < p.count; ++i)
+                flop += p.conv[i].Flop();
+            _threadNumber = p.conv[0].batch > 1 && flop >= SYNET_MERGED_CONVOLUTION_THREAD_FLOP_MIN ? Simd::Min(Base::GetThreadNumber(), p.conv[0].batch) : 1;
         }
 
         size_t SynetMergedConvolution32f::ExternalBufferSize() const
         {
-            return _sizeB[0] + _sizeB[1];
+            return AlignHi(_sizeB[0] + _sizeB[1], SIMD_ALIGN / sizeof(float)) * _threadNumber;
         }
 
         size_t SynetMergedConvolution32f::InternalBufferSize() const
@@ -245,9 +250,20 @@ namespace Simd
         void SynetMergedConvolution32f::Forward(const float* src, float* buf, float* dst)
         {
             const MergConvParam& p = _param;
-            float* buf0 = Buffer(buf);
+            buf = Buffer(buf);
+            size_t bufSize = ExternalBufferSize() / _threadNumber;
+            Simd::Parallel(0, p.conv[0].batch, [&](size_t thread, size_t begin, size_t end)
+            {
+                ForwardBatch(src + begin * _sizeS, buf + thread * bufSize, dst + begin * _sizeD, end - begin);
+            }, _threadNumber);
+        }
+
+        void SynetMergedConvolution32f::ForwardBatch(const float* src, float* buf, float* dst, size_t batch)
+        {
+            const MergConvParam& p = _param;
+            float* buf0 = buf;
             float* buf1 = buf0 + _sizeB[0];
-            for (size_t b = 0; b < p.conv[0].batch; ++b)
+            for (size_t b = 0; b < batch; ++b)
             {
                 _convolution[0](src, p.conv[0], 0, 0, p.conv[0].dstH, NULL, _weight[0], _bias[0], _params[0], buf0, 1);
                 _convolution[1](buf0, p.conv[1], 0, 0, p.conv[1].dstH, NULL, _weight[1], _bias[1], _params[1], (p.count == 3 ? buf1 : dst), 1);
@@ -370,17 +386,17 @@ namespace Simd
             }
         }
 
-        void SynetMergedConvolution32fCdc::Forward(const float * src, float * buf, float * dst)
+        void SynetMergedConvolution32fCdc::ForwardBatch(const float* src, float* buf, float* dst, size_t batch)
         {
             if (_rWeight[0].data == NULL)
             {
-                SynetMergedConvolution32f::Forward(src, buf, dst);
+                SynetMergedConvolution32f::ForwardBatch(src, buf, dst, batch);
                 return;
             }
-            const MergConvParam & p = _param;
-            float * buf0 = Buffer(buf);
+            const MergConvParam& p = _param;
+            float* buf0 = buf;
             float * buf1 = buf0 + _sizeB[0];
-            for (size_t b = 0; b < p.conv[0].batch; ++b)
+            for (size_t b = 0; b < batch; ++b)
             {
                 for (size_t c = 0, C = p.conv[1].dstC; c < C; c += _maC)
                 {
@@ -497,16 +513,16 @@ namespace Simd
             }
         }
 
-        void SynetMergedConvolution32fCd::Forward(const float* src, float* buf, float* dst)
+        void SynetMergedConvolution32fCd::ForwardBatch(const float* src, float* buf, float* dst, size_t batch)
         {
             if (_rWeight[0].data == NULL)
             {
-                SynetMergedConvolution32f::Forward(src, buf, dst);
+                SynetMergedConvolution32f::ForwardBatch(src, buf, dst, batch);
                 return;
             }
             const MergConvParam& p = _param;
-            float* buf0 = Buffer(buf);
-            for (size_t b = 0; b < p.conv[0].batch; ++b)
+            float* buf0 = buf;
+            for (size_t b = 0; b < batch; ++b)
             {
                 for (size_t c = 0, C = p.conv[1].dstC; c < C; c += _maC)
                 {
@@ -618,16 +634,16 @@ namespace Simd
             }
         }
 
-        void SynetMergedConvolution32fDc::Forward(const float* src, float* buf, float* dst)
+        void SynetMergedConvolution32fDc::ForwardBatch(const float* src, float* buf, float* dst, size_t batch)
         {
             if (_rWeight[0].data == NULL)
             {
-                SynetMergedConvolution32f::Forward(src, buf, dst);
+                SynetMergedConvolution32f::ForwardBatch(src, buf, dst, batch);
                 return;
             }
             const MergConvParam& p = _param;
-            float* buf0 = Buffer(buf);
-            for (size_t b = 0; b < p.conv[0].batch; ++b)
+            float* buf0 = buf;
+            for (size_t b = 0; b < batch; ++b)
             {
                 for (size_t c = 0, C = p.conv[0].dstC; c < C; c += _maC)
                 {
@@ -29,6 +29,7 @@
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -121,11 +122,17 @@ namespace Simd
             }
             if (_d8u)
                 ExtendSize(_sizeD, _sizeB[1]);
+
+            int64_t flop = 0;
+            for (size_t i = 0; i < p.count; ++i)
+                flop += p.conv[i].Flop();
+            _threadNumber = p.conv[0].batch > 1 && flop >= SYNET_MERGED_CONVOLUTION_THREAD_FLOP_MIN ? Simd::Min(Base::GetThreadNumber(), p.conv[0].batch) : 1;
         }
 
         size_t SynetMergedConvolution8i::ExternalBufferSize() const
         {
-            return (_sizeB[0] + _sizeB[1] + _sizeB[4]) * 4 + _sizeB[2] + _sizeB[3] + SIMD_ALIGN;
+            size_t size = (_sizeB[0] + _sizeB[1] + _sizeB[4]) * 4 + _sizeB[2] + _sizeB[3] + SIMD_ALIGN;
+            return AlignHi(size, SIMD_ALIGN) * _threadNumber;
         }
 
         size_t SynetMergedConvolution8i::InternalBufferSize() const
@@ -225,13 +232,23 @@ namespace Simd
         }
 
         void SynetMergedConvolution8i::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        {
+            const MergConvParam8i& p = _param;
+            buf = GetBuffer(buf);
+            size_t bufSize = ExternalBufferSize() / _threadNumber;
+            Simd::Parallel(0, p.conv[0].batch, [&](size_t thread, size_t begin, size_t end)
+            {
+                ForwardBatch(src + begin * _sizeS * (_s8u ? 1 : 4), buf + thread * bufSize, dst + begin * _sizeD * (_d8u ? 1 : 4), end - begin);
+            }, _threadNumber);
+        }
+
+        void SynetMergedConvolution8i::ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch)
         {
             const MergConvParam8i& p = _param;
             const ConvParam& c0 = p.conv[0];
             const ConvParam& c1 = p.conv[1];
             const ConvParam& c2 = p.conv[2];
 
-            buf = GetBuffer(buf);
             float* buf0 = Allocate<float>(buf, _sizeB[0]);
             float* buf1 = Allocate<float>(buf, _sizeB[1]);
             uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
@@ -243,7 +260,7 @@ namespace Simd
             float* dst32f = _d8u ? buf1 : (float*)dst;
             uint8_t* dst8u = _d8u ? dst : NULL;
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t b = 0; b < batch; ++b)
             {
                 if (_dw0)
                 {
@@ -497,7 +514,7 @@ namespace Simd
         {
         }
 
-        void SynetMergedConvolution8iCdc::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        void SynetMergedConvolution8iCdc::ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch)
         {
             const MergConvParam8i& p = _param;
             const ConvParam& c0 = p.conv[0];
@@ -505,13 +522,12 @@ namespace Simd
             const ConvParam& c2 = p.conv[2];
             const AlgParam& a = _alg;
 
-            buf = GetBuffer(buf);
             float* buf0 = Allocate<float>(buf, _sizeB[0]);
             uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
             uint8_t* buf3 = Allocate<uint8_t>(buf, _sizeB[3]);
             int32_t* buf4 = Allocate<int32_t>(buf, _sizeB[4]);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t b = 0; b < batch; ++b)
             {
                 for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
                 {
@@ -602,18 +618,17 @@ namespace Simd
         {
         }
 
-        void SynetMergedConvolution8iCd::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        void SynetMergedConvolution8iCd::ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch)
         {
             const MergConvParam8i& p = _param;
             const ConvParam& c0 = p.conv[0];
             const ConvParam& c1 = p.conv[1];
             const AlgParam& a = _alg;
 
-            buf = GetBuffer(buf);
             float* buf0 = Allocate<float>(buf, _sizeB[0]);
             uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t b = 0; b < batch; ++b)
             {
                 for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
                 {
@@ -697,19 +712,18 @@ namespace Simd
         {
         }
 
-        void SynetMergedConvolution8iDc::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        void SynetMergedConvolution8iDc::ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch)
         {
             const MergConvParam8i& p = _param;
             const ConvParam& c0 = p.conv[0];
             const ConvParam& c1 = p.conv[1];
             const AlgParam& a = _alg;
 
-            buf = GetBuffer(buf);
             float* buf0 = Allocate<float>(buf, _sizeB[0]);
             uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
             int32_t* buf4 = Allocate<int32_t>(buf, _sizeB[4]);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t b = 0; b < batch; ++b)
             {
                 for (size_t c = 0, C = c0.dstC; c < C; c += a.maC)
                 {
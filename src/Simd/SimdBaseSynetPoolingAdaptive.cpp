@@ -0,0 +1,122 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdBFloat16.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        template<class T> struct PoolingAdaptive
+        {
+            typedef float Acc;
+            static SIMD_INLINE Acc Min() { return -FLT_MAX; }
+            static SIMD_INLINE Acc Load(T value) { return value; }
+            static SIMD_INLINE T Max(Acc max) { return max; }
+            static SIMD_INLINE T Average(Acc sum, size_t size) { return sum / float(size); }
+        };
+
+        template<> struct PoolingAdaptive<uint16_t>
+        {
+            typedef float Acc;
+            static SIMD_INLINE Acc Min() { return -FLT_MAX; }
+            static SIMD_INLINE Acc Load(uint16_t value) { return BFloat16ToFloat32(value); }
+            static SIMD_INLINE uint16_t Max(Acc max) { return Float32ToBFloat16(max); }
+            static SIMD_INLINE uint16_t Average(Acc sum, size_t size) { return Float32ToBFloat16(sum / float(size)); }
+        };
+
+        template<> struct PoolingAdaptive<uint8_t>
+        {
+            typedef uint32_t Acc;
+            static SIMD_INLINE Acc Min() { return 0; }
+            static SIMD_INLINE Acc Load(uint8_t value) { return value; }
+            static SIMD_INLINE uint8_t Max(Acc max) { return (uint8_t)max; }
+            static SIMD_INLINE uint8_t Average(Acc sum, size_t size) { return (uint8_t)((sum + uint32_t(size / 2)) / uint32_t(size)); }
+        };
+
+        template<class T, SimdSynetPoolingMethodType method> void SynetPoolingAdaptive(const T* src, size_t srcC, size_t srcH, size_t srcW,
+            T* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+        {
+            typedef PoolingAdaptive<T> PA;
+            typedef typename PA::Acc Acc;
+            bool nhwc = format == SimdTensorFormatNhwc;
+            size_t sC = nhwc ? 1 : srcH * srcW, sY = nhwc ? srcW * srcC : srcW, sX = nhwc ? srcC : 1;
+            size_t dC = nhwc ? 1 : dstH * dstW, dY = nhwc ? dstW * srcC : dstW, dX = nhwc ? srcC : 1;
+            for (size_t c = 0; c < srcC; ++c)
+            {
+                for (size_t dy = 0; dy < dstH; ++dy)
+                {
+                    size_t yBeg = AdaptivePoolingBeg(dy, srcH, dstH), yEnd = AdaptivePoolingEnd(dy, srcH, dstH);
+                    for (size_t dx = 0; dx < dstW; ++dx)
+                    {
+                        size_t xBeg = AdaptivePoolingBeg(dx, srcW, dstW), xEnd = AdaptivePoolingEnd(dx, srcW, dstW);
+                        Acc acc = method == SimdSynetPoolingMethodMax ? PA::Min() : Acc(0);
+                        for (size_t sy = yBeg; sy < yEnd; ++sy)
+                        {
+                            const T* ps = src + c * sC + sy * sY;
+                            for (size_t sx = xBeg; sx < xEnd; ++sx)
+                            {
+                                if (method == SimdSynetPoolingMethodMax)
+                                    acc = Simd::Max(acc, PA::Load(ps[sx * sX]));
+                                else
+                                    acc += PA::Load(ps[sx * sX]);
+                            }
+                        }
+                        T* pd = dst + c * dC + dy * dY + dx * dX;
+                        if (method == SimdSynetPoolingMethodMax)
+                            *pd = PA::Max(acc);
+                        else
+                            *pd = PA::Average(acc, (yEnd - yBeg) * (xEnd - xBeg));
+                    }
+                }
+            }
+        }
+
+        template<class T> void SynetPoolingAdaptive(const T* src, size_t srcC, size_t srcH, size_t srcW,
+            SimdSynetPoolingMethodType method, T* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+        {
+            if (method == SimdSynetPoolingMethodMax)
+                SynetPoolingAdaptive<T, SimdSynetPoolingMethodMax>(src, srcC, srcH, srcW, dst, dstH, dstW, format);
+            else if (method == SimdSynetPoolingMethodAverage)
+                SynetPoolingAdaptive<T, SimdSynetPoolingMethodAverage>(src, srcC, srcH, srcW, dst, dstH, dstW, format);
+            else
+                assert(0);
+        }
+
+        void SynetPoolingAdaptive(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, SimdTensorDataType type,
+            SimdSynetPoolingMethodType method, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+        {
+            switch (type)
+            {
+            case SimdTensorData32f: SynetPoolingAdaptive((float*)src, srcC, srcH, srcW, method, (float*)dst, dstH, dstW, format); break;
+            case SimdTensorData16b: SynetPoolingAdaptive((uint16_t*)src, srcC, srcH, srcW, method, (uint16_t*)dst, dstH, dstW, format); break;
+            case SimdTensorData8u: SynetPoolingAdaptive((uint8_t*)src, srcC, srcH, srcW, method, (uint8_t*)dst, dstH, dstW, format); break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif
+}
@@ -48,6 +48,7 @@ namespace Simd
         _sizeS = p.srcC * p.srcH * p.srcW;
         _sizeD = p.dstC * p.dstH * p.dstW;
         _merge = 1;
+        _threadNumber = p.Flop() < SYNET_QUANTIZED_CONVOLUTION_THREAD_FLOP_MIN ? 1 : Base::GetThreadNumber();
     }
 
     size_t SynetQuantizedConvolution::ExternalBufferSize() const
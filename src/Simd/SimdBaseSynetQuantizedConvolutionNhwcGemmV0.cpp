@@ -29,6 +29,7 @@
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdLog.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -70,13 +71,15 @@ namespace Simd
             a.macroK = Simd::RestrictRange(AlignLo(L1 / a.microD, a.microK), a.microK, a.bufK);
             a.batch = 1;
             size_t bufSize = a.M * a.bufK;
-            if (bufSize * 2 <= L2 && p.batch > 1)
+            if (bufSize * 2 <= L2 && p.batch > 1 && _threadNumber == 1)
             {
                 for (size_t batch = 1; batch <= p.batch; ++batch)
                     if (p.batch % batch == 0 && batch * bufSize <= L2 && (a.bufK > 512 || microK == 4 || batch * a.M <= 32 * microM))
                         a.batch = batch;
             }
             a.macroH = Simd::RestrictRange(L2 / a.macroK / p.dstW, size_t(1), p.dstH * a.batch);
+            if (_threadNumber > 1)
+                a.macroH = Simd::Min(a.macroH, DivHi(p.dstH, _threadNumber));
             a.macroD = Simd::RestrictRange(AlignLoAny(L3 / a.macroK, a.microD), a.microD, a.bufD);
             a.bufM = a.batch * p.dstH * AlignHi(p.dstW, a.F);
             a.elem = _elemD;
@@ -94,10 +97,10 @@ namespace Simd
             const AlgParam& a = _alg;
             size_t size = 0;
             if (_convert)
-                size += a.bufM * a.bufK * sizeof(uint8_t);
+                size += AlignHi(a.bufM * a.bufK * sizeof(uint8_t), SIMD_ALIGN);
             if (a.sumBuf)
-                size += a.macroD * a.bufM * sizeof(int32_t);
-            return size;
+                size += AlignHi(a.macroD * a.bufM * sizeof(int32_t), SIMD_ALIGN);
+            return size * _threadNumber;
         }
 
         void SynetQuantizedConvolutionNhwcGemmV0::SetWeight(const int8_t* weight)
@@ -132,19 +135,22 @@ namespace Simd
             const ConvParam& p = _param;
             const AlgParam& a = _alg;
             buf8 = Buffer(buf8);
-            uint8_t* bufB = _convert ? Allocate<uint8_t>(buf8, a.bufM * a.bufK) : NULL;
-            int32_t* bufS = a.sumBuf ? Allocate<int32_t>(buf8, a.macroD * a.bufM) : NULL;
+            size_t bufSize = ExternalBufferSize() / _threadNumber;
             for (size_t b = 0; b < p.batch; b += a.batch)
             {
-                uint8_t* buf = _convert ? bufB : (uint8_t*)src;
-                int32_t* sum = a.sumBuf ? bufS : (int32_t*)dst;
-                Forward(src, buf, sum, dst);
+                Simd::Parallel(0, p.dstH * a.batch, [&](size_t thread, size_t yBeg, size_t yEnd)
+                {
+                    uint8_t* buf = buf8 + thread * bufSize;
+                    uint8_t* bufB = _convert ? Allocate<uint8_t>(buf, a.bufM * a.bufK) : (uint8_t*)src;
+                    int32_t* bufS = a.sumBuf ? Allocate<int32_t>(buf, a.macroD * a.bufM) : (int32_t*)dst;
+                    Forward(src, bufB, bufS, dst, yBeg, yEnd);
+                }, _threadNumber);
                 src += _sizeS * a.batch * _elemS;
                 dst += _sizeD * a.batch * _elemD;
             }
         }
 
-        void SynetQuantizedConvolutionNhwcGemmV0::Forward(const uint8_t* src, uint8_t* buf, int32_t* sum, uint8_t* dst)
+        void SynetQuantizedConvolutionNhwcGemmV0::Forward(const uint8_t* src, uint8_t* buf, int32_t* sum, uint8_t* dst, size_t begin, size_t end)
         {
             const ConvParam& p = _param;
             const AlgParam& a = _alg;
@@ -152,7 +158,6 @@ namespace Simd
             const float* sNorm = _norm.data;
             const float* params = _params.data;
             float dNorm = 1.0f / _dstScale;
-            size_t dstH = p.dstH * a.batch;
             for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
             {
                 size_t macroD = Simd::Min(p.dstC, dc + a.macroD) - dc;
@@ -160,9 +165,9 @@ namespace Simd
                 for (size_t mak = 0; mak < a.K; mak += a.macroK)
                 {
                     size_t macroK = Simd::Min(a.bufK, mak + a.macroK) - mak;
-                    for (size_t yBeg = 0; yBeg < dstH;)
+                    for (size_t yBeg = begin; yBeg < end;)
                     {
-                        size_t yEnd = Simd::Min(yBeg + a.macroH, dstH);
+                        size_t yEnd = Simd::Min(yBeg + a.macroH, end);
                         size_t bufOffs = (a.macroK < a.bufK || _convert == NULL) ?
                             yBeg * (_convert ? AlignHi(p.dstW, a.F) : p.dstW) * a.bufK + (a.reorderType ? mak * a.F : mak) : 0;
                         size_t sumOffs = a.macroK < a.bufK ? yBeg * (a.microK > 4 ? AlignHi(p.dstW, a.F) : p.dstW) * a.dB : 0;
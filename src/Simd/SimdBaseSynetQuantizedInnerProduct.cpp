@@ -119,7 +119,7 @@ namespace Simd
         const float* psb = _bScale.data;
         float* pn = _norm.data;
         for (size_t j = 0; j < p.N; ++j)
-            pn[j] = _aScale * psb[j] / _cScale;
+            pn[j] = _c8u ? _aScale * psb[j] / _cScale : _aScale * psb[j];
     }
 
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
@@ -174,7 +174,12 @@ namespace Simd
             if (_c8u)
                 QuantizeSumLinear(bufC, 1, p.N, 1, p.M, SimdTensorFormatNhwc, _bias.data, _norm.data, _cZero[0], C);
             else
-                assert(0);
+            {
+                float* dst = (float*)C;
+                for (size_t i = 0; i < p.M; ++i, bufC += p.N, dst += p.N)
+                    for (size_t j = 0; j < p.N; ++j)
+                        dst[j] = float(bufC[j] + _bias[j]) * _norm[j];
+            }
         }
 
         void SynetQuantizedInnerProductRef::Gemm(const uint8_t* A, const int8_t* B, int32_t* C)
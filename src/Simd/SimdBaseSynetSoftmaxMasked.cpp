@@ -0,0 +1,81 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdArray.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetAdd16bCommon.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        template<class T> void SynetSoftmaxMasked(const T* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, T* dst)
+        {
+            Array32f buf(count);
+            for (size_t o = 0; o < outer; ++o)
+            {
+                const float* m = mask ? mask + (o % maskOuter) * count : NULL;
+                float max = -FLT_MAX, sum = 0.0f;
+                for (size_t c = 0; c < count; ++c)
+                {
+                    buf[c] = Convert16b<T, float>(src[c]) + (m ? m[c] : 0.0f);
+                    max = Simd::Max(max, buf[c]);
+                }
+                if (log)
+                {
+                    for (size_t c = 0; c < count; ++c)
+                        sum += ::exp(buf[c] - max);
+                    float shift = ::log(sum);
+                    for (size_t c = 0; c < count; ++c)
+                        dst[c] = Convert16b<float, T>(buf[c] - max - shift);
+                }
+                else
+                {
+                    for (size_t c = 0; c < count; ++c)
+                    {
+                        buf[c] = ::exp(buf[c] - max);
+                        sum += buf[c];
+                    }
+                    float k = 1.0f / sum;
+                    for (size_t c = 0; c < count; ++c)
+                        dst[c] = Convert16b<float, T>(buf[c] * k);
+                }
+                src += count;
+                dst += count;
+            }
+        }
+
+        void SynetSoftmaxMasked32f(const float* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, float* dst)
+        {
+            SynetSoftmaxMasked(src, outer, count, mask, maskOuter, log, dst);
+        }
+
+        void SynetSoftmaxMasked16b(const uint16_t* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, uint16_t* dst)
+        {
+            SynetSoftmaxMasked(src, outer, count, mask, maskOuter, log, dst);
+        }
+    }
+#endif
+}
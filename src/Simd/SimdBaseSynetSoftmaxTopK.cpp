@@ -0,0 +1,67 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetAdd16bCommon.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        template<class T> void SynetSoftmaxTopK(const T* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value)
+        {
+            for (size_t o = 0; o < outer; ++o)
+            {
+                size_t c = 0;
+                for (; c < k; ++c)
+                    SynetSoftmaxTopKInsert(Convert16b<T, float>(src[c]), (uint32_t)c, c + 1, value, index);
+                for (; c < count; ++c)
+                {
+                    float val = Convert16b<T, float>(src[c]);
+                    if (val > value[k - 1])
+                        SynetSoftmaxTopKInsert(val, (uint32_t)c, k, value, index);
+                }
+                float max = value[0], sum = 0.0f;
+                for (c = 0; c < count; ++c)
+                    sum += ::exp(Convert16b<T, float>(src[c]) - max);
+                SynetSoftmaxTopKFinalize(sum, k, log, value);
+                src += count;
+                index += k;
+                value += k;
+            }
+        }
+
+        void SynetSoftmaxTopK32f(const float* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value)
+        {
+            SynetSoftmaxTopK(src, outer, count, k, log, index, value);
+        }
+
+        void SynetSoftmaxTopK16b(const uint16_t* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value)
+        {
+            SynetSoftmaxTopK(src, outer, count, k, log, index, value);
+        }
+    }
+#endif
+}
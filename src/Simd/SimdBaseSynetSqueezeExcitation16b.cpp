@@ -0,0 +1,160 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetSqueezeExcitation16b.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+
+    SynetSqueezeExcitation16b::SynetSqueezeExcitation16b(const SqueezeExcitation16bParam& p)
+        : _param(p)
+    {
+
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        static void ChannelSum32f(const uint8_t* src8, size_t channels, size_t spatial, float* sum)
+        {
+            const float* src = (const float*)src8;
+            for (size_t c = 0; c < channels; ++c)
+                sum[c] = 0.0f;
+            for (size_t s = 0; s < spatial; ++s)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                    sum[c] += src[c];
+                src += channels;
+            }
+        }
+
+        static void ChannelSum16b(const uint8_t* src, size_t channels, size_t spatial, float* sum)
+        {
+            SynetChannelSum16b((const uint16_t*)src, channels, spatial, SimdTensorFormatNhwc, sum);
+        }
+
+        static void Excitation(const float* sum, const SqueezeExcitation16bParam& p, const float* weight0, const float* bias0,
+            const float* params, const float* weight1, const float* bias1, float* hidden, float* scale)
+        {
+            size_t channels = p.channels, squeeze = p.squeeze;
+            float norm = 1.0f / float(p.spatial);
+            for (size_t j = 0; j < squeeze; ++j, weight0 += channels)
+            {
+                float dot = 0.0f;
+                for (size_t c = 0; c < channels; ++c)
+                    dot += sum[c] * weight0[c];
+                hidden[j] = dot * norm;
+            }
+            ConvolutionBiasAndActivation(bias0, squeeze, 1, p.activation, params, SimdTrue, hidden);
+            for (size_t c = 0; c < channels; ++c)
+                scale[c] = bias1[c];
+            for (size_t j = 0; j < squeeze; ++j, weight1 += channels)
+            {
+                float h = hidden[j];
+                for (size_t c = 0; c < channels; ++c)
+                    scale[c] += h * weight1[c];
+            }
+            for (size_t c = 0; c < channels; ++c)
+                scale[c] = SynetSigmoid32f(scale[c], 1.0f);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetSqueezeExcitation16b::SynetSqueezeExcitation16b(const SqueezeExcitation16bParam& p, void* scale)
+            : Simd::SynetSqueezeExcitation16b(p)
+            , _scale((Simd::SynetScale16b*)scale)
+            , _channelSum(NULL)
+            , _excitation(NULL)
+        {
+            _srcE = p.channels * p.spatial * (p.sType == SimdTensorData32f ? 4 : 2);
+            _dstE = p.channels * p.spatial * (p.dType == SimdTensorData32f ? 4 : 2);
+            _channelSum = p.sType == SimdTensorData32f ? ChannelSum32f : ChannelSum16b;
+            _excitation = Excitation;
+        }
+
+        SynetSqueezeExcitation16b::~SynetSqueezeExcitation16b()
+        {
+            if (_scale)
+                delete _scale;
+        }
+
+        size_t SynetSqueezeExcitation16b::InternalBufferSize() const
+        {
+            return (_weight0.size + _bias0.size + _params.size + _weight1.size + _bias1.size + _buffer.size) * sizeof(float);
+        }
+
+        void SynetSqueezeExcitation16b::SetParams(const float* weight0, const float* bias0, const float* params, const float* weight1, const float* bias1)
+        {
+            const SqueezeExcitation16bParam& p = _param;
+            size_t C = p.channels, Q = p.squeeze;
+            _weight0.Assign(weight0, Q * C);
+            _bias0.Resize(Q, true);
+            if (bias0)
+                memcpy(_bias0.data, bias0, Q * sizeof(float));
+            _params.Resize(Simd::Max<size_t>(Q, 2), true);
+            if (params)
+                memcpy(_params.data, params, (p.activation == SimdConvolutionActivationPrelu ? Q : 2) * sizeof(float));
+            _weight1.Resize(Q * C);
+            for (size_t c = 0; c < C; ++c)
+                for (size_t q = 0; q < Q; ++q)
+                    _weight1[q * C + c] = weight1[c * Q + q];
+            _bias1.Resize(C, true);
+            if (bias1)
+                memcpy(_bias1.data, bias1, C * sizeof(float));
+            _buffer.Resize(AlignHi(C, SIMD_ALIGN / sizeof(float)) * 2 + Q);
+        }
+
+        void SynetSqueezeExcitation16b::Forward(const uint8_t* src, uint8_t* dst)
+        {
+            const SqueezeExcitation16bParam& p = _param;
+            size_t C = AlignHi(p.channels, SIMD_ALIGN / sizeof(float));
+            float* sum = _buffer.data;
+            float* scale = sum + C;
+            float* hidden = scale + C;
+            for (size_t b = 0; b < p.batch; ++b)
+            {
+                _channelSum(src, p.channels, p.spatial, sum);
+                _excitation(sum, p, _weight0.data, _bias0.data, _params.data, _weight1.data, _bias1.data, hidden, scale);
+                _scale->Forward(src, scale, NULL, dst);
+                src += _srcE;
+                dst += _dstE;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetSqueezeExcitation16bInit(size_t batch, size_t channels, size_t spatial, size_t squeeze, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdConvolutionActivationType activation)
+        {
+            SqueezeExcitation16bParam param(batch, channels, spatial, squeeze, srcType, dstType, activation);
+            if (!param.Valid())
+                return NULL;
+            return new SynetSqueezeExcitation16b(param, SynetScale16bInit(channels, spatial, srcType, dstType, SimdTensorFormatNhwc, SimdTrue, SimdFalse));
+        }
+    }
+#endif
+}
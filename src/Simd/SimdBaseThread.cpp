@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdMath.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 #include <thread>
 
@@ -40,6 +41,9 @@ namespace Simd
         void SetThreadNumber(size_t threadNumber)
         {
             g_threadNumber = Simd::RestrictRange<size_t>(threadNumber, 1, std::thread::hardware_concurrency());
+#ifndef SIMD_FUTURE_DISABLE
+            ThreadPool::Global().Shrink(g_threadNumber - 1);
+#endif
         }
     }
 }
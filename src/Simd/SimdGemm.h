@@ -510,6 +510,48 @@ namespace Simd
         GemmKernelF4,
     };
 
+    namespace Base
+    {
+        const size_t GEMM_BATCHED_ITEM_SIZE_MAX = 256 * 256 * 256 * 2;
+        const size_t GEMM_BATCHED_THREAD_SIZE_MIN = 128 * 128 * 128;
+
+        typedef void(*Gemm32fPtr)(size_t M, size_t N, size_t K, const float* alpha, const float* A, size_t lda, const float* B, size_t ldb, const float* beta, float* C, size_t ldc);
+
+        void Gemm32fBatched(Gemm32fPtr gemm, size_t batch, size_t M, size_t N, size_t K, const float* alpha,
+            const float* const* A, size_t lda, const float* const* B, size_t ldb, const float* beta, float* const* C, size_t ldc);
+
+        void Gemm32fStridedBatched(Gemm32fPtr gemm, size_t batch, size_t M, size_t N, size_t K, const float* alpha,
+            const float* A, size_t lda, size_t strideA, const float* B, size_t ldb, size_t strideB, const float* beta, float* C, size_t ldc, size_t strideC);
+
+        size_t Gemm32fNNcbBufferSize(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
+        void Gemm32fNNcbReorderB(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
+        void Gemm32fNNcbRun(size_t M, size_t N, size_t K, const float * A, const float * pB, float * C, GemmKernelType type, bool compatibility);
+
+        typedef size_t(*Gemm32fNNcbBufferSizePtr)(size_t M, size_t N, size_t K, GemmKernelType type, bool compatibility);
+        typedef void(*Gemm32fNNcbReorderBPtr)(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
+        typedef void(*Gemm32fNNcbRunPtr)(size_t M, size_t N, size_t K, const float * A, const float * pB, float * C, GemmKernelType type, bool compatibility);
+
+        const size_t GEMM_NNCB_THREAD_SIZE_MIN = 128 * 128 * 128;
+
+        class Gemm32fNNcbContext : public Deletable
+        {
+        public:
+            Gemm32fNNcbContext(size_t N, size_t K, const float* B, Gemm32fNNcbBufferSizePtr bufferSize, Gemm32fNNcbReorderBPtr reorderB, Gemm32fNNcbRunPtr run);
+
+            size_t InternalBufferSize() const
+            {
+                return _pB.RawSize();
+            }
+
+            void Run(size_t M, const float* A, float* C);
+
+        private:
+            size_t _N, _K;
+            Array32f _pB;
+            Gemm32fNNcbRunPtr _run;
+        };
+    }
+
 #ifdef SIMD_SSE41_ENABLE
     namespace Sse41
     {
@@ -0,0 +1,109 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdGemm16b_h__
+#define __SimdGemm16b_h__
+
+#include "Simd/SimdSynetInnerProduct16b.h"
+
+namespace Simd
+{
+    struct Gemm16bParam
+    {
+        size_t M, N, K;
+        SimdTensorDataType typeA, typeB, typeC;
+        SimdBool transB, constB;
+
+        Gemm16bParam(size_t m, size_t n, size_t k, SimdTensorDataType ta, SimdTensorDataType tb, SimdTensorDataType tc, SimdBool t, SimdBool c)
+            : M(m), N(n), K(k)
+            , typeA(ta), typeB(tb), typeC(tc)
+            , transB(t), constB(c)
+        {
+        }
+
+        static SIMD_INLINE bool Valid(SimdTensorDataType type)
+        {
+            return type == SimdTensorData32f || type == SimdTensorData16b || type == SimdTensorData16f;
+        }
+
+        bool Valid() const
+        {
+            return M && N && K && Valid(typeA) && Valid(typeB) && Valid(typeC);
+        }
+
+        String Info() const
+        {
+            std::stringstream ss;
+            ss << M << "x" << N << "x" << K << "-";
+            ss << ToChar(typeA) << ToChar(typeB) << ToChar(typeC) << "-";
+            ss << (transB ? "t" : "n") << (constB ? "1" : "2");
+            return ss.str();
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    typedef void (*Float16ToFloat32Ptr)(const uint16_t* src, size_t size, float* dst);
+    typedef void (*Float32ToFloat16Ptr)(const float* src, size_t size, uint16_t* dst);
+
+    class Gemm16b : public Deletable
+    {
+    public:
+        Gemm16b(const Gemm16bParam& p, SynetInnerProduct16b* gemm, Float16ToFloat32Ptr toF32, Float32ToFloat16Ptr toF16);
+        virtual ~Gemm16b();
+
+        const Gemm16bParam& Param() const
+        {
+            return _param;
+        }
+
+        size_t ExternalBufferSize() const;
+
+        void SetB(const uint8_t* B);
+        void Run(const uint8_t* A, const uint8_t* B, uint8_t* buf, uint8_t* C);
+
+        const char* Info() const
+        {
+            _info = _param.Info() + " " + _gemm->Info();
+            return _info.c_str();
+        }
+
+    protected:
+        Gemm16bParam _param;
+        SynetInnerProduct16b* _gemm;
+        Float16ToFloat32Ptr _toF32;
+        Float32ToFloat16Ptr _toF16;
+        size_t _sizeA, _sizeB, _sizeC;
+        Array8u _buffer;
+        mutable String _info;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        void* Gemm16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB,
+            SynetInnerProduct16bInitPtr init, Float16ToFloat32Ptr toF32, Float32ToFloat16Ptr toF16);
+    }
+}
+#endif
@@ -0,0 +1,102 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdGemm8u8i32i_h__
+#define __SimdGemm8u8i32i_h__
+
+#include "Simd/SimdSynetQuantizedInnerProduct.h"
+
+namespace Simd
+{
+    struct Gemm8u8i32iParam
+    {
+        size_t M, N, K;
+        SimdTensorDataType typeC;
+        SimdBool transB;
+
+        Gemm8u8i32iParam(size_t m, size_t n, size_t k, SimdTensorDataType tc, SimdBool t)
+            : M(m), N(n), K(k)
+            , typeC(tc)
+            , transB(t)
+        {
+        }
+
+        bool Valid() const
+        {
+            return M && N && K && (typeC == SimdTensorData32i || typeC == SimdTensorData32f);
+        }
+
+        String Info() const
+        {
+            std::stringstream ss;
+            ss << M << "x" << N << "x" << K << "-";
+            ss << ToChar(SimdTensorData8u) << ToChar(SimdTensorData8i) << ToChar(typeC) << "-";
+            ss << (transB ? "t" : "n");
+            return ss.str();
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    typedef void* (*SynetQuantizedInnerProductInitPtr)(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, 
+        SimdBool transB, SimdBool constB, SimdBool bias);
+
+    class Gemm8u8i32i : public Deletable
+    {
+    public:
+        Gemm8u8i32i(const Gemm8u8i32iParam& p, SynetQuantizedInnerProduct* gemm);
+        virtual ~Gemm8u8i32i();
+
+        const Gemm8u8i32iParam& Param() const
+        {
+            return _param;
+        }
+
+        size_t ExternalBufferSize() const;
+
+        void SetB(const int8_t* B, const int32_t* bZero, const float* bScale);
+        void Run(const uint8_t* A, uint8_t* buf, uint8_t* C);
+
+        const char* Info() const
+        {
+            _info = _param.Info() + " " + _gemm->Info();
+            return _info.c_str();
+        }
+
+    protected:
+        Gemm8u8i32iParam _param;
+        SynetQuantizedInnerProduct* _gemm;
+        bool _zero;
+        Array32i _bZero;
+        Array32f _bScale;
+        mutable String _info;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        void* Gemm8u8i32iInit(size_t M, size_t N, size_t K, SimdTensorDataType typeC, SimdBool transB, SynetQuantizedInnerProductInitPtr init);
+    }
+}
+#endif
@@ -63,18 +63,22 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdConst.h"
 #include "Simd/SimdLog.h"
 #include "Simd/SimdPerformance.h"
+#include "Simd/SimdRuntime.h"
 #include "Simd/SimdEmpty.h"
 #include "Simd/SimdTile.h"
 
 #include "Simd/SimdFont.h"
 #include "Simd/SimdDescrInt.h"
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdGemm.h"
+#include "Simd/SimdGemm16b.h"
 #include "Simd/SimdImageLoad.h"
 #include "Simd/SimdImageSave.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
 #include "Simd/SimdResizer.h"
 #include "Simd/SimdShiftDetector.h"
 #include "Simd/SimdSynetAdd16b.h"
+#include "Simd/SimdSynetAttention.h"
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynetConvolution16b.h"
 #include "Simd/SimdSynetConvolution8i.h"
@@ -94,6 +98,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdSynetQuantizedMergedConvolution.h"
 #include "Simd/SimdSynetScale8i.h"
 #include "Simd/SimdSynetScale16b.h"
+#include "Simd/SimdSynetSqueezeExcitation16b.h"
 #include "Simd/SimdWarpAffine.h"
 
 #include "Simd/SimdBase.h"
@@ -187,6 +192,31 @@ SIMD_API const char * SimdPerformanceStatistic()
 #endif
 }
 
+SIMD_API SimdBool SimdRuntimeCacheSave(const char * path)
+{
+    return Base::RuntimeCacheSave(path) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdRuntimeCacheLoad(const char * path)
+{
+    return Base::RuntimeCacheLoad(path) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API void SimdRuntimeCacheClear()
+{
+    Base::RuntimeCacheClear();
+}
+
+SIMD_API SimdBool SimdGetTuningMode()
+{
+    return Base::GetTuningMode() ? SimdTrue : SimdFalse;
+}
+
+SIMD_API void SimdSetTuningMode(SimdBool value)
+{
+    Base::SetTuningMode(value == SimdTrue);
+}
+
 SIMD_API void * SimdAllocate(size_t size, size_t align)
 {
     return Allocate(size, align);
@@ -2794,6 +2824,110 @@ SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, c
     simdGemm32fNT(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
+SIMD_API void SimdGemm32fNNBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * const * A, size_t lda,
+    const float * const * B, size_t ldb, const float * beta, float * const * C, size_t ldc)
+{
+    SIMD_EMPTY();
+    const static SimdGemm32fPtr simdGemm32fNN = SIMD_FUNC4(Gemm32fNN, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    Base::Gemm32fBatched(simdGemm32fNN, batch, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+SIMD_API void SimdGemm32fNNStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA,
+    const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC)
+{
+    SIMD_EMPTY();
+    const static SimdGemm32fPtr simdGemm32fNN = SIMD_FUNC4(Gemm32fNN, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    Base::Gemm32fStridedBatched(simdGemm32fNN, batch, M, N, K, alpha, A, lda, strideA, B, ldb, strideB, beta, C, ldc, strideC);
+}
+
+SIMD_API void SimdGemm32fNTStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA,
+    const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC)
+{
+    SIMD_EMPTY();
+    const static SimdGemm32fPtr simdGemm32fNT = SIMD_FUNC4(Gemm32fNT, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    Base::Gemm32fStridedBatched(simdGemm32fNT, batch, M, N, K, alpha, A, lda, strideA, B, ldb, strideB, beta, C, ldc, strideC);
+}
+
+SIMD_API void* SimdGemm32fNNcbInit(size_t N, size_t K, const float* B)
+{
+    SIMD_EMPTY();
+    const static Base::Gemm32fNNcbBufferSizePtr bufferSize = SIMD_FUNC4(Gemm32fNNcbBufferSize, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Base::Gemm32fNNcbReorderBPtr reorderB = SIMD_FUNC4(Gemm32fNNcbReorderB, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Base::Gemm32fNNcbRunPtr run = SIMD_FUNC4(Gemm32fNNcbRun, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return new Base::Gemm32fNNcbContext(N, K, B, bufferSize, reorderB, run);
+}
+
+SIMD_API size_t SimdGemm32fNNcbInternalBufferSize(const void* context)
+{
+    SIMD_EMPTY();
+    return ((Base::Gemm32fNNcbContext*)context)->InternalBufferSize();
+}
+
+SIMD_API void SimdGemm32fNNcbRun(void* context, size_t M, const float* A, float* C)
+{
+    SIMD_EMPTY();
+    ((Base::Gemm32fNNcbContext*)context)->Run(M, A, C);
+}
+
+SIMD_API void* SimdGemm16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    const static SynetInnerProduct16bInitPtr simdSynetInnerProduct16bInit = SIMD_FUNC4(SynetInnerProduct16bInit, SIMD_AMXBF16_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return Base::Gemm16bInit(M, N, K, typeA, typeB, typeC, transB, constB, simdSynetInnerProduct16bInit, SimdFloat16ToFloat32, SimdFloat32ToFloat16);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdGemm16bExternalBufferSize(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((Gemm16b*)context)->ExternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API const char* SimdGemm16bInfo(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((Gemm16b*)context)->Info();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdGemm16bSetB(void* context, const uint8_t* B)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((Gemm16b*)context)->SetB(B);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdGemm16bRun(void* context, const uint8_t* A, const uint8_t* B, uint8_t* buf, uint8_t* C)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((Gemm16b*)context)->Run(A, B, buf, C);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
 {
     SIMD_EMPTY();
@@ -5543,6 +5677,52 @@ SIMD_API void SimdSynetAdd8i(const uint8_t* aData, const float* aScale, const fl
 #endif
 }
 
+SIMD_API void* SimdSynetAttentionInit(size_t batch, size_t heads, size_t queries, size_t keys, size_t size, SimdTensorDataType srcType, SimdTensorDataType dstType, float scale)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetAttentionInitPtr) (size_t batch, size_t heads, size_t queries, size_t keys, size_t size, SimdTensorDataType srcType, SimdTensorDataType dstType, float scale);
+    const static SimdSynetAttentionInitPtr simdSynetAttentionInit = SIMD_FUNC2(SynetAttentionInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC);
+
+    return simdSynetAttentionInit(batch, heads, queries, keys, size, srcType, dstType, scale);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetAttentionExternalBufferSize(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetAttention*)context)->ExternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API const char* SimdSynetAttentionInfo(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetAttention*)context)->Info();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetAttentionForward(void* context, const uint8_t* q, const uint8_t* k, const uint8_t* v, uint8_t* buf, uint8_t* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetAttention*)context)->Forward(q, k, v, buf, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetChannelSum16b(const uint16_t* src, size_t channels, size_t spatial, SimdTensorFormatType format, float* sum)
 {
     SIMD_EMPTY();
@@ -5651,6 +5831,43 @@ SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src,
 #endif
 }
 
+SIMD_API void * SimdSynetConvolution32fInitDynamic(size_t batch, const SimdConvolutionParameters * conv)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    const static Base::SynetConvolution32fInitPtr simdSynetConvolution32fInit = SIMD_FUNC4(SynetConvolution32fInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return Base::SynetConvolution32fInitDynamic(batch, conv, simdSynetConvolution32fInit);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetConvolution32fReshape(void * context, size_t batch, size_t srcH, size_t srcW)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution32f*)context)->Reshape(batch, srcH, srcW) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
+SIMD_API void * SimdSynetConvolution32fInitPooled(size_t batch, const SimdConvolutionParameters * conv, SimdSynetPoolingMethodType method, size_t kernelY, size_t kernelX)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    const static Base::SynetConvolution32fInitPtr simdSynetConvolution32fInit = SIMD_FUNC4(SynetConvolution32fInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return Base::SynetConvolution32fInitPooled(batch, conv, method, kernelY, kernelX, simdSynetConvolution32fInit, SimdSynetPoolingMax32f, SimdSynetPoolingAverage);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
 SIMD_API void* SimdSynetConvolution16bInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
 {
     SIMD_EMPTY();
@@ -5708,6 +5925,39 @@ SIMD_API void SimdSynetConvolution16bSetParams(void* context, const float* weigh
 #endif
 }
 
+SIMD_API SimdBool SimdSynetConvolution16bShareParams(void* context, const void* source)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution16b*)context)->Share(*(const SynetConvolution16b*)source) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
+SIMD_API size_t SimdSynetConvolution16bExportParams(const void* context, uint8_t* blob, size_t size)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((const SynetConvolution16b*)context)->Export(blob, size);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetConvolution16bImportParams(void* context, const uint8_t* blob, size_t size)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution16b*)context)->Import(blob, size) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
 SIMD_API void SimdSynetConvolution16bForward(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst)
 {
     SIMD_EMPTY();
@@ -5720,6 +5970,45 @@ SIMD_API void SimdSynetConvolution16bForward(void* context, const uint8_t* src,
 #endif
 }
 
+SIMD_API void* SimdSynetConvolution16bInitDynamic(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    const static Base::SynetConvolution16bInitPtr simdSynetConvolution16bInit = SIMD_FUNC4(SynetConvolution16bInit, SIMD_AMXBF16_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return Base::SynetConvolution16bInitDynamic(batch, conv, compatibility, simdSynetConvolution16bInit);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetConvolution16bReshape(void* context, size_t batch, size_t srcH, size_t srcW)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution16b*)context)->Reshape(batch, srcH, srcW) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
+SIMD_API void* SimdSynetConvolution16bInitPooled(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility,
+    SimdSynetPoolingMethodType method, size_t kernelY, size_t kernelX)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    const static Base::SynetConvolution16bInitPtr simdSynetConvolution16bInit = SIMD_FUNC4(SynetConvolution16bInit, SIMD_AMXBF16_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return Base::SynetConvolution16bInitPooled(batch, conv, compatibility, method, kernelY, kernelX, simdSynetConvolution16bInit, 
+        SimdSynetPoolingMax32f, SimdSynetPoolingAverage, SimdFloat32ToBFloat16);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
 SIMD_API void* SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
 {
     SIMD_EMPTY();
@@ -5777,6 +6066,39 @@ SIMD_API void SimdSynetConvolution8iSetParams(void* context, const float* weight
 #endif
 }
 
+SIMD_API SimdBool SimdSynetConvolution8iShareParams(void* context, const void* source)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution8i*)context)->Share(*(const SynetConvolution8i*)source) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
+SIMD_API size_t SimdSynetConvolution8iExportParams(const void* context, uint8_t* blob, size_t size)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((const SynetConvolution8i*)context)->Export(blob, size);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetConvolution8iImportParams(void* context, const uint8_t* blob, size_t size)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution8i*)context)->Import(blob, size) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
 SIMD_API void SimdSynetConvolution8iForward(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst)
 {
     SIMD_EMPTY();
@@ -6548,6 +6870,66 @@ SIMD_API void SimdSynetNormalizeLayerForward16bV2(const uint16_t* src, size_t ba
 #endif
 }
 
+SIMD_API void SimdSynetLayerNorm32f(const float* src, const float* add, size_t count, size_t size,
+    const float* scale, const float* shift, const float* eps, float* sum, float* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetLayerNorm32fPtr) (const float* src, const float* add, size_t count, size_t size,
+        const float* scale, const float* shift, const float* eps, float* sum, float* dst);
+    const static SimdSynetLayerNorm32fPtr simdSynetLayerNorm32f = SIMD_FUNC3(SynetLayerNorm32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetLayerNorm32f(src, add, count, size, scale, shift, eps, sum, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetRmsNorm32f(const float* src, const float* add, size_t count, size_t size,
+    const float* scale, const float* eps, float* sum, float* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetRmsNorm32fPtr) (const float* src, const float* add, size_t count, size_t size,
+        const float* scale, const float* eps, float* sum, float* dst);
+    const static SimdSynetRmsNorm32fPtr simdSynetRmsNorm32f = SIMD_FUNC3(SynetRmsNorm32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetRmsNorm32f(src, add, count, size, scale, eps, sum, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetLayerNorm16b(const uint16_t* src, const uint16_t* add, size_t count, size_t size,
+    const float* scale, const float* shift, const float* eps, float* buf, uint16_t* sum, uint16_t* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetLayerNorm16bPtr) (const uint16_t* src, const uint16_t* add, size_t count, size_t size,
+        const float* scale, const float* shift, const float* eps, float* buf, uint16_t* sum, uint16_t* dst);
+    const static SimdSynetLayerNorm16bPtr simdSynetLayerNorm16b = SIMD_FUNC3(SynetLayerNorm16b, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetLayerNorm16b(src, add, count, size, scale, shift, eps, buf, sum, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetRmsNorm16b(const uint16_t* src, const uint16_t* add, size_t count, size_t size,
+    const float* scale, const float* eps, float* buf, uint16_t* sum, uint16_t* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetRmsNorm16bPtr) (const uint16_t* src, const uint16_t* add, size_t count, size_t size,
+        const float* scale, const float* eps, float* buf, uint16_t* sum, uint16_t* dst);
+    const static SimdSynetRmsNorm16bPtr simdSynetRmsNorm16b = SIMD_FUNC3(SynetRmsNorm16b, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetRmsNorm16b(src, add, count, size, scale, eps, buf, sum, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void* SimdSynetPermuteInit(const size_t* shape, const size_t* order, size_t count, SimdTensorDataType type)
 {
     SIMD_EMPTY();
@@ -6645,6 +7027,21 @@ SIMD_API void SimdSynetPoolingMax8u(const uint8_t* src, size_t srcC, size_t srcH
 #endif
 }
 
+SIMD_API void SimdSynetPoolingAdaptive(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, SimdTensorDataType type,
+    SimdSynetPoolingMethodType method, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetPoolingAdaptivePtr) (const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, SimdTensorDataType type,
+        SimdSynetPoolingMethodType method, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
+    const static SimdSynetPoolingAdaptivePtr simdSynetPoolingAdaptive = SIMD_FUNC2(SynetPoolingAdaptive, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC);
+
+    simdSynetPoolingAdaptive(src, srcC, srcH, srcW, type, method, dst, dstH, dstW, format);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
 {
     SIMD_EMPTY();
@@ -7167,6 +7564,58 @@ SIMD_API void SimdSynetSoftmax16b(const uint16_t* src, size_t outer, size_t coun
 #endif
 }
 
+SIMD_API void SimdSynetSoftmaxMasked32f(const float* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, float* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetSoftmaxMasked32fPtr) (const float* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, float* dst);
+    const static SimdSynetSoftmaxMasked32fPtr simdSynetSoftmaxMasked32f = SIMD_FUNC2(SynetSoftmaxMasked32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC);
+
+    simdSynetSoftmaxMasked32f(src, outer, count, mask, maskOuter, log, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetSoftmaxMasked16b(const uint16_t* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, uint16_t* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetSoftmaxMasked16bPtr) (const uint16_t* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, uint16_t* dst);
+    const static SimdSynetSoftmaxMasked16bPtr simdSynetSoftmaxMasked16b = SIMD_FUNC2(SynetSoftmaxMasked16b, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC);
+
+    simdSynetSoftmaxMasked16b(src, outer, count, mask, maskOuter, log, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetSoftmaxTopK32f(const float* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetSoftmaxTopK32fPtr) (const float* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value);
+    const static SimdSynetSoftmaxTopK32fPtr simdSynetSoftmaxTopK32f = SIMD_FUNC2(SynetSoftmaxTopK32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC);
+
+    simdSynetSoftmaxTopK32f(src, outer, count, k, log, index, value);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetSoftmaxTopK16b(const uint16_t* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetSoftmaxTopK16bPtr) (const uint16_t* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value);
+    const static SimdSynetSoftmaxTopK16bPtr simdSynetSoftmaxTopK16b = SIMD_FUNC2(SynetSoftmaxTopK16b, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC);
+
+    simdSynetSoftmaxTopK16b(src, outer, count, k, log, index, value);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetSoftplus32f(const float* src, size_t size, const float* beta, const float* threshold, float* dst)
 {
     SIMD_EMPTY();
@@ -7180,6 +7629,51 @@ SIMD_API void SimdSynetSoftplus32f(const float* src, size_t size, const float* b
 #endif
 }
 
+SIMD_API void* SimdSynetSqueezeExcitation16bInit(size_t batch, size_t channels, size_t spatial, size_t squeeze, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdConvolutionActivationType activation)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetSqueezeExcitation16bInitPtr) (size_t batch, size_t channels, size_t spatial, size_t squeeze, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdConvolutionActivationType activation);
+    const static SimdSynetSqueezeExcitation16bInitPtr simdSynetSqueezeExcitation16bInit = SIMD_FUNC2(SynetSqueezeExcitation16bInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC);
+
+    return simdSynetSqueezeExcitation16bInit(batch, channels, spatial, squeeze, srcType, dstType, activation);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetSqueezeExcitation16bInternalBufferSize(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetSqueezeExcitation16b*)context)->InternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetSqueezeExcitation16bSetParams(void* context, const float* weight0, const float* bias0, const float* params, const float* weight1, const float* bias1)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetSqueezeExcitation16b*)context)->SetParams(weight0, bias0, params, weight1, bias1);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetSqueezeExcitation16bForward(void* context, const uint8_t* src, uint8_t* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetSqueezeExcitation16b*)context)->Forward(src, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetSwish32f(const float* src, size_t size, const float* slope, float* dst)
 {
     SIMD_EMPTY();
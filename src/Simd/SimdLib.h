@@ -637,6 +637,9 @@ typedef enum
     SimdSynetCompatibility16fpHard = 64, /*!< Use 16-bit floating point internal computation only when hardware support exists. */
     SimdSynetCompatibility16fpSoft = 128, /*!< Use 16-bit floating point internal computation with software emulation when hardware support is absent. */
     SimdSynetCompatibility16fpMask = 192, /*!< Mask used to extract 16-bit floating point policy bits. */
+    SimdSynetCompatibility16bWinograd = 256, /*!< Allow Winograd algorithm F(2x2,3x3) in BF16 convolution (faster for 3x3 convolutions but less precise). */
+    SimdSynetCompatibility16bWinograd4x4 = 512, /*!< Allow also Winograd algorithm F(4x4,3x3) in BF16 convolution (even faster but its error is about ten times bigger). */
+    SimdSynetCompatibility16bWinogradMask = 768, /*!< Mask used to extract BF16 Winograd policy bits. */
 } SimdSynetCompatibilityType;
 
 /*! @ingroup synet_types
@@ -653,6 +656,17 @@ typedef enum
     SimdSynetEltwiseOperationMin, /*!< Minimum of corresponding elements from all input arrays. */
 } SimdSynetEltwiseOperationType;
 
+/*! @ingroup synet_types
+    Describes pooling method used by ::SimdSynetConvolution32fInitPooled, ::SimdSynetConvolution16bInitPooled and ::SimdSynetPoolingAdaptive.
+
+    Pooling windows clipped by tensor boundaries are reduced over their valid part.
+*/
+typedef enum
+{
+    SimdSynetPoolingMethodMax, /*!< Maximum of values in pooling window. */
+    SimdSynetPoolingMethodAverage, /*!< Average of values in pooling window. */
+} SimdSynetPoolingMethodType;
+
 /*! @ingroup synet_types
     Describes unary operation type used by ::SimdSynetUnaryOperation32f.
 
@@ -1041,6 +1055,69 @@ extern "C"
     */
     SIMD_API const char * SimdPerformanceStatistic(void);
 
+    /*! @ingroup info
+
+        \fn SimdBool SimdRuntimeCacheSave(const char * path);
+
+        \short Saves runtime autotuning cache of %Simd Library to file.
+
+        Some algorithms of %Simd Library (for example GEMM in ::SimdSynetConvolution32fForward) have several implementations
+        and choose the fastest of them by measurement of first calls. The choice is stored in a process-wide cache keyed by
+        CPU model, thread number, function and shape of arguments. This function writes the cache to a versioned text file,
+        so it can be restored by ::SimdRuntimeCacheLoad in other processes to skip measurements and get deterministic choice.
+
+        \param [in] path - a path to the output file.
+        \return result of the operation.
+    */
+    SIMD_API SimdBool SimdRuntimeCacheSave(const char * path);
+
+    /*! @ingroup info
+
+        \fn SimdBool SimdRuntimeCacheLoad(const char * path);
+
+        \short Loads runtime autotuning cache of %Simd Library from file.
+
+        Entries of the file are merged into current cache. Entries for other CPU models or thread numbers are kept but not used.
+        It has to be called before first call of the autotuned algorithms (see ::SimdRuntimeCacheSave).
+
+        \param [in] path - a path to the file created by ::SimdRuntimeCacheSave.
+        \return result of the operation. It is ::SimdFalse if the file is absent, has different version or is corrupted.
+    */
+    SIMD_API SimdBool SimdRuntimeCacheLoad(const char * path);
+
+    /*! @ingroup info
+
+        \fn void SimdRuntimeCacheClear();
+
+        \short Clears runtime autotuning cache of %Simd Library (see ::SimdRuntimeCacheSave).
+    */
+    SIMD_API void SimdRuntimeCacheClear(void);
+
+    /*! @ingroup info
+
+        \fn SimdBool SimdGetTuningMode();
+
+        \short Gets current state of tuning mode of %Simd Library (see ::SimdSetTuningMode).
+
+        \return current state of tuning mode. By default it is ::SimdFalse.
+    */
+    SIMD_API SimdBool SimdGetTuningMode(void);
+
+    /*! @ingroup info
+
+        \fn void SimdSetTuningMode(SimdBool value);
+
+        \short Enables or disables tuning mode of %Simd Library.
+
+        In tuning mode some initialization functions (::SimdSynetConvolution32fInit) don't choose algorithm by fixed heuristics.
+        They create all suitable implementations and choose the fastest of them by measurement of first calls.
+        The mode affects only contexts created after the call. The choice is stored in runtime autotuning cache
+        (see ::SimdRuntimeCacheSave and ::SimdRuntimeCacheLoad), so the measurements can be skipped in other processes.
+
+        \param [in] value - a new state of tuning mode.
+    */
+    SIMD_API void SimdSetTuningMode(SimdBool value);
+
     /*! @ingroup memory
 
         \fn void * SimdAllocate(size_t size, size_t align);
@@ -4257,6 +4334,240 @@ extern "C"
     */
     SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
+    /*! @ingroup matrix
+
+        \fn void SimdGemm32fNNBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * const * A, size_t lda, const float * const * B, size_t ldb, const float * beta, float * const * C, size_t ldc);
+
+        \short Performs a batch of general matrix multiplications for row-major 32-bit floating-point matrices.
+
+        All matrices in the batch have the same sizes and strides. A and B are used without transposition:
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            for(i = 0; i < M; ++i)
+                for(j = 0; j < N; ++j)
+                    C[b][i*ldc + j] = alpha[0]*Sum(A[b][i*lda + k]*B[b][k*ldb + j]) + beta[0]*C[b][i*ldc + j];
+        \endverbatim
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            Small matrices are distributed across threads by batch items, large ones use multithreading of ::SimdGemm32fNN.
+
+        \param [in] batch - a number of matrix multiplications.
+        \param [in] M - a height of A and height of C matrices.
+        \param [in] N - a width of B and width of C matrices.
+        \param [in] K - a width of A and height of B matrices.
+        \param [in] alpha - a pointer to scalar multiplier of A*B.
+        \param [in] A - a pointer to array of pointers to input A matrices. The size of the array is equal to batch.
+        \param [in] lda - a row stride of A matrices (in 32-bit floats).
+        \param [in] B - a pointer to array of pointers to input B matrices. The size of the array is equal to batch.
+        \param [in] ldb - a row stride of B matrices (in 32-bit floats).
+        \param [in] beta - a pointer to scalar multiplier of the original C matrices.
+        \param [out] C - a pointer to array of pointers to input/output C matrices. The size of the array is equal to batch.
+        \param [in] ldc - a row stride of C matrices (in 32-bit floats).
+    */
+    SIMD_API void SimdGemm32fNNBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * const * A, size_t lda, 
+        const float * const * B, size_t ldb, const float * beta, float * const * C, size_t ldc);
+
+    /*! @ingroup matrix
+
+        \fn void SimdGemm32fNNStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA, const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC);
+
+        \short Performs a batch of general matrix multiplications for row-major 32-bit floating-point matrices placed with constant strides.
+
+        A and B are used without transposition:
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            for(i = 0; i < M; ++i)
+                for(j = 0; j < N; ++j)
+                    C[b*strideC + i*ldc + j] = alpha[0]*Sum(A[b*strideA + i*lda + k]*B[b*strideB + k*ldb + j]) + beta[0]*C[b*strideC + i*ldc + j];
+        \endverbatim
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            If strideB is equal to 0 (shared B matrix) and A and C matrices are placed without gaps (strideA = M*lda, strideC = M*ldc),
+            the batch is performed as one matrix multiplication, so B is packed only once.
+
+        \param [in] batch - a number of matrix multiplications.
+        \param [in] M - a height of A and height of C matrices.
+        \param [in] N - a width of B and width of C matrices.
+        \param [in] K - a width of A and height of B matrices.
+        \param [in] alpha - a pointer to scalar multiplier of A*B.
+        \param [in] A - a pointer to the first input A matrix.
+        \param [in] lda - a row stride of A matrices (in 32-bit floats).
+        \param [in] strideA - a stride between neighboring A matrices (in 32-bit floats).
+        \param [in] B - a pointer to the first input B matrix.
+        \param [in] ldb - a row stride of B matrices (in 32-bit floats).
+        \param [in] strideB - a stride between neighboring B matrices (in 32-bit floats). It can be 0.
+        \param [in] beta - a pointer to scalar multiplier of the original C matrices.
+        \param [out] C - a pointer to the first input/output C matrix.
+        \param [in] ldc - a row stride of C matrices (in 32-bit floats).
+        \param [in] strideC - a stride between neighboring C matrices (in 32-bit floats).
+    */
+    SIMD_API void SimdGemm32fNNStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA,
+        const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC);
+
+    /*! @ingroup matrix
+
+        \fn void SimdGemm32fNTStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA, const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC);
+
+        \short Performs a batch of general matrix multiplications with transposed B for row-major 32-bit floating-point matrices placed with constant strides.
+
+        B matrices are stored as N by K row-major matrices and are used as Trans(B) in the multiplication:
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            for(i = 0; i < M; ++i)
+                for(j = 0; j < N; ++j)
+                    C[b*strideC + i*ldc + j] = alpha[0]*Sum(A[b*strideA + i*lda + k]*B[b*strideB + j*ldb + k]) + beta[0]*C[b*strideC + i*ldc + j];
+        \endverbatim
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] batch - a number of matrix multiplications.
+        \param [in] M - a height of A and height of C matrices.
+        \param [in] N - a height of B and width of C matrices.
+        \param [in] K - a width of A and width of B matrices.
+        \param [in] alpha - a pointer to scalar multiplier of A*Trans(B).
+        \param [in] A - a pointer to the first input A matrix.
+        \param [in] lda - a row stride of A matrices (in 32-bit floats).
+        \param [in] strideA - a stride between neighboring A matrices (in 32-bit floats).
+        \param [in] B - a pointer to the first input B matrix.
+        \param [in] ldb - a row stride of B matrices (in 32-bit floats).
+        \param [in] strideB - a stride between neighboring B matrices (in 32-bit floats). It can be 0.
+        \param [in] beta - a pointer to scalar multiplier of the original C matrices.
+        \param [out] C - a pointer to the first input/output C matrix.
+        \param [in] ldc - a row stride of C matrices (in 32-bit floats).
+        \param [in] strideC - a stride between neighboring C matrices (in 32-bit floats).
+    */
+    SIMD_API void SimdGemm32fNTStridedBatched(size_t batch, size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, size_t strideA,
+        const float * B, size_t ldb, size_t strideB, const float * beta, float * C, size_t ldc, size_t strideC);
+
+    /*! @ingroup matrix
+
+        \fn void * SimdGemm32fNNcbInit(size_t N, size_t K, const float * B);
+
+        \short Initializes context of general matrix multiplication with constant (prepacked) B matrix.
+
+        Matrix B is reordered once in this function to internal format of the fastest available kernel.
+        Then ::SimdGemm32fNNcbRun can be called many times with different A matrices without repacking of B:
+        \verbatim
+        for(i = 0; i < M; ++i)
+            for(j = 0; j < N; ++j)
+                C[i*N + j] = Sum(A[i*K + k]*B[k*N + j]);
+        \endverbatim
+
+        \param [in] N - a width of B and width of C matrices.
+        \param [in] K - a height of B matrix (and width of A matrix).
+        \param [in] B - a pointer to K by N row-major 32-bit float B matrix. It can be released after the call.
+        \return a pointer to GEMM context. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdGemm32fNNcbInternalBufferSize and ::SimdGemm32fNNcbRun.
+    */
+    SIMD_API void * SimdGemm32fNNcbInit(size_t N, size_t K, const float * B);
+
+    /*! @ingroup matrix
+
+        \fn size_t SimdGemm32fNNcbInternalBufferSize(const void * context);
+
+        \short Gets size in bytes of internal buffer (prepacked B matrix) of GEMM context.
+
+        \param [in] context - a pointer to GEMM context. It must be created by function ::SimdGemm32fNNcbInit and released by function ::SimdRelease.
+        \return size of internal buffer (in bytes).
+    */
+    SIMD_API size_t SimdGemm32fNNcbInternalBufferSize(const void * context);
+
+    /*! @ingroup matrix
+
+        \fn void SimdGemm32fNNcbRun(void * context, size_t M, const float * A, float * C);
+
+        \short Performs general matrix multiplication with prepacked B matrix: C = A*B.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            It is thread safe: a single context can be used simultaneously from different threads.
+
+        \param [in] context - a pointer to GEMM context. It must be created by function ::SimdGemm32fNNcbInit and released by function ::SimdRelease.
+        \param [in] M - a height of A and height of C matrices. It can be different in different calls.
+        \param [in] A - a pointer to M by K row-major 32-bit float A matrix.
+        \param [out] C - a pointer to M by N row-major 32-bit float output C matrix.
+    */
+    SIMD_API void SimdGemm32fNNcbRun(void * context, size_t M, const float * A, float * C);
+
+    /*! @ingroup matrix
+
+        \fn void * SimdGemm16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB);
+
+        \short Initializes BF16 general matrix multiplication context.
+
+        The context performs multiplication of row-major matrices with using of BF16 arithmetic (AMX-BF16 and AVX-512BF16 kernels if they are available):
+        \verbatim
+        for(i = 0; i < M; ++i)
+            for(j = 0; j < N; ++j)
+                C[i*N + j] = Sum(A[i*K + k]*B[k*N + j]);
+        \endverbatim
+        If \a transB is SimdTrue then B is stored as N by K matrix and is used as Trans(B).
+        Matrices can be stored in 32-bit float (::SimdTensorData32f), BF16 (::SimdTensorData16b) or FP16 (::SimdTensorData16f) format.
+        FP32 inputs are rounded to BF16, FP16 inputs are converted to FP32 before rounding. Accumulation is always performed in FP32.
+        When \a constB is SimdTrue, matrix B must be set once by function ::SimdGemm16bSetB and is stored in internal prepacked form.
+
+        \param [in] M - a height of A and height of C matrices.
+        \param [in] N - a width of C matrix.
+        \param [in] K - a width of A matrix.
+        \param [in] typeA - a type of A matrix.
+        \param [in] typeB - a type of B matrix.
+        \param [in] typeC - a type of C matrix.
+        \param [in] transB - a flag of transposed B matrix.
+        \param [in] constB - a flag of constant B matrix.
+        \return a pointer to BF16 GEMM context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdGemm16bExternalBufferSize, ::SimdGemm16bInfo, ::SimdGemm16bSetB and ::SimdGemm16bRun.
+    */
+    SIMD_API void * SimdGemm16bInit(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB);
+
+    /*! @ingroup matrix
+
+        \fn size_t SimdGemm16bExternalBufferSize(const void * context);
+
+        \short Gets size in bytes of external temporary buffer required for BF16 general matrix multiplication.
+
+        \param [in] context - a pointer to BF16 GEMM context. It must be created by function ::SimdGemm16bInit and released by function ::SimdRelease.
+        \return size of external temporary buffer (in bytes).
+    */
+    SIMD_API size_t SimdGemm16bExternalBufferSize(const void * context);
+
+    /*! @ingroup matrix
+
+        \fn const char* SimdGemm16bInfo(const void* context);
+
+        \short Gets description of internal implementation of BF16 general matrix multiplication.
+
+        \param [in] context - a pointer to BF16 GEMM context. It must be created by function ::SimdGemm16bInit and released by function ::SimdRelease.
+        \return string with description of internal implementation.
+    */
+    SIMD_API const char* SimdGemm16bInfo(const void* context);
+
+    /*! @ingroup matrix
+
+        \fn void SimdGemm16bSetB(void * context, const uint8_t * B);
+
+        \short Sets constant B matrix of BF16 general matrix multiplication and converts it to internal prepacked form.
+
+        \param [in, out] context - a pointer to BF16 GEMM context. It must be created by function ::SimdGemm16bInit (with constB = SimdTrue) and released by function ::SimdRelease.
+        \param [in] B - a pointer to B matrix (of typeB). It can be released after the call.
+    */
+    SIMD_API void SimdGemm16bSetB(void * context, const uint8_t * B);
+
+    /*! @ingroup matrix
+
+        \fn void SimdGemm16bRun(void * context, const uint8_t * A, const uint8_t * B, uint8_t * buf, uint8_t * C);
+
+        \short Performs BF16 general matrix multiplication.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] context - a pointer to BF16 GEMM context. It must be created by function ::SimdGemm16bInit and released by function ::SimdRelease.
+        \param [in] A - a pointer to A matrix (of typeA).
+        \param [in] B - a pointer to B matrix (of typeB). It is ignored (can be NULL) if B is constant.
+        \param [out] buf - a pointer to external temporary buffer. The size of the buffer is determined by function ::SimdGemm16bExternalBufferSize.
+            Can be NULL (it causes usage of internal buffer).
+        \param [out] C - a pointer to output C matrix (of typeC).
+    */
+    SIMD_API void SimdGemm16bRun(void * context, const uint8_t * A, const uint8_t * B, uint8_t * buf, uint8_t * C);
+
     /*! @ingroup gray_conversion
 
         \fn void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride);
@@ -7596,6 +7907,79 @@ extern "C"
     SIMD_API void SimdSynetAdd8i(const uint8_t * aData, const float * aScale, const float* aShift, const uint8_t* bData, const float* bScale, const float* bShift,
         uint8_t* cData, const float* cScale, const float* cShift, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
 
+    /*! @ingroup synet_attention
+
+        \fn void* SimdSynetAttentionInit(size_t batch, size_t heads, size_t queries, size_t keys, size_t size, SimdTensorDataType srcType, SimdTensorDataType dstType, float scale);
+
+        \short Initializes context of fused multi-head attention (scaled dot-product attention).
+
+        All tensors have token-major layout which is produced by inner product layers, so no permutation is required:
+        Q and output tensors have shape batch*queries*heads*size, K and V tensors have shape batch*keys*heads*size.
+        For every batch item, head and query the algorithm calculates:
+        \verbatim
+        for(j = 0; j < keys; ++j)
+            s[j] = scale * Dot(Q[b, i, h], K[b, j, h]);
+        p = Softmax(s);
+        for(j = 0; j < keys; ++j)
+            dst[b, i, h] += p[j] * V[b, j, h];
+        \endverbatim
+        The softmax is calculated in streaming manner over tiles of keys (with rescaling of partial sums by running maximum),
+        so the full queries*keys attention matrix is never stored in memory.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            The number of threads is fixed at context initialization and is taken into account in ::SimdSynetAttentionExternalBufferSize.
+
+        \param [in] batch - a batch size.
+        \param [in] heads - a number of attention heads.
+        \param [in] queries - a number of queries (tokens of Q tensor).
+        \param [in] keys - a number of keys (tokens of K and V tensors).
+        \param [in] size - a size of each head.
+        \param [in] srcType - a type of Q, K and V tensors. It can be ::SimdTensorData32f or ::SimdTensorData16b.
+        \param [in] dstType - a type of output tensor. It can be ::SimdTensorData32f or ::SimdTensorData16b.
+        \param [in] scale - a scale of dot products (usually 1/sqrt(size)).
+        \return a pointer to attention context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetAttentionExternalBufferSize, ::SimdSynetAttentionInfo and ::SimdSynetAttentionForward.
+    */
+    SIMD_API void* SimdSynetAttentionInit(size_t batch, size_t heads, size_t queries, size_t keys, size_t size, SimdTensorDataType srcType, SimdTensorDataType dstType, float scale);
+
+    /*! @ingroup synet_attention
+
+        \fn size_t SimdSynetAttentionExternalBufferSize(const void* context);
+
+        \short Gets size in bytes of external temporary buffer required for fused attention.
+
+        \param [in] context - a pointer to attention context. It must be created by function ::SimdSynetAttentionInit and released by function ::SimdRelease.
+        \return size of external temporary buffer in bytes.
+    */
+    SIMD_API size_t SimdSynetAttentionExternalBufferSize(const void* context);
+
+    /*! @ingroup synet_attention
+
+        \fn const char* SimdSynetAttentionInfo(const void* context);
+
+        \short Gets description of internal implementation of fused attention.
+
+        \param [in] context - a pointer to attention context. It must be created by function ::SimdSynetAttentionInit and released by function ::SimdRelease.
+        \return string with description of internal implementation of fused attention.
+    */
+    SIMD_API const char* SimdSynetAttentionInfo(const void* context);
+
+    /*! @ingroup synet_attention
+
+        \fn void SimdSynetAttentionForward(void* context, const uint8_t* q, const uint8_t* k, const uint8_t* v, uint8_t* buf, uint8_t* dst);
+
+        \short Performs forward propagation of fused multi-head attention.
+
+        \param [in] context - a pointer to attention context. It must be created by function ::SimdSynetAttentionInit and released by function ::SimdRelease.
+        \param [in] q - a pointer to Q tensor (batch*queries*heads*size).
+        \param [in] k - a pointer to K tensor (batch*keys*heads*size).
+        \param [in] v - a pointer to V tensor (batch*keys*heads*size).
+        \param [out] buf - a pointer to external temporary buffer. The size of the buffer is determined by function ::SimdSynetAttentionExternalBufferSize.
+            Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to output tensor (batch*queries*heads*size).
+    */
+    SIMD_API void SimdSynetAttentionForward(void* context, const uint8_t* q, const uint8_t* k, const uint8_t* v, uint8_t* buf, uint8_t* dst);
+
     /*! @ingroup synet_other
 
         \fn void SimdSynetChannelSum16b(const uint16_t* src, size_t channels, size_t spatial, SimdTensorFormatType format, float* sum);
@@ -7716,6 +8100,13 @@ extern "C"
         A created context stores tensor shape, format, convolution geometry, group count and activation type.
         Weights, bias and activation parameters are attached later by ::SimdSynetConvolution32fSetParams.
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            The number of threads is fixed at context initialization and is taken into account in ::SimdSynetConvolution32fExternalBufferSize.
+
+        \note If tuning mode is enabled (see ::SimdSetTuningMode) the context creates all suitable implementations and measures them
+            during first calls of ::SimdSynetConvolution32fForward. The fastest one is kept and the others are released.
+            The choice is stored in runtime autotuning cache (see ::SimdRuntimeCacheSave).
+
         \param [in] batch - a batch size.
         \param [in] conv - a pointer to convolution parameters. Source and destination tensor types must be FP32.
         \return a pointer to FP32 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
@@ -7763,6 +8154,8 @@ extern "C"
         The returned string contains the implementation extension and algorithm name, for example a direct, depthwise,
         Winograd, NHWC direct or GEMM-based variant. The returned pointer is owned by the context and remains valid
         until the next call of this function for the same context or until the context is released.
+        In tuning mode (see ::SimdSetTuningMode) it returns list of tested implementations until the fastest one is chosen
+        and description of the chosen implementation after that.
 
         \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
         \return a string with description of internal implementation of FP32 convolution algorithm.
@@ -7818,6 +8211,73 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void * SimdSynetConvolution32fInitDynamic(size_t batch, const SimdConvolutionParameters * conv);
+
+        \short Initializes FP32 convolution context which supports change of input tensor shape.
+
+        The context is created for initial shape given by batch and conv parameters. Its shape can be changed by ::SimdSynetConvolution32fReshape.
+        The context keeps implementations for up to 8 most recently used shapes, so returning to one of them is cheap:
+        neither reinitialization nor repacking of weights is needed. The implementation of the least recently used shape
+        is released when a new shape exceeds this limit, so memory usage does not grow with number of different shapes.
+
+        \note Weights, bias and parameters passed to ::SimdSynetConvolution32fSetParams are used to initialize implementations for new shapes,
+            so they must be valid during lifetime of the context (flag internal is always set to ::SimdFalse).
+
+        \param [in] batch - an initial batch size.
+        \param [in] conv - a pointer to convolution parameters with initial input and output spatial size. Source and destination tensor types must be FP32.
+        \return a pointer to FP32 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in all functions which accept context created by ::SimdSynetConvolution32fInit and in ::SimdSynetConvolution32fReshape.
+    */
+    SIMD_API void * SimdSynetConvolution32fInitDynamic(size_t batch, const SimdConvolutionParameters * conv);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn SimdBool SimdSynetConvolution32fReshape(void * context, size_t batch, size_t srcH, size_t srcW);
+
+        \short Changes input tensor shape of FP32 convolution context.
+
+        The output spatial size is recalculated from convolution geometry. Size of external buffer can change after this call
+        (see ::SimdSynetConvolution32fExternalBufferSize).
+
+        \param [in, out] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInitDynamic
+            (a context created by ::SimdSynetConvolution32fInit accepts only its own shape) and released by function ::SimdRelease.
+        \param [in] batch - a new batch size.
+        \param [in] srcH - a new height of input tensor.
+        \param [in] srcW - a new width of input tensor.
+        \return ::SimdTrue if the shape was changed successfully. On error the context keeps previous shape.
+    */
+    SIMD_API SimdBool SimdSynetConvolution32fReshape(void * context, size_t batch, size_t srcH, size_t srcW);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void * SimdSynetConvolution32fInitPooled(size_t batch, const SimdConvolutionParameters * conv, SimdSynetPoolingMethodType method, size_t kernelY, size_t kernelX);
+
+        \short Initializes FP32 convolution context with fused pooling of its output.
+
+        The context performs convolution followed by max or average pooling with stride equal to kernel size and without padding
+        (partial windows at the right and bottom borders are clipped, average pooling excludes missing elements).
+        Output tensor of the context has pooled spatial size:
+        \verbatim
+        dstH = DivHi(conv->dstH, kernelY)
+        dstW = DivHi(conv->dstW, kernelX)
+        \endverbatim
+        The convolution is performed by bands of output rows and every band is pooled while it is still in cache,
+        so the full-size intermediate tensor is never written to memory. All bands use one convolution implementation with one copy
+        of packed weights: border bands (and all bands for NCHW format) read their input from a zero-padded copy of the needed source rows.
+
+        \param [in] batch - a batch size.
+        \param [in] conv - a pointer to convolution parameters (with unpooled output size). Source and destination tensor types must be FP32.
+        \param [in] method - a pooling method.
+        \param [in] kernelY - a height of pooling kernel. It must be in range [1, conv->dstH].
+        \param [in] kernelX - a width of pooling kernel. It must be in range [1, conv->dstW].
+        \return a pointer to FP32 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetConvolution32fExternalBufferSize, ::SimdSynetConvolution32fInternalBufferSize,
+            ::SimdSynetConvolution32fInfo, ::SimdSynetConvolution32fSetParams and ::SimdSynetConvolution32fForward.
+    */
+    SIMD_API void * SimdSynetConvolution32fInitPooled(size_t batch, const SimdConvolutionParameters * conv, SimdSynetPoolingMethodType method, size_t kernelY, size_t kernelX);
+
     /*! @ingroup synet_convolution_bf16
 
         \fn void * SimdSynetConvolution16bInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
@@ -7837,6 +8297,9 @@ extern "C"
         and compatibility flags. FP32 weights, bias and activation parameters are attached later by
         ::SimdSynetConvolution16bSetParams.
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            The number of threads is fixed at context initialization and is taken into account in ::SimdSynetConvolution16bExternalBufferSize.
+
         \param [in] batch - a batch size.
         \param [in] conv - a pointer to convolution parameters. Source and destination tensor types must be FP32 or BF16.
         \param [in] compatibility - calculation compatibility flags.
@@ -7910,6 +8373,62 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution16bSetParams(void* context, const float* weight, const float* bias, const float* params);
 
+    /*! @ingroup synet_convolution_bf16
+
+        \fn SimdBool SimdSynetConvolution16bShareParams(void* context, const void* source);
+
+        \short Sets weights, bias and activation parameters of BF16 convolution from another context.
+
+        Packed weights are not copied: both contexts refer to the same immutable reference-counted storage,
+        which is released together with the last context that uses it. So a number of contexts (for example one per
+        inference thread) can use the weights of one network with memory of one copy. Bias and activation parameters are copied.
+        A following call of ::SimdSynetConvolution16bSetParams for any of these contexts allocates its own storage.
+
+        \param [in, out] context - a pointer to BF16 convolution context. It must be created by function ::SimdSynetConvolution16bInit and released by function ::SimdRelease.
+        \param [in] source - a pointer to BF16 convolution context with the same parameters and implementation (see ::SimdSynetConvolution16bInfo)
+            whose parameters were set by ::SimdSynetConvolution16bSetParams or ::SimdSynetConvolution16bShareParams. It can be released after this call.
+        \return ::SimdTrue on success. Contexts with different parameters or implementations can't share weights.
+    */
+    SIMD_API SimdBool SimdSynetConvolution16bShareParams(void* context, const void* source);
+
+    /*! @ingroup synet_convolution_bf16
+
+        \fn size_t SimdSynetConvolution16bExportParams(const void* context, uint8_t* blob, size_t size);
+
+        \short Exports internal (converted and reordered) parameters of BF16 convolution to a binary blob.
+
+        The blob has a versioned header tagged with convolution parameters, implementation (including used instruction set extension)
+        and CPU cache sizes which influence the weight layout. All arrays in the blob are aligned relative to its beginning, so the blob
+        can be stored in a file and later used directly from memory mapped pointer by ::SimdSynetConvolution16bImportParams.
+
+        \param [in] context - a pointer to BF16 convolution context. It must be created by function ::SimdSynetConvolution16bInit
+            and its parameters must be set by ::SimdSynetConvolution16bSetParams or ::SimdSynetConvolution16bImportParams.
+        \param [out] blob - a pointer to output buffer. Can be NULL (in this case the function returns only the required size).
+        \param [in] size - a size of output buffer in bytes.
+        \return a size of the blob in bytes. The blob is written only if its size is not greater than size of output buffer.
+            It returns 0 if parameters of the context are not set.
+    */
+    SIMD_API size_t SimdSynetConvolution16bExportParams(const void* context, uint8_t* blob, size_t size);
+
+    /*! @ingroup synet_convolution_bf16
+
+        \fn SimdBool SimdSynetConvolution16bImportParams(void* context, const uint8_t* blob, size_t size);
+
+        \short Sets internal parameters of BF16 convolution from a blob created by ::SimdSynetConvolution16bExportParams.
+
+        The function is an alternative of ::SimdSynetConvolution16bSetParams without conversion and reordering of weights.
+        If the blob is aligned (for example it is a pointer to memory mapped file) the weights are used from the blob without copying,
+        so the blob must be valid during lifetime of the context (or until next call of ::SimdSynetConvolution16bSetParams).
+        Other (small) arrays are copied.
+
+        \param [in, out] context - a pointer to BF16 convolution context. It must be created by function ::SimdSynetConvolution16bInit and released by function ::SimdRelease.
+        \param [in] blob - a pointer to the blob.
+        \param [in] size - a size of the blob in bytes.
+        \return ::SimdTrue on success. It returns ::SimdFalse if the blob has other version or was created for other convolution parameters,
+            implementation or CPU. In this case parameters must be set by ::SimdSynetConvolution16bSetParams.
+    */
+    SIMD_API SimdBool SimdSynetConvolution16bImportParams(void* context, const uint8_t* blob, size_t size);
+
     /*! @ingroup synet_convolution_bf16
 
         \fn void SimdSynetConvolution16bForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst);
@@ -7940,6 +8459,80 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution16bForward(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst);
 
+    /*! @ingroup synet_convolution_bf16
+
+        \fn void* SimdSynetConvolution16bInitDynamic(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+
+        \short Initializes BF16 convolution context which supports change of input tensor shape.
+
+        The context is created for initial shape given by batch and conv parameters. Its shape can be changed by ::SimdSynetConvolution16bReshape.
+        The context keeps implementations for up to 8 most recently used shapes, so returning to one of them is cheap:
+        neither reinitialization nor repacking of weights is needed. The implementation of the least recently used shape
+        is released when a new shape exceeds this limit, so memory usage does not grow with number of different shapes.
+
+        \note Weights, bias and parameters passed to ::SimdSynetConvolution16bSetParams are used to initialize implementations for new shapes,
+            so they must be valid during lifetime of the context. The context can share parameters (see ::SimdSynetConvolution16bShareParams)
+            only with other context created by this function for the same current shape; then the weights of the source context must be valid
+            during lifetime of both contexts.
+
+        \param [in] batch - an initial batch size.
+        \param [in] conv - a pointer to convolution parameters with initial input and output spatial size.
+        \param [in] compatibility - a flags of calculation compatibility.
+        \return a pointer to BF16 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in all functions which accept context created by ::SimdSynetConvolution16bInit and in ::SimdSynetConvolution16bReshape.
+    */
+    SIMD_API void* SimdSynetConvolution16bInitDynamic(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+
+    /*! @ingroup synet_convolution_bf16
+
+        \fn SimdBool SimdSynetConvolution16bReshape(void* context, size_t batch, size_t srcH, size_t srcW);
+
+        \short Changes input tensor shape of BF16 convolution context.
+
+        The output spatial size is recalculated from convolution geometry. Size of external buffer can change after this call
+        (see ::SimdSynetConvolution16bExternalBufferSize).
+
+        \param [in, out] context - a pointer to BF16 convolution context. It must be created by function ::SimdSynetConvolution16bInitDynamic
+            (a context created by ::SimdSynetConvolution16bInit accepts only its own shape) and released by function ::SimdRelease.
+        \param [in] batch - a new batch size.
+        \param [in] srcH - a new height of input tensor.
+        \param [in] srcW - a new width of input tensor.
+        \return ::SimdTrue if the shape was changed successfully. On error the context keeps previous shape.
+    */
+    SIMD_API SimdBool SimdSynetConvolution16bReshape(void* context, size_t batch, size_t srcH, size_t srcW);
+
+    /*! @ingroup synet_convolution_bf16
+
+        \fn void* SimdSynetConvolution16bInitPooled(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility, SimdSynetPoolingMethodType method, size_t kernelY, size_t kernelX);
+
+        \short Initializes BF16 convolution context with fused pooling of its output.
+
+        The context performs convolution followed by max or average pooling with stride equal to kernel size and without padding
+        (partial windows at the right and bottom borders are clipped, average pooling excludes missing elements).
+        Output tensor of the context has pooled spatial size:
+        \verbatim
+        dstH = DivHi(conv->dstH, kernelY)
+        dstW = DivHi(conv->dstW, kernelX)
+        \endverbatim
+        Pooling is applied to FP32 output of convolution, output of pooling is converted to BF16 if destination type is BF16.
+        The convolution is performed by bands of output rows (with one copy of packed weights for all bands) and every band is pooled while it is still in cache.
+
+        \note Functions ::SimdSynetConvolution16bShareParams, ::SimdSynetConvolution16bExportParams and ::SimdSynetConvolution16bImportParams
+            are not supported by this context.
+
+        \param [in] batch - a batch size.
+        \param [in] conv - a pointer to convolution parameters (with unpooled output size).
+        \param [in] compatibility - a flags of calculation compatibility.
+        \param [in] method - a pooling method.
+        \param [in] kernelY - a height of pooling kernel. It must be in range [1, conv->dstH].
+        \param [in] kernelX - a width of pooling kernel. It must be in range [1, conv->dstW].
+        \return a pointer to BF16 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetConvolution16bExternalBufferSize, ::SimdSynetConvolution16bInternalBufferSize,
+            ::SimdSynetConvolution16bInfo, ::SimdSynetConvolution16bSetParams and ::SimdSynetConvolution16bForward.
+    */
+    SIMD_API void* SimdSynetConvolution16bInitPooled(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility,
+        SimdSynetPoolingMethodType method, size_t kernelY, size_t kernelX);
+
     /*! @ingroup synet_convolution_int8
 
         \fn void * SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
@@ -7959,6 +8552,9 @@ extern "C"
         and compatibility flags. FP32 weights, bias, activation parameters and tensor statistics are attached later by
         ::SimdSynetConvolution8iSetParams.
 
+        \note This function supports multithreading over batch (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            The number of threads is fixed at context initialization and is taken into account in ::SimdSynetConvolution8iExternalBufferSize.
+
         \param [in] batch - a batch size.
         \param [in] conv - a pointer to convolution parameters. Source and destination tensor types must be FP32 or UINT8.
         \param [in] compatibility - calculation compatibility flags. They select precise, overflow or narrowed INT8
@@ -8040,6 +8636,62 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution8iSetParams(void * context, const float * weight, const float * bias, const float * params, const float * const* stats);
 
+    /*! @ingroup synet_convolution_int8
+
+        \fn SimdBool SimdSynetConvolution8iShareParams(void * context, const void * source);
+
+        \short Sets weights, bias, activation parameters and tensor statistics of INT8 convolution from another context.
+
+        Quantized and reordered weights are not copied: both contexts refer to the same immutable reference-counted storage,
+        which is released together with the last context that uses it. Per-channel normalization, bias, activation parameters
+        and quantization parameters are copied. A following call of ::SimdSynetConvolution8iSetParams for any of these contexts
+        allocates its own storage.
+
+        \param [in, out] context - a pointer to INT8 convolution context. It must be created by function ::SimdSynetConvolution8iInit and released by function ::SimdRelease.
+        \param [in] source - a pointer to INT8 convolution context with the same parameters and implementation (see ::SimdSynetConvolution8iInfo)
+            whose parameters were set by ::SimdSynetConvolution8iSetParams or ::SimdSynetConvolution8iShareParams. It can be released after this call.
+        \return ::SimdTrue on success. Contexts with different parameters or implementations can't share weights.
+    */
+    SIMD_API SimdBool SimdSynetConvolution8iShareParams(void * context, const void * source);
+
+    /*! @ingroup synet_convolution_int8
+
+        \fn size_t SimdSynetConvolution8iExportParams(const void* context, uint8_t* blob, size_t size);
+
+        \short Exports internal (converted and reordered) parameters of INT8 convolution to a binary blob.
+
+        The blob has a versioned header tagged with convolution parameters, implementation (including used instruction set extension)
+        and CPU cache sizes which influence the weight layout. All arrays in the blob are aligned relative to its beginning, so the blob
+        can be stored in a file and later used directly from memory mapped pointer by ::SimdSynetConvolution8iImportParams.
+
+        \param [in] context - a pointer to INT8 convolution context. It must be created by function ::SimdSynetConvolution8iInit
+            and its parameters must be set by ::SimdSynetConvolution8iSetParams or ::SimdSynetConvolution8iImportParams.
+        \param [out] blob - a pointer to output buffer. Can be NULL (in this case the function returns only the required size).
+        \param [in] size - a size of output buffer in bytes.
+        \return a size of the blob in bytes. The blob is written only if its size is not greater than size of output buffer.
+            It returns 0 if parameters of the context are not set.
+    */
+    SIMD_API size_t SimdSynetConvolution8iExportParams(const void* context, uint8_t* blob, size_t size);
+
+    /*! @ingroup synet_convolution_int8
+
+        \fn SimdBool SimdSynetConvolution8iImportParams(void* context, const uint8_t* blob, size_t size);
+
+        \short Sets internal parameters of INT8 convolution from a blob created by ::SimdSynetConvolution8iExportParams.
+
+        The function is an alternative of ::SimdSynetConvolution8iSetParams without conversion and reordering of weights.
+        If the blob is aligned (for example it is a pointer to memory mapped file) the weights are used from the blob without copying,
+        so the blob must be valid during lifetime of the context (or until next call of ::SimdSynetConvolution8iSetParams).
+        Other (small) arrays are copied.
+
+        \param [in, out] context - a pointer to INT8 convolution context. It must be created by function ::SimdSynetConvolution8iInit and released by function ::SimdRelease.
+        \param [in] blob - a pointer to the blob.
+        \param [in] size - a size of the blob in bytes.
+        \return ::SimdTrue on success. It returns ::SimdFalse if the blob has other version or was created for other convolution parameters,
+            implementation or CPU. In this case parameters must be set by ::SimdSynetConvolution8iSetParams.
+    */
+    SIMD_API SimdBool SimdSynetConvolution8iImportParams(void* context, const uint8_t* blob, size_t size);
+
     /*! @ingroup synet_convolution_int8
 
         \fn void SimdSynetConvolution8iForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst);
@@ -8978,6 +9630,9 @@ extern "C"
         three-convolution sequence, the source tensor is added to the final output and therefore must
         have the same shape as the final destination tensor.
 
+        \note This function supports multithreading over batch (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            The number of threads is fixed at context initialization and is taken into account in ::SimdSynetMergedConvolution32fExternalBufferSize.
+
         \param [in] batch - a batch size.
         \param [in] convs - an array with convolution parameters in execution order.
         \param [in] count - a number of merged convolutions. It must be 2 or 3.
@@ -9063,6 +9718,9 @@ extern "C"
         three-convolution sequence, the source tensor is added to the final output and therefore must
         have the same shape as the final destination tensor.
 
+        \note This function supports multithreading over batch (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            The number of threads is fixed at context initialization and is taken into account in ::SimdSynetMergedConvolution16bExternalBufferSize.
+
         \param [in] batch - a batch size.
         \param [in] convs - an array with convolution parameters in execution order.
         \param [in] count - a number of merged convolutions. It must be 2 or 3.
@@ -9146,6 +9804,9 @@ extern "C"
         kernels and strides must be square, dilation must be 1 and stride must be 1, 2 or 3.
         Ordinary convolution weights are quantized to INT8 by ::SimdSynetMergedConvolution8iSetParams.
 
+        \note This function supports multithreading over batch (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            The number of threads is fixed at context initialization and is taken into account in ::SimdSynetMergedConvolution8iExternalBufferSize.
+
         \param [in] batch - a batch size.
         \param [in] convs - an array with convolution parameters in execution order.
         \param [in] count - a number of merged convolutions. It must be 2 or 3.
@@ -9468,6 +10129,145 @@ extern "C"
     SIMD_API void SimdSynetNormalizeLayerForward16bV2(const uint16_t* src, size_t batch, size_t channels, size_t spatial,
         const float* scale, const float* shift, const float* eps, SimdTensorFormatType format, float* buf, uint16_t* dst);
 
+    /*! @ingroup synet_normalize
+
+        \fn void SimdSynetLayerNorm32f(const float* src, const float* add, size_t count, size_t size, const float* scale, const float* shift, const float* eps, float* sum, float* dst);
+
+        \short Performs FP32 layer normalization over the innermost dimension with optional fused residual addition.
+
+        The input tensor is treated as count rows with size elements in every row.
+        If residual tensor add is not NULL it is added to the input before normalization (the sum can be stored to sum tensor).
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < count; ++i)
+        {
+            for(j = 0; j < size; ++j)
+                x[j] = add ? src[i, j] + add[i, j] : src[i, j];
+            if(add && sum)
+                for(j = 0; j < size; ++j)
+                    sum[i, j] = x[j];
+
+            mean = 0;
+            for(j = 0; j < size; ++j)
+                mean += x[j];
+            mean = mean / size;
+
+            sqsum = 0;
+            for(j = 0; j < size; ++j)
+                sqsum += Square(x[j] - mean);
+            norm = 1 / Sqrt(sqsum / size + eps[0]);
+            for(j = 0; j < size; ++j)
+                dst[i, j] = (x[j] - mean) * norm * scale[j] + (shift ? shift[j] : 0);
+        }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input FP32 tensor. Its size is equal to count * size.
+        \param [in] add - a pointer to the residual FP32 tensor with the same size. Can be NULL.
+        \param [in] count - a number of normalized rows (outer size of the tensor).
+        \param [in] size - a size of normalized row (innermost dimension of the tensor).
+        \param [in] scale - an array with scale parameters. The size of the array is equal to size.
+        \param [in] shift - an array with shift parameters. The size of the array is equal to size. Can be NULL.
+        \param [in] eps - a pointer to epsilon parameter. It is used to prevent division by zero.
+        \param [out] sum - a pointer to the output FP32 tensor with sum of src and add. Can be NULL. It is ignored if add is NULL.
+        \param [out] dst - a pointer to the output FP32 tensor. It can be equal to src.
+    */
+    SIMD_API void SimdSynetLayerNorm32f(const float* src, const float* add, size_t count, size_t size,
+        const float* scale, const float* shift, const float* eps, float* sum, float* dst);
+
+    /*! @ingroup synet_normalize
+
+        \fn void SimdSynetRmsNorm32f(const float* src, const float* add, size_t count, size_t size, const float* scale, const float* eps, float* sum, float* dst);
+
+        \short Performs FP32 RMS normalization over the innermost dimension with optional fused residual addition.
+
+        The input tensor is treated as count rows with size elements in every row.
+        If residual tensor add is not NULL it is added to the input before normalization (the sum can be stored to sum tensor).
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < count; ++i)
+        {
+            for(j = 0; j < size; ++j)
+                x[j] = add ? src[i, j] + add[i, j] : src[i, j];
+            if(add && sum)
+                for(j = 0; j < size; ++j)
+                    sum[i, j] = x[j];
+
+            sqsum = 0;
+            for(j = 0; j < size; ++j)
+                sqsum += Square(x[j]);
+            norm = 1 / Sqrt(sqsum / size + eps[0]);
+            for(j = 0; j < size; ++j)
+                dst[i, j] = x[j] * norm * scale[j];
+        }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input FP32 tensor. Its size is equal to count * size.
+        \param [in] add - a pointer to the residual FP32 tensor with the same size. Can be NULL.
+        \param [in] count - a number of normalized rows (outer size of the tensor).
+        \param [in] size - a size of normalized row (innermost dimension of the tensor).
+        \param [in] scale - an array with scale parameters. The size of the array is equal to size.
+        \param [in] eps - a pointer to epsilon parameter. It is used to prevent division by zero.
+        \param [out] sum - a pointer to the output FP32 tensor with sum of src and add. Can be NULL. It is ignored if add is NULL.
+        \param [out] dst - a pointer to the output FP32 tensor. It can be equal to src.
+    */
+    SIMD_API void SimdSynetRmsNorm32f(const float* src, const float* add, size_t count, size_t size,
+        const float* scale, const float* eps, float* sum, float* dst);
+
+    /*! @ingroup synet_normalize
+
+        \fn void SimdSynetLayerNorm16b(const uint16_t* src, const uint16_t* add, size_t count, size_t size, const float* scale, const float* shift, const float* eps, float* buf, uint16_t* sum, uint16_t* dst);
+
+        \short Performs BF16 layer normalization over the innermost dimension with optional fused residual addition.
+
+        It is BF16 variant of function ::SimdSynetLayerNorm32f. Input values are converted to FP32, 
+        the residual addition and normalization are performed in FP32 and the results are converted back to BF16.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input BF16 tensor. Its size is equal to count * size.
+        \param [in] add - a pointer to the residual BF16 tensor with the same size. Can be NULL.
+        \param [in] count - a number of normalized rows (outer size of the tensor).
+        \param [in] size - a size of normalized row (innermost dimension of the tensor).
+        \param [in] scale - an array with FP32 scale parameters. The size of the array is equal to size.
+        \param [in] shift - an array with FP32 shift parameters. The size of the array is equal to size. Can be NULL.
+        \param [in] eps - a pointer to epsilon parameter. It is used to prevent division by zero.
+        \param [out] buf - a pointer to external temporary FP32 buffer. The size of the buffer must be equal to 2 * size. Can be NULL (it causes usage of internal buffer).
+        \param [out] sum - a pointer to the output BF16 tensor with sum of src and add. Can be NULL. It is ignored if add is NULL.
+        \param [out] dst - a pointer to the output BF16 tensor. It can be equal to src.
+    */
+    SIMD_API void SimdSynetLayerNorm16b(const uint16_t* src, const uint16_t* add, size_t count, size_t size,
+        const float* scale, const float* shift, const float* eps, float* buf, uint16_t* sum, uint16_t* dst);
+
+    /*! @ingroup synet_normalize
+
+        \fn void SimdSynetRmsNorm16b(const uint16_t* src, const uint16_t* add, size_t count, size_t size, const float* scale, const float* eps, float* buf, uint16_t* sum, uint16_t* dst);
+
+        \short Performs BF16 RMS normalization over the innermost dimension with optional fused residual addition.
+
+        It is BF16 variant of function ::SimdSynetRmsNorm32f. Input values are converted to FP32, 
+        the residual addition and normalization are performed in FP32 and the results are converted back to BF16.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input BF16 tensor. Its size is equal to count * size.
+        \param [in] add - a pointer to the residual BF16 tensor with the same size. Can be NULL.
+        \param [in] count - a number of normalized rows (outer size of the tensor).
+        \param [in] size - a size of normalized row (innermost dimension of the tensor).
+        \param [in] scale - an array with FP32 scale parameters. The size of the array is equal to size.
+        \param [in] eps - a pointer to epsilon parameter. It is used to prevent division by zero.
+        \param [out] buf - a pointer to external temporary FP32 buffer. The size of the buffer must be equal to 2 * size. Can be NULL (it causes usage of internal buffer).
+        \param [out] sum - a pointer to the output BF16 tensor with sum of src and add. Can be NULL. It is ignored if add is NULL.
+        \param [out] dst - a pointer to the output BF16 tensor. It can be equal to src.
+    */
+    SIMD_API void SimdSynetRmsNorm16b(const uint16_t* src, const uint16_t* add, size_t count, size_t size,
+        const float* scale, const float* eps, float* buf, uint16_t* sum, uint16_t* dst);
+
     /*! @ingroup synet_permute
 
         \fn void* SimdSynetPermuteInit(const size_t * shape, const size_t* order, size_t count, SimdTensorDataType type);
@@ -9658,6 +10458,47 @@ extern "C"
     SIMD_API void SimdSynetPoolingMax8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
         size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
 
+    /*! @ingroup synet_pooling
+
+        \fn void SimdSynetPoolingAdaptive(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, SimdTensorDataType type, SimdSynetPoolingMethodType method, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
+
+        \short Performs 2D adaptive (or global) max or average pooling for FP32, BF16 or UINT8 tensor.
+
+        Pooling windows are determined by output size: they cover the whole input and neighbor windows can overlap by one element.
+        Global pooling corresponds to dstH = dstW = 1. Values of UINT8 tensor are averaged with rounding to nearest integer,
+        BF16 values are processed in FP32 domain. It supports ::SimdTensorFormatNchw and ::SimdTensorFormatNhwc.
+
+        Algorithm's details (example for NCHW tensor format):
+        \verbatim
+        for(c = 0; c < srcC; ++c)
+            for(dy = 0; dy < dstH; ++dy)
+                for(dx = 0; dx < dstW; ++dx)
+                {
+                    yBeg = Floor(dy*srcH/dstH);
+                    yEnd = Ceil((dy + 1)*srcH/dstH);
+                    xBeg = Floor(dx*srcW/dstW);
+                    xEnd = Ceil((dx + 1)*srcW/dstW);
+                    if(method == SimdSynetPoolingMethodMax)
+                        dst[c, dy, dx] = Max(src[c, yBeg..yEnd, xBeg..xEnd]);
+                    else
+                        dst[c, dy, dx] = Sum(src[c, yBeg..yEnd, xBeg..xEnd]) / ((yEnd - yBeg)*(xEnd - xBeg));
+                }
+        \endverbatim
+
+        \param [in] src - a pointer to the input tensor. The size of the array must be equal to srcC*srcH*srcW.
+        \param [in] srcC - a number of input and output channels.
+        \param [in] srcH - an input height.
+        \param [in] srcW - an input width.
+        \param [in] type - a type of input and output tensors. It can be ::SimdTensorData32f, ::SimdTensorData16b or ::SimdTensorData8u.
+        \param [in] method - a pooling method.
+        \param [out] dst - a pointer to the output tensor. The size of the array must be equal to srcC*dstH*dstW.
+        \param [in] dstH - an output height. It must be in range [1, srcH].
+        \param [in] dstW - an output width. It must be in range [1, srcW].
+        \param [in] format - a format of input and output tensor. It can be ::SimdTensorFormatNchw or ::SimdTensorFormatNhwc.
+    */
+    SIMD_API void SimdSynetPoolingAdaptive(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, SimdTensorDataType type,
+        SimdSynetPoolingMethodType method, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
+
     /*! @ingroup synet_activation
 
         \fn void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
@@ -9781,6 +10622,9 @@ extern "C"
         tensors. The implementation uses signed 8-bit weights, per-output-channel weight scales, optional
         bias and optional activation from ::SimdConvolutionActivationType.
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            The number of threads is fixed at context initialization and is taken into account in ::SimdSynetQuantizedConvolutionExternalBufferSize.
+
         \param [in] batch - a batch size.
         \param [in] conv - a pointer to convolution parameters (shape, kernel, stride, dilation, padding, group, tensor format, activation and data types).
         \return a pointer to Quantized convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
@@ -9877,12 +10721,14 @@ extern "C"
             }
         \endverbatim
 
+        For FP32 output matrix C the result is dequantized by per-column scale: C[i,j] = sum*aScale*bScale[j].
+
         \param [in] M - a height of A and height of C matrices.
         \param [in] N - a width of B and width of C matrices.
         \param [in] K - a width of A and height of B matrices.
         \param [in] typeA - a type of A matrix. Currently it must be ::SimdTensorData8u.
         \param [in] typeB - a type of B matrix. Currently it must be ::SimdTensorData8i.
-        \param [in] typeC - a type of C matrix. Currently it must be ::SimdTensorData8u.
+        \param [in] typeC - a type of C matrix. It can be ::SimdTensorData8u or ::SimdTensorData32f.
         \param [in] transB - a flag that matrix B is stored transposed (N*K instead of K*N).
         \param [in] constB - a flag that matrix B is constant. Currently it must be ::SimdTrue.
         \param [in] bias - a flag to add bias to output matrix C.
@@ -9937,8 +10783,8 @@ extern "C"
         \param [in] b - a pointer to constant INT8 B matrix. It must be valid when constB is ::SimdTrue.
         \param [in] bScale - a pointer to per-output-channel FP32 scales of B matrix. The size of the array must be equal to N.
         \param [in] bias - a pointer to INT32 bias values. The size of the array must be equal to N. Can be NULL.
-        \param [in] cScale - a pointer to FP32 quantization scale of C matrix.
-        \param [in] cZero - a pointer to UINT8 quantization zero of C matrix.
+        \param [in] cScale - a pointer to FP32 quantization scale of C matrix. It is ignored for FP32 C matrix.
+        \param [in] cZero - a pointer to UINT8 quantization zero of C matrix. It is ignored for FP32 C matrix.
     */
     SIMD_API void SimdSynetQuantizedInnerProductSetParams(void* context, const float* aScale, const uint8_t* aZero, const int8_t* b, const float* bScale, const int32_t* bias, const float* cScale, const uint8_t* cZero);
 
@@ -9953,7 +10799,7 @@ extern "C"
         \param [in] B - a pointer to INT8 B matrix. Can be NULL when B was set by ::SimdSynetQuantizedInnerProductSetParams.
         \param [out] buf - a pointer to external buffer. The size of the external temporary buffer is determined by function ::SimdSynetQuantizedInnerProductExternalBufferSize.
             Can be NULL (it causes usage of internal buffer).
-        \param [out] C - a pointer to UINT8 C matrix with size M*N.
+        \param [out] C - a pointer to output (UINT8 or FP32) C matrix with size M*N.
     */
     SIMD_API void SimdSynetQuantizedInnerProductForward(void* context, const uint8_t* A, const uint8_t* B, uint8_t* buf, uint8_t* C);
 
@@ -10482,6 +11328,111 @@ extern "C"
     */
     SIMD_API void SimdSynetSoftmax16b(const uint16_t* src, size_t outer, size_t count, size_t inner, uint16_t* dst);
 
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetSoftmaxMasked32f(const float* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, float* dst);
+
+        \short Calculates FP32 softmax (or log-softmax) along last dimension with optional additive mask.
+
+        Algorithm's details:
+        \verbatim
+        for(o = 0; o < outer; ++o)
+        {
+            for(c = 0; c < count; ++c)
+                value[c] = src[o*count + c] + (mask ? mask[(o%maskOuter)*count + c] : 0);
+            max = Max(value[c]) over c in [0, count);
+            sum = Sum(exp(value[c] - max)) over c in [0, count);
+            for(c = 0; c < count; ++c)
+                dst[o*count + c] = log ? value[c] - max - log(sum) : exp(value[c] - max)/sum;
+        }
+        \endverbatim
+
+        \note Masked positions should have large negative finite values (for example -10000 or -FLT_MAX) instead of -infinity.
+            Output array can coincide with input one.
+
+        \param [in] src - a pointer to the input FP32 array. The size of the array must be equal to outer*count.
+        \param [in] outer - a number of rows (a product of dimensions before softmax axis).
+        \param [in] count - a size of softmax axis.
+        \param [in] mask - a pointer to FP32 additive mask with maskOuter*count elements. Row o uses mask row (o % maskOuter):
+            maskOuter = 1 gives padding mask shared by all rows, maskOuter = number of queries gives causal (query x key) mask shared by all heads. Can be NULL.
+        \param [in] maskOuter - a number of rows in the mask. It must be positive if mask is not NULL.
+        \param [in] log - a flag to calculate log-softmax instead of softmax.
+        \param [out] dst - a pointer to the output FP32 array. The size of the array must be equal to outer*count.
+    */
+    SIMD_API void SimdSynetSoftmaxMasked32f(const float* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, float* dst);
+
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetSoftmaxMasked16b(const uint16_t* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, uint16_t* dst);
+
+        \short Calculates BF16 softmax (or log-softmax) along last dimension with optional additive mask.
+
+        It is BF16 analogue of function ::SimdSynetSoftmaxMasked32f. Input BF16 values are converted to FP32 for all computations,
+        the mask has FP32 format, the final values are converted back to BF16.
+
+        \param [in] src - a pointer to the input BF16 array. The size of the array must be equal to outer*count.
+        \param [in] outer - a number of rows (a product of dimensions before softmax axis).
+        \param [in] count - a size of softmax axis.
+        \param [in] mask - a pointer to FP32 additive mask with maskOuter*count elements. Row o uses mask row (o % maskOuter). Can be NULL.
+        \param [in] maskOuter - a number of rows in the mask. It must be positive if mask is not NULL.
+        \param [in] log - a flag to calculate log-softmax instead of softmax.
+        \param [out] dst - a pointer to the output BF16 array. The size of the array must be equal to outer*count.
+    */
+    SIMD_API void SimdSynetSoftmaxMasked16b(const uint16_t* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, uint16_t* dst);
+
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetSoftmaxTopK32f(const float* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value);
+
+        \short Calculates FP32 softmax along last dimension and returns only K most probable classes.
+
+        The function is intended for classification heads: it finds top-K (and argmax for k = 1) while scanning input
+        and does not write full probability tensor. 
+
+        Algorithm's details:
+        \verbatim
+        for(o = 0; o < outer; ++o)
+        {
+            max = Max(src[o*count + c]) over c in [0, count);
+            sum = Sum(exp(src[o*count + c] - max)) over c in [0, count);
+            for(i = 0; i < k; ++i)
+            {
+                c = index[o*k + i] = i-th largest element of src[o*count + [0, count)];
+                value[o*k + i] = log ? src[o*count + c] - max - log(sum) : exp(src[o*count + c] - max)/sum;
+            }
+        }
+        \endverbatim
+
+        \note Results are sorted in descending order. Equal elements are ordered by ascending index.
+
+        \param [in] src - a pointer to the input FP32 array. The size of the array must be equal to outer*count.
+        \param [in] outer - a number of rows (a product of dimensions before softmax axis).
+        \param [in] count - a size of softmax axis (number of classes).
+        \param [in] k - a number of returned classes. It must be in range [1, count].
+        \param [in] log - a flag to return log-softmax values instead of probabilities.
+        \param [out] index - a pointer to the output array with class indices. Its size must be equal to outer*k.
+        \param [out] value - a pointer to the output FP32 array with probabilities (or their logarithms). Its size must be equal to outer*k.
+    */
+    SIMD_API void SimdSynetSoftmaxTopK32f(const float* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value);
+
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetSoftmaxTopK16b(const uint16_t* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value);
+
+        \short Calculates BF16 softmax along last dimension and returns only K most probable classes.
+
+        It is BF16 analogue of function ::SimdSynetSoftmaxTopK32f. Input BF16 values are converted to FP32, output probabilities have FP32 format.
+
+        \param [in] src - a pointer to the input BF16 array. The size of the array must be equal to outer*count.
+        \param [in] outer - a number of rows (a product of dimensions before softmax axis).
+        \param [in] count - a size of softmax axis (number of classes).
+        \param [in] k - a number of returned classes. It must be in range [1, count].
+        \param [in] log - a flag to return log-softmax values instead of probabilities.
+        \param [out] index - a pointer to the output array with class indices. Its size must be equal to outer*k.
+        \param [out] value - a pointer to the output FP32 array with probabilities (or their logarithms). Its size must be equal to outer*k.
+    */
+    SIMD_API void SimdSynetSoftmaxTopK16b(const uint16_t* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value);
+
     /*! @ingroup synet_activation
 
         \fn void SimdSynetSoftplus32f(const float* src, size_t size, const float * beta, const float * threshold, float * dst);
@@ -10509,6 +11460,82 @@ extern "C"
     */
     SIMD_API void SimdSynetSoftplus32f(const float* src, size_t size, const float * beta, const float * threshold, float * dst);
 
+    /*! @ingroup synet_scale
+
+        \fn void* SimdSynetSqueezeExcitation16bInit(size_t batch, size_t channels, size_t spatial, size_t squeeze, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdConvolutionActivationType activation);
+
+        \short Initializes FP32/BF16 fused squeeze-and-excitation algorithm.
+
+        The context replaces sequence of global average pooling, two inner product layers (with activation after the first one),
+        sigmoid and per-channel scale. Channel means are accumulated while input tensor is streamed, then small excitation 
+        network is applied and finally input tensor is scaled in second pass (it is still in cache for typical SE block sizes).
+
+        \param [in] batch - a batch size.
+        \param [in] channels - a number of channels in the (input/output) image tensor.
+        \param [in] spatial - a spatial size (height*width) of (input/output) image tensor.
+        \param [in] squeeze - a number of channels in the squeezed (hidden) layer.
+        \param [in] srcType - a type of input tensor. It can be ::SimdTensorData32f or ::SimdTensorData16b.
+        \param [in] dstType - a type of output tensor. It can be ::SimdTensorData32f or ::SimdTensorData16b.
+        \param [in] activation - an activation function type of squeezed layer (usually ::SimdConvolutionActivationRelu or ::SimdConvolutionActivationSwish).
+        \return a pointer to squeeze-and-excitation context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetSqueezeExcitation16bInternalBufferSize, ::SimdSynetSqueezeExcitation16bSetParams and ::SimdSynetSqueezeExcitation16bForward.
+    */
+    SIMD_API void* SimdSynetSqueezeExcitation16bInit(size_t batch, size_t channels, size_t spatial, size_t squeeze, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdConvolutionActivationType activation);
+
+    /*! @ingroup synet_scale
+
+        \fn size_t SimdSynetSqueezeExcitation16bInternalBufferSize(const void * context);
+
+        \short Gets size of internal buffer used inside squeeze-and-excitation algorithm.
+
+        \param [in] context - a pointer to squeeze-and-excitation context. It must be created by function ::SimdSynetSqueezeExcitation16bInit and released by function ::SimdRelease.
+        \return size of internal buffer used inside squeeze-and-excitation algorithm.
+    */
+    SIMD_API size_t SimdSynetSqueezeExcitation16bInternalBufferSize(const void* context);
+
+    /*! @ingroup synet_scale
+
+        \fn void SimdSynetSqueezeExcitation16bSetParams(void* context, const float* weight0, const float* bias0, const float* params, const float* weight1, const float* bias1);
+
+        \short Sets weights, biases and activation parameters of squeeze-and-excitation algorithm.
+
+        \param [in] context - a pointer to squeeze-and-excitation context. It must be created by function ::SimdSynetSqueezeExcitation16bInit and released by function ::SimdRelease.
+        \param [in] weight0 - a pointer to FP32 weights of squeeze layer. It has squeeze*channels elements, stored as squeeze rows.
+        \param [in] bias0 - a pointer to FP32 bias of squeeze layer (squeeze elements). Can be NULL.
+        \param [in] params - a pointer to parameters of activation function (see ::SimdConvolutionActivationType). 
+            Can be NULL for activation functions without parameters.
+        \param [in] weight1 - a pointer to FP32 weights of excitation layer. It has channels*squeeze elements, stored as channels rows.
+        \param [in] bias1 - a pointer to FP32 bias of excitation layer (channels elements). Can be NULL.
+    */
+    SIMD_API void SimdSynetSqueezeExcitation16bSetParams(void* context, const float* weight0, const float* bias0, const float* params, const float* weight1, const float* bias1);
+
+    /*! @ingroup synet_scale
+
+        \fn void SimdSynetSqueezeExcitation16bForward(void* context, const uint8_t* src, uint8_t* dst);
+
+        \short Performs forward propagation of FP32/BF16 fused squeeze-and-excitation algorithm.
+
+        Algorithm's details (for every batch item):
+        \verbatim
+        for(c = 0; c < channels; ++c)
+            mean[c] = Sum(src[s][c], s = 0..spatial) / spatial;
+        for(q = 0; q < squeeze; ++q)
+            hidden[q] = Activation(Sum(weight0[q][c] * mean[c], c = 0..channels) + bias0[q]);
+        for(c = 0; c < channels; ++c)
+            scale[c] = Sigmoid(Sum(weight1[c][q] * hidden[q], q = 0..squeeze) + bias1[c]);
+        for(s = 0; s < spatial; ++s)
+            for(c = 0; c < channels; ++c)
+                dst[s][c] = src[s][c] * scale[c];
+        \endverbatim
+
+        \note Input and output tensors have ::SimdTensorFormatNhwc format. Output tensor can coincide with input one if they have the same type.
+
+        \param [in] context - a pointer to squeeze-and-excitation context. It must be created by function ::SimdSynetSqueezeExcitation16bInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor data. Its type is defined by parameter srcType of ::SimdSynetSqueezeExcitation16bInit.
+        \param [out] dst - a pointer to output tensor data. Its type is defined by parameter dstType of ::SimdSynetSqueezeExcitation16bInit.
+    */
+    SIMD_API void SimdSynetSqueezeExcitation16bForward(void* context, const uint8_t* src, uint8_t* dst);
+
     /*! @ingroup synet_activation
 
         \fn void SimdSynetSwish32f(const float * src, size_t size, const float * slope, float * dst);
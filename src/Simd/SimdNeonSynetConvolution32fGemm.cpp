@@ -483,7 +483,7 @@ namespace Simd
                     _nhwcWeight.Resize(_gemmCb.At(0).BufferSize(_M*_merge, _N, _K));
                 }
                 else
-                    _nhwcWeight.Resize(Neon::Gemm32fNNcbBufferSize(_M*_merge, _N, _K, GemmKernelAny, NHWC_GEMM_COMPATIBLE));
+                    _nhwcWeight.Resize(Neon::Gemm32fNNcbBufferSize(_M*_merge, _N, _K, GemmKernelAny, _nhwcCompatible));
                 _nhwcRun = Neon::Gemm32fNNcbRun;
                 _nhwcReorderB = Neon::Gemm32fNNcbReorderB;
             }
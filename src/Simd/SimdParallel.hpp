@@ -1,7 +1,7 @@
 /*
 * Simd Library (http://ermig1979.github.io/Simd).
 *
-* Copyright (c) 2011-2023 Yermalayeu Ihar.
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
 *
 * Permission is hereby granted, free of charge, to any person obtaining a copy
 * of this software and associated documentation files (the "Software"), to deal
@@ -26,12 +26,195 @@
 
 #include <vector>
 #include <thread>
+#include <algorithm>
 #ifndef SIMD_FUTURE_DISABLE
-#include <future>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 #endif
 
 namespace Simd
 {
+#ifndef SIMD_FUTURE_DISABLE
+    /*! \short Persistent pool of worker threads which is used by function Simd::Parallel.
+
+        The pool is created lazily at first parallel call and keeps its worker threads alive between calls.
+        Processed range is split into segments (one per thread), each segment is processed by small chunks.
+        A thread which has finished its own segment steals remaining chunks from the segments of other threads.
+        A callback is never called concurrently with the same thread index.
+    */
+    class ThreadPool
+    {
+    public:
+        typedef void(*Invoke)(const void * function, size_t thread, size_t begin, size_t end);
+
+        static const size_t CHUNKS_PER_THREAD = 4;
+
+        /*!
+            Gets a reference to global (library owned) thread pool.
+
+            \return a reference to global thread pool.
+        */
+        static ThreadPool & Global()
+        {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        ThreadPool()
+            : _busy(false)
+            , _stop(false)
+            , _generation(0)
+            , _active(0)
+        {
+        }
+
+        ~ThreadPool()
+        {
+            Release();
+        }
+
+        /*!
+            Executes given callback over range [begin, end) in parallel.
+
+            \param [in] begin - a begin of the range.
+            \param [in] end - an end of the range.
+            \param [in] threadNumber - a number of participating threads (including the calling thread).
+            \param [in] blockAlign - an alignment of chunk boundaries (relative to begin).
+            \param [in] invoke - a pointer to function which calls the callback.
+            \param [in] function - a pointer to the callback.
+            \return false if the pool is busy (concurrent or nested call). In this case nothing is executed.
+        */
+        bool Run(size_t begin, size_t end, size_t threadNumber, size_t blockAlign, Invoke invoke, const void * function)
+        {
+            if (_busy.exchange(true, std::memory_order_acquire))
+                return false;
+            Reserve(threadNumber - 1);
+            size_t blockSize = (end - begin + threadNumber - 1) / threadNumber;
+            blockSize = (blockSize + blockAlign - 1) / blockAlign * blockAlign;
+            size_t chunkSize = (blockSize + CHUNKS_PER_THREAD - 1) / CHUNKS_PER_THREAD;
+            chunkSize = (chunkSize + blockAlign - 1) / blockAlign * blockAlign;
+            size_t threads = 0;
+            for (size_t blockBegin = begin; threads < threadNumber && blockBegin < end; ++threads, blockBegin += blockSize)
+            {
+                _segments[threads].next.store(blockBegin, std::memory_order_relaxed);
+                _segments[threads].end = std::min(blockBegin + blockSize, end);
+            }
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _job.invoke = invoke;
+                _job.function = function;
+                _job.threads = threads;
+                _job.chunk = chunkSize;
+                _active = threads - 1;
+                _generation++;
+            }
+            _start.notify_all();
+            Execute(0);
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _finish.wait(lock, [this] { return _active == 0; });
+            }
+            _busy.store(false, std::memory_order_release);
+            return true;
+        }
+
+        /*!
+            Stops worker threads if their number exceeds given value. Stopped threads will be recreated at demand.
+
+            \param [in] workers - a maximal number of worker threads to keep.
+        */
+        void Shrink(size_t workers)
+        {
+            if (_busy.exchange(true, std::memory_order_acquire))
+                return;
+            if (_threads.size() > workers)
+                Release();
+            _busy.store(false, std::memory_order_release);
+        }
+
+    private:
+        struct Job
+        {
+            Invoke invoke;
+            const void * function;
+            size_t threads, chunk;
+        };
+
+        struct Segment
+        {
+            std::atomic<size_t> next;
+            size_t end;
+            char padding[64 - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+        };
+
+        std::atomic<bool> _busy;
+        std::mutex _mutex;
+        std::condition_variable _start, _finish;
+        std::vector<std::thread> _threads;
+        std::vector<Segment> _segments;
+        bool _stop;
+        size_t _generation, _active;
+        Job _job;
+
+        void Reserve(size_t workers)
+        {
+            if (_segments.size() < workers + 1)
+                _segments = std::vector<Segment>(workers + 1);
+            while (_threads.size() < workers)
+                _threads.push_back(std::thread(&ThreadPool::Worker, this, _threads.size() + 1, _generation));
+        }
+
+        void Release()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _start.notify_all();
+            for (size_t i = 0; i < _threads.size(); ++i)
+                _threads[i].join();
+            _threads.clear();
+            _stop = false;
+        }
+
+        void Worker(size_t thread, size_t generation)
+        {
+            for (;;)
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _start.wait(lock, [this, generation] { return _stop || _generation != generation; });
+                if (_stop)
+                    return;
+                generation = _generation;
+                if (thread >= _job.threads)
+                    continue;
+                lock.unlock();
+                Execute(thread);
+                lock.lock();
+                if (--_active == 0)
+                    _finish.notify_one();
+            }
+        }
+
+        void Execute(size_t thread)
+        {
+            const Job job = _job;
+            for (size_t i = 0; i < job.threads; ++i)
+            {
+                Segment & segment = _segments[(thread + i) % job.threads];
+                for (;;)
+                {
+                    size_t begin = segment.next.fetch_add(job.chunk, std::memory_order_relaxed);
+                    if (begin >= segment.end)
+                        break;
+                    job.invoke(job.function, thread, begin, std::min(begin + job.chunk, segment.end));
+                }
+            }
+        }
+    };
+#endif
+
     template<class Function> inline void Parallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockAlign = 1)
     {
 #ifdef SIMD_FUTURE_DISABLE
@@ -43,22 +226,15 @@ namespace Simd
             function(0, begin, end);
         else
         {
-            std::vector<std::future<void>> futures;
-
-            size_t blockSize = (end - begin + threadNumber - 1) / threadNumber;
-            blockSize = (blockSize + blockAlign - 1) / blockAlign * blockAlign;
-            size_t blockBegin = begin;
-            size_t blockEnd = blockBegin + blockSize;
-
-            for (size_t thread = 0; thread < threadNumber && blockBegin < end; ++thread)
+            struct Caller
             {
-                futures.push_back(std::move(std::async(std::launch::async, [blockBegin, blockEnd, thread, &function] { function(thread, blockBegin, blockEnd); })));
-                blockBegin += blockSize;
-                blockEnd = std::min(blockBegin + blockSize, end);
-            }
-
-            for (size_t i = 0; i < futures.size(); ++i)
-                futures[i].wait();
+                static void Invoke(const void * function, size_t thread, size_t begin, size_t end)
+                {
+                    (*(const Function*)function)(thread, begin, end);
+                }
+            };
+            if (!ThreadPool::Global().Run(begin, end, threadNumber, blockAlign, Caller::Invoke, &function))
+                function(0, begin, end);
         }
 #endif
     }
@@ -31,8 +31,8 @@
 #include <limits>
 #include <algorithm>
 #include <string>
-#ifdef SIMD_RUNTIME_STATISTIC
 #include <sstream>
+#ifdef SIMD_RUNTIME_STATISTIC
 #include <iostream>
 #include <iomanip>
 #endif
@@ -41,6 +41,23 @@ namespace Simd
 {
     typedef ::std::string String;
 
+    namespace Base
+    {
+        bool RuntimeCacheGet(const String & key, String & name);
+
+        void RuntimeCacheSet(const String & key, const String & name);
+
+        void RuntimeCacheClear();
+
+        bool RuntimeCacheSave(const char * path);
+
+        bool RuntimeCacheLoad(const char * path);
+
+        bool GetTuningMode();
+
+        void SetTuningMode(bool value);
+    }
+
     template <class Func, class Args> struct Runtime
     {
         SIMD_INLINE Runtime()
@@ -95,11 +112,21 @@ namespace Simd
             return _candidates.size();
         }
 
+        SIMD_INLINE bool Ready() const
+        {
+            return _best != NULL;
+        }
+
         SIMD_INLINE const Func & At(size_t index) const
         {
             return _candidates[index].func;
         }
 
+        SIMD_INLINE const Func * Selected() const
+        {
+            return _best;
+        }
+
     private:
         static const size_t TEST_COUNT = 3 + 2;
 
@@ -140,11 +167,27 @@ namespace Simd
 
         Func * _best;
         Candidates _candidates;
-        String _info;
+        String _info, _key;
 
         SIMD_INLINE void Test(const Args & args)
         {
             assert(_candidates.size());
+            if (_key.empty())
+            {
+                _key = Key(args);
+                String name;
+                if (Base::RuntimeCacheGet(_key, name))
+                {
+                    for (size_t i = 0; i < _candidates.size() && _best == NULL; ++i)
+                        if (_candidates[i].func.Name() == name)
+                            _best = &_candidates[i].func;
+                    if (_best)
+                    {
+                        _best->Run(args);
+                        return;
+                    }
+                }
+            }
             Candidate * current = Current();
             if (current)
             {
@@ -159,10 +202,21 @@ namespace Simd
             else
             {
                 _best = &Best()->func;
+                Base::RuntimeCacheSet(_key, _best->Name());
                 _best->Run(args);
             }
         }
 
+        SIMD_INLINE String Key(const Args & args) const
+        {
+            std::stringstream ss;
+            ss << _candidates[0].func.Info(args) << " {";
+            for (size_t i = 0; i < _candidates.size(); ++i)
+                ss << (i ? ", " : "") << _candidates[i].func.Name();
+            ss << "}";
+            return ss.str();
+        }
+
         SIMD_INLINE Candidate * Current()
         {
             size_t min = TEST_COUNT;
@@ -222,14 +276,12 @@ namespace Simd
             _func(args.M, args.N, args.K, args.alpha, args.A, args.lda, args.B, args.ldb, args.beta, args.C, args.ldc);
         }
 
-#ifdef SIMD_RUNTIME_STATISTIC
         SIMD_INLINE String Info(const GemmArgs & args) const
         {
             std::stringstream ss;
             ss << "Gemm [" << args.M << ", " << args.N << ", " << args.K << "]";
             return ss.str();
         }
-#endif
 
     private:
         Func _func;
@@ -280,14 +332,12 @@ namespace Simd
             _run(args.M, args.N, args.K, args.A, args.pB, args.C, _type, _type != GemmKernelAny);
         }
 
-#ifdef SIMD_RUNTIME_STATISTIC
         SIMD_INLINE String Info(const GemmCbArgs & args) const
         {
             std::stringstream ss;
             ss << "GemmCb [" << args.M << ", " << args.N << ", " << args.K << "]";
             return ss.str();
         }
-#endif 
         
         SIMD_INLINE GemmKernelType Type() const { return _type; }
 
@@ -33,6 +33,8 @@ namespace Simd
             ConvParam param(batch, conv, compatibility);
             if (!param.Valid(SimdTensorData32f, SimdTensorData16b))
                 return NULL;
+            if (Base::SynetConvolution16bNhwcWinograd::Preferable(param))
+                return new Sse41::SynetConvolution16bNhwcWinograd(param);
             //if (SynetConvolution16bNhwcSpecV1::Preferable(param))
             //    return new Sse41::SynetConvolution16bNhwcSpecV1(param);
             if (SynetConvolution16bNhwcSpecV0::Preferable(param))
@@ -0,0 +1,55 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution16b.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#if defined(SIMD_SSE41_ENABLE) && defined(SIMD_SYNET_ENABLE) 
+    namespace Sse41
+    {
+        SynetConvolution16bNhwcWinograd::SynetConvolution16bNhwcWinograd(const ConvParam& p)
+            : Base::SynetConvolution16bNhwcWinograd(p)
+        {
+            if (_blockY == 4)
+            {
+                _setFilter = Sse41::WinogradKernel3x3Block4x4SetFilter;
+                _setInput = Sse41::WinogradKernel3x3Block4x4SetInput;
+                _setOutput = Sse41::WinogradKernel3x3Block4x4SetOutput;
+            }
+            else
+            {
+                _setFilter = Sse41::WinogradKernel3x3Block2x2SetFilter;
+                _setInput = Sse41::WinogradKernel3x3Block2x2SetInput;
+                _setOutput = Sse41::WinogradKernel3x3Block2x2SetOutput;
+            }
+            SetGemm(Sse41::SynetInnerProduct16bInit);
+            _biasAndActivation = Sse41::ConvolutionBiasAndActivation;
+            _bFloat16ToFloat32 = Sse41::BFloat16ToFloat32;
+            _float32ToBFloat16 = Sse41::Float32ToBFloat16;
+        }
+    }
+#endif
+}
@@ -40,6 +40,19 @@ namespace Simd
             ConvParam param(batch, conv, SimdSynetCompatibilityDefault);
             if (!param.Valid(SimdTensorData32f))
                 return NULL;
+            if (Base::GetTuningMode())
+            {
+                Base::SynetConvolution32fTuned::Convs convs;
+                Base::SynetConvolution32fTuned::Add<SynetConvolution32fDepthwiseDotProduct>(param, convs);
+                Base::SynetConvolution32fTuned::Add<SynetConvolution32fWinograd>(param, convs);
+                Base::SynetConvolution32fTuned::Add<SynetConvolution32fGemmNT>(param, convs);
+                Base::SynetConvolution32fTuned::Add<SynetConvolution32fDirectNchw>(param, convs);
+                Base::SynetConvolution32fTuned::Add<SynetConvolution32fNhwcDirect>(param, convs);
+                Base::SynetConvolution32fTuned::Add<SynetConvolution32fNhwcDepthwise>(param, convs);
+                Base::SynetConvolution32fTuned::Add<SynetConvolution32fNhwcGroupedBlock1x2>(param, convs);
+                convs.push_back(new SynetConvolution32fGemmNN(param));
+                return Base::SynetConvolution32fTuned::Create(param, convs);
+            }
             if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
                 return new SynetConvolution32fDepthwiseDotProduct(param);
             else if (SynetConvolution32fWinograd::Preferable(param))
@@ -479,7 +479,7 @@ namespace Simd
                     _nhwcWeight.Resize(_gemmCb.At(0).BufferSize(_M * _merge, _N, _K));
                 }
                 else
-                    _nhwcWeight.Resize(Sse41::Gemm32fNNcbBufferSize(_M * _merge, _N, _K, GemmKernelAny, NHWC_GEMM_COMPATIBLE));
+                    _nhwcWeight.Resize(Sse41::Gemm32fNNcbBufferSize(_M * _merge, _N, _K, GemmKernelAny, _nhwcCompatible));
                 _nhwcRun = Sse41::Gemm32fNNcbRun;
                 _nhwcReorderB = Sse41::Gemm32fNNcbReorderB;
             }
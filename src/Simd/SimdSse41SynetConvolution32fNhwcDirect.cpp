@@ -86,6 +86,15 @@ namespace Simd
                 return false;
             return true;
         }
+
+        bool SynetConvolution32fNhwcDirect::Applicable(const ConvParam& p)
+        {
+            if (p.trans != SimdTrue || p.group != 1)
+                return false;
+            if (!p.Is1x1() && p.dstW < 6 + p.padX + p.padW)
+                return false;
+            return p.kernelY <= p.srcH && p.kernelX <= p.srcW;
+        }
     }
 #endif
 }
@@ -101,9 +101,7 @@ namespace Simd
 
         SIMD_INLINE void ConvertBn(const float* src, size_t stride, uint16_t* dst)
         {
-            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(_mm_castps_si128(_mm_loadu_ps(src + 0 * stride)), Bf16::ROUND), Base::Bf16::SHIFT);
-            __m128i d1 = _mm_and_si128(_mm_add_epi32(_mm_castps_si128(_mm_loadu_ps(src + 1 * stride)), Bf16::ROUND), Bf16::MASK);
-            _mm_storeu_si128((__m128i*)dst, _mm_or_si128(d0, d1));
+            _mm_storeu_si128((__m128i*)dst, Float32ToBFloat16Interlived(_mm_loadu_ps(src + 0 * stride), _mm_loadu_ps(src + 1 * stride)));
         }
 
         static void InnerProduct16bGemmNN_ConvertBn(const uint8_t* src8, const InnerProductParam16b& p, const AlgParam& a, size_t N, size_t K, uint16_t* dst)
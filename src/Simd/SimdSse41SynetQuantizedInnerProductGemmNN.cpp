@@ -226,7 +226,7 @@ namespace Simd
             if (p.typeC == SimdTensorData8u)
                 _gemm = QuantizedInnerProductGemm_2<Term8iLast8u>;
             else
-                _gemm = NULL;// QuantizedInnerProductGemm_2<Term8iLast32f>;
+                _gemm = QuantizedInnerProductGemm_2<Term8iLast32f>;
         }
     }
 #endif
@@ -54,6 +54,16 @@ namespace Simd
             return (format == SimdTensorFormatNhwc && channels != 1) || (format == SimdTensorFormatNchw && spatial == 1);
         }
 
+        SIMD_INLINE size_t AdaptivePoolingBeg(size_t index, size_t srcSize, size_t dstSize)
+        {
+            return index * srcSize / dstSize;
+        }
+
+        SIMD_INLINE size_t AdaptivePoolingEnd(size_t index, size_t srcSize, size_t dstSize)
+        {
+            return ((index + 1) * srcSize + dstSize - 1) / dstSize;
+        }
+
 #if defined(SIMD_INT8_DEBUG_ENABLE)
         SIMD_INLINE bool FmaAvoid(SimdSynetCompatibilityType compatibility)
         {
@@ -325,6 +335,37 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        SIMD_INLINE void SynetSoftmaxTopKInsert(float value, uint32_t index, size_t size, float* values, uint32_t* indices)
+        {
+            size_t i = size - 1;
+            for (; i > 0 && values[i - 1] < value; --i)
+            {
+                values[i] = values[i - 1];
+                indices[i] = indices[i - 1];
+            }
+            values[i] = value;
+            indices[i] = index;
+        }
+
+        SIMD_INLINE void SynetSoftmaxTopKFinalize(float sum, size_t k, SimdBool log, float* values)
+        {
+            float max = values[0];
+            if (log)
+            {
+                float shift = ::log(sum);
+                for (size_t i = 0; i < k; ++i)
+                    values[i] = values[i] - max - shift;
+            }
+            else
+            {
+                float norm = 1.0f / sum;
+                for (size_t i = 0; i < k; ++i)
+                    values[i] = ::exp(values[i] - max) * norm;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         static SIMD_INLINE int32_t Set4(uint8_t value)
         {
             return int32_t(value) | (int32_t(value) << 8) | (int32_t(value) << 16) | (int32_t(value) << 24);
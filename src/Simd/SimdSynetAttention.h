@@ -0,0 +1,181 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetAttention_h__
+#define __SimdSynetAttention_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdPerformance.h"
+
+namespace Simd
+{
+    const int64_t SYNET_ATTENTION_THREAD_FLOP_MIN = int64_t(256 * 256 * 256) * 2;
+
+    struct AttentionParam
+    {
+        size_t batch, heads, queries, keys, size;
+        SimdTensorDataType srcType, dstType;
+        float scale;
+
+        SIMD_INLINE AttentionParam(size_t b, size_t h, size_t q, size_t k, size_t s, SimdTensorDataType st, SimdTensorDataType dt, float sc)
+            : batch(b)
+            , heads(h)
+            , queries(q)
+            , keys(k)
+            , size(s)
+            , srcType(st)
+            , dstType(dt)
+            , scale(sc)
+        {
+        }
+
+        SIMD_INLINE bool Valid() const
+        {
+            return batch && heads && queries && keys && size &&
+                (srcType == SimdTensorData32f || srcType == SimdTensorData16b) &&
+                (dstType == SimdTensorData32f || dstType == SimdTensorData16b);
+        }
+
+        SIMD_INLINE int64_t Flop() const
+        {
+            return int64_t(batch * heads * queries * keys) * size * 4;
+        }
+
+        SIMD_INLINE String Info() const
+        {
+            std::stringstream ss;
+            ss << batch << "x" << heads << "x" << queries << "x" << keys << "x" << size;
+            ss << "-" << (srcType == SimdTensorData32f ? "f" : "b") << (dstType == SimdTensorData32f ? "f" : "b");
+            return ss.str();
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class SynetAttention : public Deletable
+    {
+    public:
+        SynetAttention(const AttentionParam& p)
+            : _param(p)
+        {
+        }
+
+        virtual String Ext() const = 0;
+        virtual String Desc() const = 0;
+
+        const char* Info() const
+        {
+            _info = Desc();
+            return _info.c_str();
+        }
+
+        virtual size_t ExternalBufferSize() const = 0;
+
+        virtual void Forward(const uint8_t* q, const uint8_t* k, const uint8_t* v, uint8_t* buf, uint8_t* dst) = 0;
+
+        uint8_t* Buffer(uint8_t* buffer)
+        {
+            if (buffer)
+                return buffer;
+            else
+            {
+                _buffer.Resize(ExternalBufferSize());
+                return _buffer.data;
+            }
+        }
+
+    protected:
+        AttentionParam _param;
+        Array8u _buffer;
+        mutable String _info;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        class SynetAttention : public Simd::SynetAttention
+        {
+        public:
+            SynetAttention(const AttentionParam& p);
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const;
+            virtual size_t ExternalBufferSize() const;
+            virtual void Forward(const uint8_t* q, const uint8_t* k, const uint8_t* v, uint8_t* buf, uint8_t* dst);
+
+            typedef void (*ConvertPtr)(const uint8_t* src, size_t count, size_t stride, size_t size, float scale, float* dst);
+            typedef void (*AttentionPtr)(const float* q, const float* k, const float* v, size_t stride, size_t keys, size_t size, float* buf, float* dst);
+            typedef void (*StorePtr)(const float* src, size_t size, uint8_t* dst);
+
+            static const size_t KEY_TILE = 64;
+            static const size_t QUERY_BLOCK = 16;
+
+        protected:
+            void ForwardItems(const uint8_t* q, const uint8_t* k, const uint8_t* v, size_t begin, size_t end, uint8_t* buf, uint8_t* dst);
+
+            size_t _threadNumber, _queryBlocks, _stride;
+            ConvertPtr _convert;
+            AttentionPtr _attention;
+            StorePtr _store;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetAttentionInit(size_t batch, size_t heads, size_t queries, size_t keys, size_t size, SimdTensorDataType srcType, SimdTensorDataType dstType, float scale);
+    }
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetAttention : public Base::SynetAttention
+        {
+        public:
+            SynetAttention(const AttentionParam& p);
+            virtual String Ext() const { return "Avx2"; }
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetAttentionInit(size_t batch, size_t heads, size_t queries, size_t keys, size_t size, SimdTensorDataType srcType, SimdTensorDataType dstType, float scale);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class SynetAttention : public Avx2::SynetAttention
+        {
+        public:
+            SynetAttention(const AttentionParam& p);
+            virtual String Ext() const { return "Avx512bw"; }
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetAttentionInit(size_t batch, size_t heads, size_t queries, size_t keys, size_t size, SimdTensorDataType srcType, SimdTensorDataType dstType, float scale);
+    }
+#endif
+}
+
+#endif
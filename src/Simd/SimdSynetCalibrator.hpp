@@ -0,0 +1,340 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetCalibrator_hpp__
+#define __SimdSynetCalibrator_hpp__
+
+#include "Simd/SimdLib.h"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+
+namespace Simd
+{
+    /*! @ingroup cpp_synet_network
+
+        \short The SynetCalibrator class collects statistics of FP32 tensor for its quantization.
+
+        It is fed with FP32 tensors (usually outputs of FP32 Synet layers on sample inputs) and accumulates
+        per-channel minimum and maximum and per-tensor histogram. The histogram range grows automatically
+        (by doubling with merging of neighbor bins), so one pass over samples is enough.
+        The collected statistics give quantization range with using of one of methods:
+        - MethodMinMax - full observed range;
+        - MethodPercentile - range which contains given percentile of values (outliers are clipped);
+        - MethodEntropy - symmetric threshold which minimizes Kullback-Leibler divergence between original
+            and quantized distributions.
+
+        The results can be used as statistics for ::SimdSynetConvolution8iSetParams, Simd::SynetConvolutionConverter
+        or as scale and zero for ::SimdSynetQuantizeLinear and ::SimdSynetQuantizedConvolutionSetParams.
+
+        Using example:
+        \code
+        #include "Simd/SimdSynetCalibrator.hpp"
+
+        Simd::SynetCalibrator calibrator(conv.dstC, conv.dstH * conv.dstW, conv.dstF);
+        for (size_t i = 0; i < samples.size(); ++i)
+        {
+            SimdSynetConvolution32fForward(context, samples[i], buf, dst);
+            calibrator.Update(dst);
+        }
+        float scale;
+        uint8_t zero;
+        calibrator.Quantization(Simd::SynetCalibrator::MethodPercentile, scale, zero);
+        \endcode
+    */
+    class SynetCalibrator
+    {
+    public:
+        /*!
+            \enum Method
+            Describes method of calculation of quantization range.
+        */
+        enum Method
+        {
+            MethodMinMax, /*!< Full observed range. */
+            MethodPercentile, /*!< Range which contains given percentile of values. */
+            MethodEntropy, /*!< Symmetric threshold with minimal Kullback-Leibler divergence. */
+        };
+
+        /*!
+            \short Creates calibrator for tensor with given shape.
+
+            \param [in] channels - a number of channels of tensor.
+            \param [in] spatial - a spatial size of tensor (height * width).
+            \param [in] format - a format of tensor (::SimdTensorFormatNchw or ::SimdTensorFormatNhwc).
+            \param [in] bins - a number of bins of histogram. It must be a multiple of 4.
+        */
+        SynetCalibrator(size_t channels, size_t spatial, SimdTensorFormatType format, size_t bins = 2048)
+            : _channels(channels)
+            , _spatial(spatial)
+            , _format(format)
+            , _min(channels, FLT_MAX)
+            , _max(channels, -FLT_MAX)
+            , _hist(bins, 0)
+            , _range(0.0f)
+            , _count(0)
+        {
+        }
+
+        /*!
+            \short Accumulates statistics of FP32 tensor.
+
+            \param [in] src - a pointer to FP32 tensor with batch*channels*spatial elements.
+            \param [in] batch - a batch size.
+        */
+        void Update(const float * src, size_t batch = 1)
+        {
+            size_t size = _channels * _spatial;
+            float absMax = 0.0f;
+            for (size_t b = 0; b < batch; ++b, src += size)
+            {
+                if (_format == SimdTensorFormatNhwc)
+                {
+                    for (size_t s = 0, i = 0; s < _spatial; ++s)
+                        for (size_t c = 0; c < _channels; ++c, ++i)
+                            UpdateMinMax(c, src[i]);
+                }
+                else
+                {
+                    for (size_t c = 0, i = 0; c < _channels; ++c)
+                        for (size_t s = 0; s < _spatial; ++s, ++i)
+                            UpdateMinMax(c, src[i]);
+                }
+            }
+            src -= size * batch;
+            for (size_t i = 0, n = size * batch; i < n; ++i)
+                absMax = std::max(absMax, std::fabs(src[i]));
+            Expand(absMax);
+            size_t bins = _hist.size();
+            float scale = _range > 0.0f ? bins / (2.0f * _range) : 0.0f;
+            for (size_t i = 0, n = size * batch; i < n; ++i)
+            {
+                size_t bin = _range > 0.0f ? (size_t)std::max((src[i] + _range) * scale, 0.0f) : bins / 2;
+                _hist[std::min(bin, bins - 1)]++;
+            }
+            _count += size * batch;
+        }
+
+        /*!
+            \short Gets number of accumulated values.
+
+            \return a number of accumulated values.
+        */
+        size_t Count() const
+        {
+            return _count;
+        }
+
+        /*!
+            \short Gets per-channel minimums.
+
+            \return a pointer to array with minimums (its size is equal to number of channels).
+        */
+        const float * Min() const
+        {
+            return _min.data();
+        }
+
+        /*!
+            \short Gets per-channel maximums.
+
+            \return a pointer to array with maximums (its size is equal to number of channels).
+        */
+        const float * Max() const
+        {
+            return _max.data();
+        }
+
+        /*!
+            \short Calculates quantization range of the tensor.
+
+            \param [in] method - a method of range calculation.
+            \param [out] lo - a lower bound of the range.
+            \param [out] hi - an upper bound of the range.
+            \param [in] percentile - a percentile for MethodPercentile (in percents).
+        */
+        void Range(Method method, float & lo, float & hi, float percentile = 99.99f) const
+        {
+            lo = _count ? *std::min_element(_min.begin(), _min.end()) : 0.0f;
+            hi = _count ? *std::max_element(_max.begin(), _max.end()) : 0.0f;
+            if (_count == 0 || _range == 0.0f || method == MethodMinMax)
+                return;
+            size_t bins = _hist.size();
+            float width = 2.0f * _range / bins;
+            if (method == MethodPercentile)
+            {
+                double tail = _count * (100.0 - percentile) / 100.0 / 2.0, sum = 0;
+                size_t l = 0, h = bins - 1;
+                for (sum = 0; l < bins && sum + _hist[l] <= tail; ++l)
+                    sum += _hist[l];
+                for (sum = 0; h > l && sum + _hist[h] <= tail; --h)
+                    sum += _hist[h];
+                lo = std::max(lo, -_range + l * width);
+                hi = std::min(hi, -_range + (h + 1) * width);
+            }
+            else if (method == MethodEntropy)
+            {
+                float threshold = EntropyThreshold(lo < 0.0f ? 128 : 256) * width;
+                lo = std::max(lo, -threshold);
+                hi = std::min(hi, threshold);
+            }
+        }
+
+        /*!
+            \short Gets per-channel statistics clipped by quantization range of the tensor.
+
+            \param [in] method - a method of range calculation.
+            \param [out] min - a pointer to output array with per-channel minimums.
+            \param [out] max - a pointer to output array with per-channel maximums.
+            \param [in] percentile - a percentile for MethodPercentile (in percents).
+        */
+        void Stats(Method method, float * min, float * max, float percentile = 99.99f) const
+        {
+            float lo, hi;
+            Range(method, lo, hi, percentile);
+            for (size_t c = 0; c < _channels; ++c)
+            {
+                min[c] = _count ? std::min(std::max(_min[c], lo), hi) : 0.0f;
+                max[c] = _count ? std::max(std::min(_max[c], hi), lo) : 0.0f;
+            }
+        }
+
+        /*!
+            \short Calculates UINT8 quantization parameters of the tensor: q = Round(x / scale) + zero.
+
+            \param [in] method - a method of range calculation.
+            \param [out] scale - a quantization scale (::SimdSynetQuantizeLinear uses norm = 1 / scale).
+            \param [out] zero - a quantization zero.
+            \param [in] percentile - a percentile for MethodPercentile (in percents).
+        */
+        void Quantization(Method method, float & scale, uint8_t & zero, float percentile = 99.99f) const
+        {
+            float lo, hi;
+            Range(method, lo, hi, percentile);
+            lo = std::min(lo, 0.0f);
+            hi = std::max(hi, 0.0f);
+            scale = hi > lo ? (hi - lo) / 255.0f : 1.0f;
+            zero = (uint8_t)std::min(std::max(std::round(-lo / scale), 0.0f), 255.0f);
+        }
+
+    private:
+        size_t _channels, _spatial;
+        SimdTensorFormatType _format;
+        std::vector<float> _min, _max;
+        std::vector<uint64_t> _hist;
+        float _range;
+        size_t _count;
+
+        void UpdateMinMax(size_t c, float value)
+        {
+            _min[c] = std::min(_min[c], value);
+            _max[c] = std::max(_max[c], value);
+        }
+
+        void Expand(float absMax)
+        {
+            if (absMax <= _range)
+                return;
+            if (_range == 0.0f)
+            {
+                if (_count == 0)
+                {
+                    _range = absMax;
+                    return;
+                }
+                _range = absMax;
+                size_t center = _hist[_hist.size() / 2];
+                std::fill(_hist.begin(), _hist.end(), 0);
+                _hist[_hist.size() / 2] = center;
+                return;
+            }
+            size_t bins = _hist.size();
+            while (_range < absMax)
+            {
+                std::vector<uint64_t> hist(bins, 0);
+                for (size_t i = 0; i < bins; ++i)
+                    hist[bins / 4 + i / 2] += _hist[i];
+                _hist.swap(hist);
+                _range *= 2.0f;
+            }
+        }
+
+        float EntropyThreshold(size_t levels) const
+        {
+            size_t half = _hist.size() / 2;
+            std::vector<double> abs(half, 0.0);
+            for (size_t i = 0; i < half; ++i)
+                abs[i] = double(_hist[half + i] + _hist[half - 1 - i]);
+            if (half <= levels)
+                return float(half);
+            size_t best = half;
+            double bestKl = DBL_MAX;
+            std::vector<double> p, q;
+            for (size_t size = levels; size <= half; ++size)
+            {
+                p.assign(abs.begin(), abs.begin() + size);
+                for (size_t i = size; i < half; ++i)
+                    p[size - 1] += abs[i];
+                q.assign(size, 0.0);
+                for (size_t l = 0; l < levels; ++l)
+                {
+                    size_t beg = l * size / levels, end = (l + 1) * size / levels, nonZero = 0;
+                    double sum = 0;
+                    for (size_t i = beg; i < end; ++i)
+                    {
+                        sum += abs[i];
+                        nonZero += abs[i] > 0 ? 1 : 0;
+                    }
+                    for (size_t i = beg; i < end && nonZero; ++i)
+                        q[i] = abs[i] > 0 ? sum / nonZero : 0.0;
+                }
+                double pSum = 0, qSum = 0;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    pSum += p[i];
+                    qSum += q[i];
+                }
+                if (pSum == 0 || qSum == 0)
+                    continue;
+                double kl = 0;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    if (p[i] == 0)
+                        continue;
+                    double pi = p[i] / pSum, qi = q[i] / qSum;
+                    kl += qi > 0 ? pi * ::log(pi / qi) : pi * ::log(pi / 1e-9);
+                }
+                if (kl < bestKl)
+                {
+                    bestKl = kl;
+                    best = size;
+                }
+            }
+            return float(best) + 0.5f;
+        }
+    };
+}
+
+#endif
@@ -29,6 +29,8 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdPerformance.h"
 
+#include <vector>
+
 namespace Simd
 {
     SIMD_INLINE bool IsKernel(const SimdConvolutionParameters& p, size_t value)
@@ -196,6 +198,15 @@ namespace Simd
             return batch * dstC * dstH * dstW;
         }
 
+        SIMD_INLINE bool Equal(const ConvParam& p) const
+        {
+            return srcC == p.srcC && srcH == p.srcH && srcW == p.srcW && srcT == p.srcT && srcF == p.srcF &&
+                dstC == p.dstC && dstH == p.dstH && dstW == p.dstW && dstT == p.dstT && dstF == p.dstF &&
+                kernelY == p.kernelY && kernelX == p.kernelX && dilationY == p.dilationY && dilationX == p.dilationX &&
+                strideY == p.strideY && strideX == p.strideX && padY == p.padY && padX == p.padX && padH == p.padH && padW == p.padW &&
+                group == p.group && activation == p.activation && trans == p.trans && batch == p.batch && compatibility == p.compatibility;
+        }
+
         SIMD_INLINE String Info(bool detail = false) const
         {
             std::stringstream ss;
@@ -292,6 +303,8 @@ namespace Simd
 
     //-------------------------------------------------------------------------------------------------
 
+    const int64_t SYNET_MERGED_CONVOLUTION_THREAD_FLOP_MIN = int64_t(256 * 256 * 256) * 2 * 2;
+
     struct MergConvParam
     {
         ConvParam conv[3];
@@ -395,6 +408,112 @@ namespace Simd
             return flop;
         }
     };
+
+    //-------------------------------------------------------------------------------------------------
+
+    typedef void (*SynetPoolingMax32fPtr)(const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelC, size_t kernelY, size_t kernelX,
+        size_t strideC, size_t strideY, size_t strideX, size_t padC, size_t padY, size_t padX, float* dst, size_t dstC, size_t dstH, size_t dstW, SimdTensorFormatType format);
+
+    typedef void (*SynetPoolingAverage32fPtr)(const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+        size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
+
+    struct ConvPoolParam
+    {
+        struct Band
+        {
+            ptrdiff_t srcY;
+            size_t dstY, dstH;
+            bool stage;
+        };
+
+        SimdSynetPoolingMethodType method;
+        size_t kernelY, kernelX, dstH, dstW, bandH;
+        SynetPoolingMax32fPtr poolingMax;
+        SynetPoolingAverage32fPtr poolingAverage;
+        std::vector<Band> bands;
+        SimdConvolutionParameters conv;
+        bool stage;
+
+        ConvPoolParam(const ConvParam& p, SimdSynetPoolingMethodType m, size_t ky, size_t kx, SynetPoolingMax32fPtr max, SynetPoolingAverage32fPtr average)
+            : method(m), kernelY(ky), kernelX(kx), dstH(0), dstW(0), bandH(0), poolingMax(max), poolingAverage(average), stage(false)
+        {
+            if (Valid(p))
+            {
+                dstH = DivHi(p.dstH, kernelY);
+                dstW = DivHi(p.dstW, kernelX);
+            }
+        }
+
+        bool Valid(const ConvParam& p) const
+        {
+            return (method == SimdSynetPoolingMethodMax || method == SimdSynetPoolingMethodAverage) &&
+                kernelY > 0 && kernelY <= p.dstH && kernelX > 0 && kernelX <= p.dstW;
+        }
+
+        void SetBands(const ConvParam& p, size_t bufSize)
+        {
+            size_t rowSize = p.dstW * p.dstC * sizeof(float);
+            bandH = Simd::Max(AlignLoAny(bufSize / rowSize, kernelY), kernelY);
+            bandH = Simd::Min(bandH, AlignHiAny(p.dstH, kernelY));
+            conv = p;
+            conv.srcH = (bandH - 1) * p.strideY + p.dilationY * (p.kernelY - 1) + 1;
+            conv.padY = 0;
+            conv.padH = 0;
+            conv.dstH = bandH;
+            bands.clear();
+            stage = false;
+            for (size_t dstY = 0; dstY < p.dstH; dstY += bandH)
+            {
+                Band band;
+                band.dstY = dstY;
+                band.dstH = Simd::Min(bandH, p.dstH - dstY);
+                band.srcY = ptrdiff_t(dstY * p.strideY) - ptrdiff_t(p.padY);
+                band.stage = !p.trans || band.srcY < 0 || band.srcY + conv.srcH > p.srcH;
+                stage = stage || band.stage;
+                bands.push_back(band);
+            }
+        }
+
+        void Stage(const uint8_t* src, const ConvParam& p, size_t elem, ptrdiff_t srcY, uint8_t* dst) const
+        {
+            size_t rowB = Simd::Max<ptrdiff_t>(-srcY, 0), rowE = Simd::Max<ptrdiff_t>(Simd::Min<ptrdiff_t>(conv.srcH, p.srcH - srcY), rowB);
+            size_t rowS = p.trans ? p.srcW * p.srcC * elem : p.srcW * elem, channels = p.trans ? 1 : p.srcC;
+            for (size_t c = 0; c < channels; ++c)
+            {
+                const uint8_t* ps = src + (c * p.srcH + srcY + rowB) * rowS;
+                uint8_t* pd = dst + c * conv.srcH * rowS;
+                memset(pd, 0, rowB * rowS);
+                memcpy(pd + rowB * rowS, ps, (rowE - rowB) * rowS);
+                memset(pd + rowE * rowS, 0, (conv.srcH - rowE) * rowS);
+            }
+        }
+
+        void Pool(const float* src, size_t channels, size_t srcH, size_t srcW, float* dst, SimdTensorFormatType format) const
+        {
+            size_t dH = DivHi(srcH, kernelY), dW = DivHi(srcW, kernelX);
+            if (method == SimdSynetPoolingMethodMax)
+                poolingMax(src, channels, srcH, srcW, 1, kernelY, kernelX, 1, kernelY, kernelX, 0, 0, 0, dst, channels, dH, dW, format);
+            else
+                poolingAverage(src, channels, srcH, srcW, kernelY, kernelX, kernelY, kernelX, 0, 0, dst, dH, dW, SimdTrue, format);
+        }
+
+        void Pool(float* band, const ConvParam& p, const Band& b, float* dst) const
+        {
+            if (!p.trans && b.dstH < bandH)
+            {
+                for (size_t c = 1; c < p.dstC; ++c)
+                    memmove(band + c * b.dstH * p.dstW, band + c * bandH * p.dstW, b.dstH * p.dstW * sizeof(float));
+            }
+            Pool(band, p.dstC, b.dstH, p.dstW, dst, p.trans ? SimdTensorFormatNhwc : SimdTensorFormatNchw);
+        }
+
+        String Info() const
+        {
+            std::stringstream ss;
+            ss << (method == SimdSynetPoolingMethodMax ? "max" : "avg") << kernelY << "x" << kernelX;
+            return ss.str();
+        }
+    };
 }
 
 #endif
@@ -0,0 +1,368 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetConverter_hpp__
+#define __SimdSynetConverter_hpp__
+
+#include "Simd/SimdAllocator.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+namespace Simd
+{
+    /*! @ingroup cpp_synet_network
+
+        \short The SynetConvolutionConverter class creates FP32, BF16 and INT8 convolution contexts from the same FP32 weights.
+
+        It takes FP32 weights, bias, activation parameters and calibration statistics (per-channel minimum and maximum of input
+        and output tensors, the same as in ::SimdSynetConvolution8iSetParams) and creates ready-to-use contexts:
+        - Precision32f - ::SimdSynetConvolution32fInit;
+        - Precision16b - ::SimdSynetConvolution16bInit (FP32 input and output, BF16 internal calculations);
+        - Precision8i - ::SimdSynetConvolution8iInit (FP32 input and output, INT8 internal calculations);
+        - Precision8u - ::SimdSynetQuantizedConvolutionInit (UINT8 input and output, INT8 weights with per-channel scales).
+            FP32 input is quantized and UINT8 output is dequantized with per-tensor scale and zero derived from statistics.
+            It is supported only for convolutions with identity activation.
+
+        Function Check() runs all contexts on sample input and measures maximal and mean absolute error against FP32 path,
+        function Select() chooses the lowest precision which satisfies given error threshold.
+
+        Using example:
+        \code
+        #include "Simd/SimdSynetConverter.hpp"
+
+        Simd::SynetConvolutionConverter converter(1, conv, weight, bias, params, stats);
+        converter.Check(sample);
+        Simd::SynetConvolutionConverter::Precision precision = converter.Select(0.01f);
+        std::cout << converter.Info(precision) << " : max error = " << converter.GetError(precision).max << std::endl;
+        converter.Forward(precision, src, NULL, dst);
+        \endcode
+    */
+    class SynetConvolutionConverter
+    {
+    public:
+        /*!
+            \enum Precision
+            Describes precision of internal calculations of convolution.
+        */
+        enum Precision
+        {
+            Precision32f, /*!< FP32 (reference). */
+            Precision16b, /*!< BF16 (SynetConvolution16b). */
+            Precision8i, /*!< INT8 with FP32 input and output (SynetConvolution8i). */
+            Precision8u, /*!< INT8 with UINT8 input and output (SynetQuantizedConvolution). */
+            PrecisionSize /*!< Number of precisions. */
+        };
+
+        /*!
+            \short Error of convolution in given precision against FP32 path.
+        */
+        struct Error
+        {
+            float max; /*!< \brief Maximal absolute error. */
+            float mean; /*!< \brief Mean absolute error. */
+            bool checked; /*!< \brief Flag that the error was measured. */
+            Error() : max(0), mean(0), checked(false) {}
+        };
+
+        /*!
+            \short Creates converter and all convolution contexts which are supported for given parameters.
+
+            \param [in] batch - a batch size.
+            \param [in] conv - convolution parameters. Input and output types are ignored (FP32 is used).
+            \param [in] weight - a pointer to FP32 convolution weights.
+            \param [in] bias - a pointer to FP32 bias. Can be NULL.
+            \param [in] params - a pointer to FP32 parameters of activation function. Can be NULL.
+            \param [in] stats - a pointer to pointers with per-channel statistics: source minimum stats[0], source maximum stats[1],
+                destination minimum stats[2], destination maximum stats[3]. If it is NULL then INT8 contexts are not created.
+            \param [in] compatibility - calculation compatibility flags for BF16 and INT8 contexts.
+        */
+        SynetConvolutionConverter(size_t batch, const SimdConvolutionParameters & conv, const float * weight, const float * bias, const float * params,
+            const float * const * stats, SimdSynetCompatibilityType compatibility = SimdSynetCompatibility16bfSoft)
+            : _batch(batch)
+            , _conv(conv)
+            , _weight(weight, weight + conv.kernelY * conv.kernelX * conv.srcC / conv.group * conv.dstC)
+        {
+            _conv.srcT = SimdTensorData32f;
+            _conv.dstT = SimdTensorData32f;
+            if (bias)
+                _bias.assign(bias, bias + conv.dstC);
+            if (params)
+                _params.assign(params, params + (conv.activation == SimdConvolutionActivationPrelu ? conv.dstC : 2));
+            for (size_t i = 0; i < PrecisionSize; ++i)
+                _context[i] = NULL;
+
+            _context[Precision32f] = SimdSynetConvolution32fInit(_batch, &_conv);
+            if (_context[Precision32f])
+                SimdSynetConvolution32fSetParams(_context[Precision32f], _weight.data(), NULL,
+                    bias ? _bias.data() : NULL, params ? _params.data() : NULL);
+
+            _context[Precision16b] = SimdSynetConvolution16bInit(_batch, &_conv, compatibility);
+            if (_context[Precision16b])
+                SimdSynetConvolution16bSetParams(_context[Precision16b], weight, bias, params);
+
+            if (stats)
+            {
+                _context[Precision8i] = SimdSynetConvolution8iInit(_batch, &_conv, compatibility);
+                if (_context[Precision8i])
+                    SimdSynetConvolution8iSetParams(_context[Precision8i], weight, bias, params, stats);
+
+                if (_conv.activation == SimdConvolutionActivationIdentity)
+                    InitQuantized(weight, bias, params, stats);
+            }
+        }
+
+        /*!
+            \short Releases all created contexts.
+        */
+        ~SynetConvolutionConverter()
+        {
+            for (size_t i = 0; i < PrecisionSize; ++i)
+                if (_context[i])
+                    SimdRelease(_context[i]);
+        }
+
+        /*!
+            \short Checks if context of given precision was created.
+
+            \param [in] precision - a precision of context.
+            \return true if context exists.
+        */
+        bool Enable(Precision precision) const
+        {
+            return _context[precision] != NULL;
+        }
+
+        /*!
+            \short Gets context of given precision. It can be used directly with corresponding Synet functions.
+
+            \param [in] precision - a precision of context.
+            \return a pointer to context or NULL. The context is owned by converter.
+        */
+        void * Context(Precision precision) const
+        {
+            return _context[precision];
+        }
+
+        /*!
+            \short Gets description of internal implementation of context of given precision.
+
+            \param [in] precision - a precision of context.
+            \return a string with description.
+        */
+        const char * Info(Precision precision) const
+        {
+            switch (precision)
+            {
+            case Precision32f: return _context[precision] ? SimdSynetConvolution32fInfo(_context[precision]) : "";
+            case Precision16b: return _context[precision] ? SimdSynetConvolution16bInfo(_context[precision]) : "";
+            case Precision8i: return _context[precision] ? SimdSynetConvolution8iInfo(_context[precision]) : "";
+            case Precision8u: return _context[precision] ? SimdSynetQuantizedConvolutionInfo(_context[precision]) : "";
+            default: return "";
+            }
+        }
+
+        /*!
+            \short Gets size of external temporary buffer required by Forward() for given precision.
+
+            \param [in] precision - a precision of context.
+            \return a size of external temporary buffer (in bytes).
+        */
+        size_t ExternalBufferSize(Precision precision) const
+        {
+            if (_context[precision] == NULL)
+                return 0;
+            switch (precision)
+            {
+            case Precision32f: return SimdSynetConvolution32fExternalBufferSize(_context[precision]) * sizeof(float);
+            case Precision16b: return SimdSynetConvolution16bExternalBufferSize(_context[precision]);
+            case Precision8i: return SimdSynetConvolution8iExternalBufferSize(_context[precision]);
+            case Precision8u: return SimdSynetQuantizedConvolutionExternalBufferSize(_context[precision]);
+            default: return 0;
+            }
+        }
+
+        /*!
+            \short Performs forward propagation of convolution in given precision. Input and output are always FP32.
+
+            \param [in] precision - a precision of context. The context must exist.
+            \param [in] src - a pointer to FP32 input tensor.
+            \param [out] buf - a pointer to external temporary buffer. Can be NULL.
+            \param [out] dst - a pointer to FP32 output tensor.
+        */
+        void Forward(Precision precision, const float * src, uint8_t * buf, float * dst)
+        {
+            void * context = _context[precision];
+            switch (precision)
+            {
+            case Precision32f:
+                SimdSynetConvolution32fForward(context, src, (float*)buf, dst);
+                break;
+            case Precision16b:
+                SimdSynetConvolution16bForward(context, (const uint8_t*)src, buf, (uint8_t*)dst);
+                break;
+            case Precision8i:
+                SimdSynetConvolution8iForward(context, (const uint8_t*)src, buf, (uint8_t*)dst);
+                break;
+            case Precision8u:
+                _src8u.resize(SrcSize());
+                _dst8u.resize(DstSize());
+                SimdSynetQuantizeLinear(src, _src8u.size(), &_srcNorm, _ioZero[0], _src8u.data());
+                SimdSynetQuantizedConvolutionForward(context, _src8u.data(), buf, _dst8u.data());
+                SimdSynetDequantizeLinear(_dst8u.data(), _dst8u.size(), -_ioZero[2], _ioScale + 2, dst);
+                break;
+            default:
+                break;
+            }
+        }
+
+        /*!
+            \short Measures errors of all created contexts against FP32 path on sample input.
+
+            \param [in] src - a pointer to FP32 sample input tensor (batch*srcC*srcH*srcW elements).
+        */
+        void Check(const float * src)
+        {
+            if (_context[Precision32f] == NULL)
+                return;
+            std::vector<float> control(DstSize()), dst(DstSize());
+            Forward(Precision32f, src, NULL, control.data());
+            _error[Precision32f].checked = true;
+            for (int p = Precision16b; p < PrecisionSize; ++p)
+            {
+                if (_context[p] == NULL)
+                    continue;
+                Forward((Precision)p, src, NULL, dst.data());
+                Error & error = _error[p];
+                double sum = 0;
+                error.max = 0;
+                for (size_t i = 0; i < dst.size(); ++i)
+                {
+                    float diff = std::fabs(dst[i] - control[i]);
+                    error.max = std::max(error.max, diff);
+                    sum += diff;
+                }
+                error.mean = dst.size() ? float(sum / dst.size()) : 0.0f;
+                error.checked = true;
+            }
+        }
+
+        /*!
+            \short Gets error of context of given precision measured by function Check().
+
+            \param [in] precision - a precision of context.
+            \return an error against FP32 path.
+        */
+        const Error & GetError(Precision precision) const
+        {
+            return _error[precision];
+        }
+
+        /*!
+            \short Selects the lowest precision with measured maximal error not greater than given threshold.
+
+            \param [in] threshold - a threshold of maximal absolute error.
+            \return a selected precision (Precision32f if no one other satisfies the threshold).
+        */
+        Precision Select(float threshold) const
+        {
+            for (int p = PrecisionSize - 1; p > Precision32f; --p)
+                if (_context[p] && _error[p].checked && _error[p].max <= threshold)
+                    return (Precision)p;
+            return Precision32f;
+        }
+
+    private:
+        size_t _batch;
+        SimdConvolutionParameters _conv;
+        std::vector<float> _weight, _bias, _params;
+        void * _context[PrecisionSize];
+        Error _error[PrecisionSize];
+        float _ioScale[3], _srcNorm;
+        uint8_t _ioZero[3];
+        std::vector<uint8_t, Allocator<uint8_t>> _src8u, _dst8u;
+
+        size_t SrcSize() const
+        {
+            return _batch * _conv.srcC * _conv.srcH * _conv.srcW;
+        }
+
+        size_t DstSize() const
+        {
+            return _batch * _conv.dstC * _conv.dstH * _conv.dstW;
+        }
+
+        static void Quantization(const float * min, const float * max, size_t size, float & scale, uint8_t & zero)
+        {
+            float lo = 0.0f, hi = 0.0f;
+            for (size_t i = 0; i < size; ++i)
+            {
+                lo = std::min(lo, min[i]);
+                hi = std::max(hi, max[i]);
+            }
+            scale = hi > lo ? (hi - lo) / 255.0f : 1.0f;
+            zero = (uint8_t)std::min(std::max(std::round(-lo / scale), 0.0f), 255.0f);
+        }
+
+        void InitQuantized(const float * weight, const float * bias, const float * params, const float * const * stats)
+        {
+            SimdConvolutionParameters conv = _conv;
+            conv.srcT = SimdTensorData8u;
+            conv.dstT = SimdTensorData8u;
+            _context[Precision8u] = SimdSynetQuantizedConvolutionInit(_batch, &conv);
+            if (_context[Precision8u] == NULL)
+                return;
+
+            Quantization(stats[0], stats[1], _conv.srcC, _ioScale[0], _ioZero[0]);
+            Quantization(stats[2], stats[3], _conv.dstC, _ioScale[2], _ioZero[2]);
+            _ioScale[1] = _ioScale[2];
+            _ioZero[1] = _ioZero[2];
+            _srcNorm = 1.0f / _ioScale[0];
+
+            size_t dstC = _conv.dstC, size = _conv.kernelY * _conv.kernelX * _conv.srcC / _conv.group * dstC;
+            bool trans = _conv.srcF == SimdTensorFormatNhwc;
+            std::vector<float> weightScale(dstC, 0.0f);
+            for (size_t i = 0; i < size; ++i)
+            {
+                size_t c = trans ? i % dstC : i / (size / dstC);
+                weightScale[c] = std::max(weightScale[c], std::fabs(weight[i]));
+            }
+            for (size_t c = 0; c < dstC; ++c)
+                weightScale[c] = weightScale[c] > 0.0f ? weightScale[c] / 127.0f : 1.0f;
+            std::vector<int8_t> weight8i(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                size_t c = trans ? i % dstC : i / (size / dstC);
+                weight8i[i] = (int8_t)std::min(std::max(std::round(weight[i] / weightScale[c]), -127.0f), 127.0f);
+            }
+            std::vector<int32_t> bias32i(dstC, 0);
+            for (size_t c = 0; bias && c < dstC; ++c)
+                bias32i[c] = (int32_t)std::round(bias[c] / (_ioScale[0] * weightScale[c]));
+
+            SimdSynetQuantizedConvolutionSetParams(_context[Precision8u], _ioScale, _ioZero, weight8i.data(), weightScale.data(), bias32i.data(), params);
+        }
+    };
+}
+
+#endif
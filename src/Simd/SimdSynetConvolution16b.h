@@ -28,10 +28,17 @@
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdSynetConvParam.h"
+#include "Simd/SimdSynetInnerProduct16b.h"
 #include "Simd/SimdGemm.h"
 
+#include <map>
+
 namespace Simd
 {
+    const int64_t SYNET_CONVOLUTION_16B_THREAD_FLOP_MIN = int64_t(256 * 256 * 256) * 2 * 2;
+
+    //-------------------------------------------------------------------------------------------------
+
     class SynetConvolution16b : public Deletable
     {
     public:
@@ -60,6 +67,17 @@ namespace Simd
 
         virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst) = 0;
 
+        virtual bool Reshape(size_t batch, size_t srcH, size_t srcW)
+        {
+            return batch == _param.batch && srcH == _param.srcH && srcW == _param.srcW;
+        }
+
+        virtual bool Share(const SynetConvolution16b& other);
+
+        virtual size_t Export(uint8_t* blob, size_t size) const;
+
+        virtual bool Import(const uint8_t* blob, size_t size);
+
         uint8_t* Buffer(uint8_t* buffer)
         {
             if (buffer)
@@ -89,10 +107,10 @@ namespace Simd
         Base::PerformanceMeasurer* _perf;
 #endif
         mutable String _info;
-        Array16u _weight;
+        SharedArray16u _weight;
         Array32f _bias, _params;
         bool _src16b, _dst16b, _is1x1;
-        size_t _elemS, _elemD, _stepS, _stepD;
+        size_t _elemS, _elemD, _stepS, _stepD, _threadNumber;
 
         void SetBias(const float* bias, size_t align);
         void SetParams(const float* params, size_t align);
@@ -152,7 +170,7 @@ namespace Simd
         protected:
             void SetAlgParam(size_t F, size_t microD, size_t microM, size_t microK, size_t L1, size_t L2, size_t L3);
             virtual void SetWeight(const float* weight);
-            void Forward(const uint8_t* src, uint16_t* buf, float* sum, uint8_t* dst);
+            void Forward(const uint8_t* src, uint16_t* buf, float* sum, uint8_t* dst, size_t begin, size_t end);
 
             AlgParam _alg;
             ConvertPtr _convert;
@@ -196,8 +214,8 @@ namespace Simd
             static bool CanInv2x2_old(const ConvParam& p);
             void SetAlgParam();
             virtual void SetWeight(const float* weight);
-            void ForwardDir(const uint8_t* src, uint16_t* buf, float* sum, uint8_t* dst);
-            void ForwardInv(const uint8_t* src, uint16_t* buf, float* sum, uint8_t* dst);
+            void ForwardDir(const uint8_t* src, uint16_t* buf, float* sum, uint8_t* dst, size_t begin, size_t end);
+            void ForwardInv(const uint8_t* src, uint16_t* buf, float* sum, uint8_t* dst, size_t begin, size_t end);
 
             AlgParam _alg;
             ConvertPtr _convert;
@@ -430,6 +448,9 @@ namespace Simd
             virtual String Desc() const;
             virtual size_t InternalBufferSize() const;
             virtual void SetParams(const float* weight, const float* bias, const float* params);
+            virtual bool Share(const SynetConvolution16b& other);
+            virtual size_t Export(uint8_t* blob, size_t size) const;
+            virtual bool Import(const uint8_t* blob, size_t size);
 
             virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
 
@@ -483,6 +504,126 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class SynetConvolution16bNhwcWinograd : public SynetConvolution16b
+        {
+        public:
+            SynetConvolution16bNhwcWinograd(const ConvParam& p);
+            virtual ~SynetConvolution16bNhwcWinograd();
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const;
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float* weight, const float* bias, const float* params);
+            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
+            virtual bool Share(const SynetConvolution16b& other) { return false; }
+            virtual size_t Export(uint8_t* blob, size_t size) const { return 0; }
+            virtual bool Import(const uint8_t* blob, size_t size) { return false; }
+
+            static bool Preferable(const ConvParam& p);
+
+            typedef void(*SetFilterPtr)(const float* src, size_t size, float* dst, SimdBool trans);
+            typedef void(*SetInputPtr)(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth, size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
+            typedef void(*SetOutputPtr)(const float* src, size_t srcStride, float* dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
+            typedef void(*BiasAndActivationPtr)(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, ::SimdBool trans, float* dst);
+            typedef void(*BFloat16ToFloat32Ptr)(const uint16_t* src, size_t size, float* dst);
+            typedef void(*Float32ToBFloat16Ptr)(const float* src, size_t size, uint16_t* dst);
+
+        protected:
+            void SetBlock(size_t blockY, size_t blockX);
+            void SetGemm(SynetInnerProduct16bInitPtr init);
+            void Release();
+            size_t GemmBufferSize() const;
+
+            size_t _blockY, _blockX, _count, _tileH, _tileW, _M, _merge, _sizeS, _sizeD, _strideS, _strideD;
+            std::vector<SynetInnerProduct16b*> _gemms;
+            SetFilterPtr _setFilter;
+            SetInputPtr _setInput;
+            SetOutputPtr _setOutput;
+            BiasAndActivationPtr _biasAndActivation;
+            BFloat16ToFloat32Ptr _bFloat16ToFloat32;
+            Float32ToBFloat16Ptr _float32ToBFloat16;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        typedef void* (*SynetConvolution16bInitPtr)(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+
+        class SynetConvolution16bDynamic : public SynetConvolution16b
+        {
+        public:
+            SynetConvolution16bDynamic(SynetConvolution16b* conv, SynetConvolution16bInitPtr init);
+            virtual ~SynetConvolution16bDynamic();
+            virtual String Ext() const { return _conv->Ext(); }
+            virtual String Desc() const { return _conv->Desc() + "-d"; }
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float* weight, const float* bias, const float* params);
+            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
+            virtual bool Reshape(size_t batch, size_t srcH, size_t srcW);
+            virtual bool Share(const SynetConvolution16b& other);
+            virtual size_t Export(uint8_t* blob, size_t size) const { return 0; }
+            virtual bool Import(const uint8_t* blob, size_t size) { return false; }
+
+        protected:
+            struct Shape
+            {
+                size_t batch, srcH, srcW;
+                Shape(size_t b, size_t h, size_t w) : batch(b), srcH(h), srcW(w) {}
+                bool operator < (const Shape& s) const
+                {
+                    return batch < s.batch || (batch == s.batch && (srcH < s.srcH || (srcH == s.srcH && srcW < s.srcW)));
+                }
+            };
+            struct Conv
+            {
+                SynetConvolution16b* conv;
+                size_t used;
+                Conv(SynetConvolution16b* c = NULL, size_t u = 0) : conv(c), used(u) {}
+            };
+            typedef std::map<Shape, Conv> Convs;
+            static const size_t CAPACITY = 8;
+
+            SynetConvolution16bInitPtr _init;
+            Convs _convs;
+            SynetConvolution16b* _conv;
+            size_t _used;
+            const float* _weightF, * _biasF, * _paramsF;
+        };
+
+        void* SynetConvolution16bInitDynamic(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility, SynetConvolution16bInitPtr init);
+
+        //-------------------------------------------------------------------------------------------------
+
+        typedef void (*Float32ToBFloat16Ptr)(const float* src, size_t size, uint16_t* dst);
+
+        class SynetConvolution16bPooled : public SynetConvolution16b
+        {
+        public:
+            SynetConvolution16bPooled(const ConvParam& p, const ConvPoolParam& pool, SynetConvolution16b* conv, Float32ToBFloat16Ptr toBf16);
+            virtual ~SynetConvolution16bPooled();
+            virtual String Ext() const { return _conv->Ext(); }
+            virtual String Desc() const { return _conv->Desc() + "-" + _pool.Info(); }
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float* weight, const float* bias, const float* params);
+            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
+            virtual bool Share(const SynetConvolution16b& other) { return false; }
+            virtual size_t Export(uint8_t* blob, size_t size) const { return 0; }
+            virtual bool Import(const uint8_t* blob, size_t size) { return false; }
+
+        protected:
+            ConvPoolParam _pool;
+            SynetConvolution16b* _conv;
+            Float32ToBFloat16Ptr _toBf16;
+            size_t _sizeB, _sizeS, _sizeP;
+        };
+
+        void* SynetConvolution16bInitPooled(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility, 
+            SimdSynetPoolingMethodType method, size_t kernelY, size_t kernelX, SynetConvolution16bInitPtr init, 
+            SynetPoolingMax32fPtr poolingMax, SynetPoolingAverage32fPtr poolingAverage, Float32ToBFloat16Ptr toBf16);
+
+        //-------------------------------------------------------------------------------------------------
+
         void* SynetConvolution16bInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
     }
 
@@ -529,6 +670,14 @@ namespace Simd
             virtual String Ext() const { return "Sse41"; }
         };
 
+        class SynetConvolution16bNhwcWinograd : public Base::SynetConvolution16bNhwcWinograd
+        {
+        public:
+            SynetConvolution16bNhwcWinograd(const ConvParam& p);
+
+            virtual String Ext() const { return "Sse41"; }
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         void* SynetConvolution16bInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
@@ -578,6 +727,14 @@ namespace Simd
             virtual String Ext() const { return "Avx2"; }
         };
 
+        class SynetConvolution16bNhwcWinograd : public Sse41::SynetConvolution16bNhwcWinograd
+        {
+        public:
+            SynetConvolution16bNhwcWinograd(const ConvParam& p);
+
+            virtual String Ext() const { return "Avx2"; }
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         void* SynetConvolution16bInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
@@ -627,6 +784,14 @@ namespace Simd
             virtual String Ext() const { return "Avx512bw"; }
         };
 
+        class SynetConvolution16bNhwcWinograd : public Avx2::SynetConvolution16bNhwcWinograd
+        {
+        public:
+            SynetConvolution16bNhwcWinograd(const ConvParam& p);
+
+            virtual String Ext() const { return "Avx512bw"; }
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         void* SynetConvolution16bInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
@@ -708,6 +873,14 @@ namespace Simd
             virtual String Ext() const { return "AmxBf16"; }
         };
 
+        class SynetConvolution16bNhwcWinograd : public Avx512bw::SynetConvolution16bNhwcWinograd
+        {
+        public:
+            SynetConvolution16bNhwcWinograd(const ConvParam& p);
+
+            virtual String Ext() const { return "AmxBf16"; }
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         void* SynetConvolution16bInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
@@ -29,6 +29,8 @@
 #include "Simd/SimdGemm.h"
 #include "Simd/SimdSynetConvParam.h"
 
+#include <map>
+
 #ifdef _N
 #undef _N
 #endif
@@ -41,6 +43,7 @@ namespace Simd
 #else
     const bool NHWC_GEMM_RUNTIME = true;
 #endif
+    const int64_t SYNET_CONVOLUTION_32F_THREAD_FLOP_MIN = int64_t(256 * 256 * 256) * 2 * 2;
 
     //-------------------------------------------------------------------------------------------------
 
@@ -54,6 +57,7 @@ namespace Simd
             , _nhwcRun(0)
             , _nhwcReorderB(0)
             , _biasAndActivation(0)
+            , _threadNumber(p.Flop() < SYNET_CONVOLUTION_32F_THREAD_FLOP_MIN ? 1 : Base::GetThreadNumber())
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
             , _perf(NULL)
 #endif
@@ -89,6 +93,11 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        virtual bool Reshape(size_t batch, size_t srcH, size_t srcW)
+        {
+            return batch == _param.batch && srcH == _param.srcH && srcW == _param.srcW;
+        }
+
         float * Buffer(float * buffer)
         {
             if (buffer)
@@ -130,6 +139,12 @@ namespace Simd
         NhwcRun _nhwcRun;
         NhwcReorderB _nhwcReorderB;
         BiasAndActivation _biasAndActivation;
+        size_t _threadNumber;
+
+        bool GemmReady() const
+        {
+            return _nhwcWeight.data ? (_gemmCb.Size() == 0 || _gemmCb.Ready()) : _gemm.Ready();
+        }
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer * _perf;
 #endif
@@ -158,8 +173,9 @@ namespace Simd
             virtual void ImgToCol(const float * src, float * dst);
             virtual void ImgToRow(const float * src, float * dst);
             bool GemmRuntime() const;
+            void GemmRows(const float * src, size_t M, float * dst);
 
-            bool _skipConv;
+            bool _skipConv, _nhwcCompatible;
             size_t _M, _N, _K, _ldW, _ldS, _ldD, _grW, _grS, _grD, _batch, _sizeS, _sizeB, _sizeD, _merge;
         };
 
@@ -175,6 +191,7 @@ namespace Simd
             virtual void Forward(const float * src, float * buf, float * dst);
 
             static bool Preferable(const ConvParam & p);
+            static bool Applicable(const ConvParam & p);
 
         protected:
             static void ImgToRow(const float * src, const ConvParam & p, float * dst);
@@ -196,6 +213,7 @@ namespace Simd
             virtual void Forward(const float * src, float * buf, float * dst);
 
             static bool Preferable(const ConvParam & p);
+            static bool Applicable(const ConvParam & p);
 
         protected:
             typedef void(*SetFilter)(const float * src, size_t size, float * dst, SimdBool trans);
@@ -205,6 +223,8 @@ namespace Simd
             void SetBlock(size_t blockY, size_t blockX);
             void ForwardMerged(const float * src, float * bufS, float * bufD, float * dst);
             void ForwardSplitted(const float * src, float * bufS, float * bufD, float * dst);
+            void ForwardSplit(const float* src, size_t s, float* bufS, float* bufD, float* dst);
+            void Gemm(size_t i, size_t M, const float* bufS, float* bufD);
 #ifdef SIMD_PERFORMANCE_STATISTIC
             long long RealFlop() const
             {
@@ -231,6 +251,7 @@ namespace Simd
             virtual void Forward(const float * src, float * buf, float * dst);
 
             static bool Preferable(const ConvParam & p);
+            static bool Applicable(const ConvParam & p);
 
             typedef void(*ConvolutionBiasActivationPtr)(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * weight, const float * bias, const float * params, float * dst, size_t dstC, size_t dstH, size_t dstW);
         protected:
@@ -253,6 +274,7 @@ namespace Simd
             virtual void Forward(const float * src, float * buf, float * dst);
 
             static bool Preferable(const ConvParam & p);
+            static bool Applicable(const ConvParam & p);
 
             typedef void(*ConvolutionPtr)(const float * src, const ConvParam & p, const float * weight, const float * bias, const float * params, float * dst);
         protected:
@@ -272,6 +294,7 @@ namespace Simd
             virtual void Forward(const float * src, float * buf, float * dst);
 
             static bool Preferable(const ConvParam & p);
+            static bool Applicable(const ConvParam & p);
 
         protected:
             size_t _count, _size, _batch, _sizeS, _sizeD;
@@ -289,6 +312,7 @@ namespace Simd
             virtual void Forward(const float* src, float* buf, float* dst);
 
             static bool Preferable(const ConvParam& p);
+            static bool Applicable(const ConvParam& p);
 
             typedef void(*ConvolutionPtr)(const float* src, const ConvParam& p, const float* weight, const float* bias, const float* params, float* dst);
 
@@ -311,6 +335,7 @@ namespace Simd
             virtual void Forward(const float * src, float * buf, float * dst);
 
             static bool Preferable(const ConvParam & p);
+            static bool Applicable(const ConvParam & p);
 
             struct AlgParam;
 
@@ -330,13 +355,14 @@ namespace Simd
             size_t _sizeS, _sizeD;
             Array32f _rWeight, _rBias, _rParams;
 
-            static void Forward(const float* src, const ConvParam& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst);
+            static void Forward(const float* src, const ConvParam& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst, size_t threads);
+            static void Forward(const float* src, const ConvParam& p, const AlgParam& a, size_t yBeg, size_t yEnd, const float* weight, const float* bias, const float* params, float* dst);
 
             struct RunArgs
             {
-                const float* src; const ConvParam& p; const float* weight; const float* bias; const float* params; float* dst;
-                SIMD_INLINE RunArgs(const float* src_, const ConvParam& p_, const float* weight_, const float* bias_, const float* params_, float* dst_)
-                    :src(src_), p(p_), weight(weight_), bias(bias_), params(params_), dst(dst_)
+                const float* src; const ConvParam& p; const float* weight; const float* bias; const float* params; float* dst; size_t threads;
+                SIMD_INLINE RunArgs(const float* src_, const ConvParam& p_, const float* weight_, const float* bias_, const float* params_, float* dst_, size_t threads_)
+                    :src(src_), p(p_), weight(weight_), bias(bias_), params(params_), dst(dst_), threads(threads_)
                 {}
             };
 
@@ -351,17 +377,15 @@ namespace Simd
 
                 SIMD_INLINE void Run(const RunArgs& args)
                 {
-                    Forward(args.src, args.p, alg, args.weight, args.bias, args.params, args.dst);
+                    Forward(args.src, args.p, alg, args.weight, args.bias, args.params, args.dst, args.threads);
                 }
 
-#ifdef SIMD_RUNTIME_STATISTIC
                 SIMD_INLINE String Info(const RunArgs& args) const
                 {
                     std::stringstream ss;
                     ss << "NhwcDirect [" << args.p.Info() << "]";
                     return ss.str();
                 }
-#endif
 
                 AlgParam alg;
             private:
@@ -387,6 +411,142 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class SynetConvolution32fTuned : public SynetConvolution32f
+        {
+        public:
+            typedef std::vector<SynetConvolution32f*> Convs;
+
+            SynetConvolution32fTuned(const ConvParam& p, const Convs& convs);
+            virtual ~SynetConvolution32fTuned();
+            virtual String Ext() const { return _ext; }
+            virtual String Desc() const;
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params);
+            virtual void Forward(const float* src, float* buf, float* dst);
+
+            static void* Create(const ConvParam& p, const Convs& convs);
+
+            template<class Conv> static SIMD_INLINE void Add(const ConvParam& p, Convs& convs)
+            {
+                if (Conv::Applicable(p))
+                    convs.push_back(new Conv(p));
+            }
+
+        protected:
+            struct RunArgs
+            {
+                const float* src; float* buf; float* dst; const ConvParam& p;
+                SIMD_INLINE RunArgs(const float* src_, float* buf_, float* dst_, const ConvParam& p_)
+                    :src(src_), buf(buf_), dst(dst_), p(p_)
+                {}
+            };
+
+            struct RunFunc
+            {
+                SIMD_INLINE RunFunc(SynetConvolution32f* conv)
+                    : _conv(conv)
+                    , _name(conv->Desc())
+                {
+                }
+
+                SIMD_INLINE const String& Name() const { return _name; }
+
+                SIMD_INLINE SynetConvolution32f* Conv() const { return _conv; }
+
+                SIMD_INLINE void Run(const RunArgs& args)
+                {
+                    _conv->Forward(args.src, args.buf, args.dst);
+                }
+
+                SIMD_INLINE String Info(const RunArgs& args) const
+                {
+                    std::stringstream ss;
+                    ss << "SynetConvolution32f [" << args.p.Info() << "]";
+                    return ss.str();
+                }
+
+            private:
+                SynetConvolution32f* _conv;
+                String _name;
+            };
+            typedef std::vector<RunFunc> RunFuncs;
+
+            Convs _convs;
+            Runtime<RunFunc, RunArgs> _run;
+            SynetConvolution32f* _best;
+            String _ext;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        typedef void* (*SynetConvolution32fInitPtr)(size_t batch, const SimdConvolutionParameters* conv);
+
+        class SynetConvolution32fDynamic : public SynetConvolution32f
+        {
+        public:
+            SynetConvolution32fDynamic(SynetConvolution32f* conv, SynetConvolution32fInitPtr init);
+            virtual ~SynetConvolution32fDynamic();
+            virtual String Ext() const { return _conv->Ext(); }
+            virtual String Desc() const { return _conv->Desc() + "-d"; }
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params);
+            virtual void Forward(const float* src, float* buf, float* dst);
+            virtual bool Reshape(size_t batch, size_t srcH, size_t srcW);
+
+        protected:
+            struct Shape
+            {
+                size_t batch, srcH, srcW;
+                Shape(size_t b, size_t h, size_t w) : batch(b), srcH(h), srcW(w) {}
+                bool operator < (const Shape& s) const
+                {
+                    return batch < s.batch || (batch == s.batch && (srcH < s.srcH || (srcH == s.srcH && srcW < s.srcW)));
+                }
+            };
+            struct Conv
+            {
+                SynetConvolution32f* conv;
+                size_t used;
+                Conv(SynetConvolution32f* c = NULL, size_t u = 0) : conv(c), used(u) {}
+            };
+            typedef std::map<Shape, Conv> Convs;
+            static const size_t CAPACITY = 8;
+
+            SynetConvolution32fInitPtr _init;
+            Convs _convs;
+            SynetConvolution32f* _conv;
+            size_t _used;
+        };
+
+        void* SynetConvolution32fInitDynamic(size_t batch, const SimdConvolutionParameters* conv, SynetConvolution32fInitPtr init);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class SynetConvolution32fPooled : public SynetConvolution32f
+        {
+        public:
+            SynetConvolution32fPooled(const ConvParam& p, const ConvPoolParam& pool, SynetConvolution32f* conv);
+            virtual ~SynetConvolution32fPooled();
+            virtual String Ext() const { return _conv->Ext(); }
+            virtual String Desc() const { return _conv->Desc() + "-" + _pool.Info(); }
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params);
+            virtual void Forward(const float* src, float* buf, float* dst);
+
+        protected:
+            ConvPoolParam _pool;
+            SynetConvolution32f* _conv;
+            size_t _sizeB, _sizeS, _sizeP;
+        };
+
+        void* SynetConvolution32fInitPooled(size_t batch, const SimdConvolutionParameters* conv, SimdSynetPoolingMethodType method, size_t kernelY, size_t kernelX,
+            SynetConvolution32fInitPtr init, SynetPoolingMax32fPtr poolingMax, SynetPoolingAverage32fPtr poolingAverage);
+
+        //-------------------------------------------------------------------------------------------------
+
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv);
     }
 
@@ -457,6 +617,7 @@ namespace Simd
             virtual String Ext() const { return "Sse41"; }
 
             static bool Preferable(const ConvParam& p);
+            static bool Applicable(const ConvParam& p);
         private:
             static bool Set2f(const ConvParam& p, OldConvolutionPtr& convolution);
             static bool SetRt(const ConvParam& p, AlgParam& a);
@@ -595,6 +756,7 @@ namespace Simd
             virtual String Ext() const { return "Avx512bw"; }
 
             static bool Preferable(const ConvParam& p);
+            static bool Applicable(const ConvParam& p);
 
         protected:
             virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
@@ -698,6 +860,7 @@ namespace Simd
             virtual String Ext() const { return "Neon"; }
 
             static bool Preferable(const ConvParam & p);
+            static bool Applicable(const ConvParam & p);
         private:
             static bool Set2f(const ConvParam& p, OldConvolutionPtr& convolution);
             static bool SetRt(const ConvParam& p, AlgParam& a);
@@ -34,6 +34,8 @@
 
 namespace Simd
 {
+    const int64_t SYNET_CONVOLUTION_8I_THREAD_FLOP_MIN = int64_t(256 * 256 * 256) * 2 * 2;
+
     struct CvtParam
     {
         Array8u zero;
@@ -48,6 +50,20 @@ namespace Simd
 
         void Init(const float* min, const float* max, size_t size, SimdSynetCompatibilityType compatibility);
 
+        void Assign(const CvtParam& other)
+        {
+            zero.Assign(other.zero.data, other.zero.size);
+            scale.Assign(other.scale.data, other.scale.size);
+            shift.Assign(other.shift.data, other.shift.size);
+            iScale.Assign(other.iScale.data, other.iScale.size);
+            iShift.Assign(other.iShift.data, other.iShift.size);
+            neg = other.neg;
+            iMin = other.iMin;
+            iMax = other.iMax;
+            uMin = other.uMin;
+            uMax = other.uMax;
+        }
+
         size_t Size() const
         {
             return (zero.size) * sizeof(uint8_t) + (scale.size + shift.size + iScale.size + iShift.size) * sizeof(float);
@@ -64,11 +80,17 @@ namespace Simd
         virtual String Ext() const = 0;
         virtual String Desc() const = 0;
 
-        virtual size_t ExternalBufferSize() const;
+        size_t ExternalBufferSize() const;
         virtual size_t InternalBufferSize() const;
 
         virtual void SetParams(const float* weight, const float* bias, const float* params, const float* const* stats);
 
+        virtual bool Share(const SynetConvolution8i& other);
+
+        virtual size_t Export(uint8_t* blob, size_t size) const;
+
+        virtual bool Import(const uint8_t* blob, size_t size);
+
         virtual void Forward(const uint8_t * src, uint8_t * buf, uint8_t * dst);
 
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
@@ -82,6 +104,7 @@ namespace Simd
         }
 
     protected:
+        virtual size_t ThreadBufferSize() const;
         virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst) = 0;
 
         typedef void(*Convert32fTo8u)(const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility);
@@ -94,10 +117,10 @@ namespace Simd
         mutable String _info;
         Convert32fTo8u _convertSrc;
         CvtParam _srcCvt, _dstCvt;
-        Array8i _weight;
+        SharedArray8i _weight;
         Array32f _norm, _bias, _params; 
         bool _src8u, _dst8u;
-        size_t _merge, _sizeS, _sizeD;
+        size_t _merge, _sizeS, _sizeD, _threadNumber;
     };
 
     namespace Base
@@ -108,9 +131,9 @@ namespace Simd
             SynetConvolution8iGemmNN(const ConvParam & p);
             virtual String Ext() const { return "Base"; }
             virtual String Desc() const { return Ext() + "::GemmNN"; }
-            virtual size_t ExternalBufferSize() const;
 
         protected:
+            virtual size_t ThreadBufferSize() const;
             virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst);
 
             bool _skipConv;
@@ -124,8 +147,9 @@ namespace Simd
             virtual String Ext() const { return "Base"; }
             virtual String Desc() const;
             virtual size_t InternalBufferSize() const;
-            virtual size_t ExternalBufferSize() const;
             virtual void SetParams(const float* weight, const float* bias, const float* params, const float* const* stats);
+            virtual bool Share(const SynetConvolution8i& other);
+            virtual bool Import(const uint8_t* blob, size_t size);
 
             static bool Preferable(const ConvParam& p);
 
@@ -144,6 +168,7 @@ namespace Simd
             bool PadEnable(size_t microHW);
             void PadInput(const uint8_t* src, uint8_t* dst);
 
+            virtual size_t ThreadBufferSize() const;
             virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst);
             void Forward8u(const uint8_t* src, const ConvParam & p, int32_t* buf, uint8_t* dst);
 
@@ -160,6 +185,8 @@ namespace Simd
             virtual String Ext() const { return "Base"; }
             virtual String Desc() const;
             virtual void SetParams(const float* weight, const float* bias, const float* params, const float* const* stats);
+            virtual bool Share(const SynetConvolution8i& other);
+            virtual bool Import(const uint8_t* blob, size_t size);
 
             static bool Preferable(const ConvParam& p);
 
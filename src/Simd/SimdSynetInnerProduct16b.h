@@ -74,6 +74,11 @@ namespace Simd
 
     //-------------------------------------------------------------------------------------------------
 
+    typedef void* (*SynetInnerProduct16bInitPtr)(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, 
+        SimdBool transB, SimdBool constB, SimdBool bias, SimdConvolutionActivationType activation);
+
+    //-------------------------------------------------------------------------------------------------
+
     class SynetInnerProduct16b : public Deletable
     {
     public:
@@ -0,0 +1,210 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetMemoryPlanner_hpp__
+#define __SimdSynetMemoryPlanner_hpp__
+
+#include "Simd/SimdAllocator.hpp"
+
+#include <vector>
+#include <algorithm>
+
+namespace Simd
+{
+    /*! @ingroup cpp_synet_network
+
+        \short The SynetMemoryPlanner class calculates a static placement of tensors and temporary buffers in one memory arena.
+
+        Every block has a size and a lifetime - an inclusive range of steps (layer indices) where it is used.
+        Blocks with overlapping lifetimes get non-overlapping places in the arena, blocks with disjoint lifetimes
+        can share memory. Placement is a greedy interval-graph coloring: blocks are processed in order of decreasing
+        size and each block is put into the smallest suitable gap between already placed conflicting blocks.
+
+        Using example:
+        \code
+        #include "Simd/SimdSynetMemoryPlanner.hpp"
+
+        Simd::SynetMemoryPlanner planner;
+        size_t src = planner.Add(srcSize, 0, 0);
+        size_t buf = planner.Add(SimdSynetConvolution32fExternalBufferSize(conv) * sizeof(float), 0, 0);
+        size_t dst = planner.Add(dstSize, 0, 1);
+        planner.Plan();
+
+        Simd::SynetMemoryPlanner::Buffer arena(planner.Size());
+        float * pSrc = (float*)(arena.data() + planner.Offset(src));
+        \endcode
+    */
+    class SynetMemoryPlanner
+    {
+    public:
+        typedef std::vector<uint8_t, Allocator<uint8_t>> Buffer; /*!< \brief Aligned memory buffer (can be used as arena). */
+
+        /*!
+            Creates a new SynetMemoryPlanner object.
+
+            \param [in] align - an alignment of offsets of blocks in the arena.
+        */
+        SynetMemoryPlanner(size_t align = SimdAlignment())
+            : _align(align)
+            , _size(0)
+        {
+        }
+
+        /*!
+            \short Clears all added blocks.
+        */
+        void Clear()
+        {
+            _blocks.clear();
+            _size = 0;
+        }
+
+        /*!
+            \short Adds block to the planner.
+
+            \param [in] size - a size of the block (in bytes).
+            \param [in] begin - the first step where the block is used.
+            \param [in] end - the last step where the block is used (inclusive).
+            \return an identifier of the block.
+        */
+        size_t Add(size_t size, size_t begin, size_t end)
+        {
+            _blocks.push_back(Block(AlignHi(size), begin, std::max(begin, end)));
+            return _blocks.size() - 1;
+        }
+
+        /*!
+            \short Calculates offsets of all added blocks.
+
+            \return a size of the arena (in bytes).
+        */
+        size_t Plan()
+        {
+            std::vector<size_t> order(_blocks.size());
+            for (size_t i = 0; i < order.size(); ++i)
+                order[i] = i;
+            std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+                const Block & ba = _blocks[a], & bb = _blocks[b];
+                return ba.size != bb.size ? ba.size > bb.size : ba.begin < bb.begin; });
+
+            _size = 0;
+            std::vector<const Block*> placed, conflicts;
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                Block & block = _blocks[order[i]];
+                conflicts.clear();
+                for (size_t j = 0; j < placed.size(); ++j)
+                    if (placed[j]->begin <= block.end && block.begin <= placed[j]->end)
+                        conflicts.push_back(placed[j]);
+                std::sort(conflicts.begin(), conflicts.end(), [](const Block * a, const Block * b) { return a->offset < b->offset; });
+
+                size_t offset = 0, best = SIZE_MAX, bestGap = SIZE_MAX;
+                for (size_t j = 0; j < conflicts.size(); ++j)
+                {
+                    const Block & conflict = *conflicts[j];
+                    if (conflict.offset >= offset + block.size && conflict.offset - offset < bestGap)
+                    {
+                        best = offset;
+                        bestGap = conflict.offset - offset;
+                    }
+                    offset = std::max(offset, conflict.offset + conflict.size);
+                }
+                block.offset = best == SIZE_MAX ? offset : best;
+                _size = std::max(_size, block.offset + block.size);
+                placed.push_back(&block);
+            }
+            return _size;
+        }
+
+        /*!
+            \short Gets offset of the block in the arena. Function Plan() must be called before.
+
+            \param [in] id - an identifier of the block.
+            \return an offset of the block (in bytes).
+        */
+        size_t Offset(size_t id) const
+        {
+            return _blocks[id].offset;
+        }
+
+        /*!
+            \short Gets size of the arena. Function Plan() must be called before.
+
+            \return a size of the arena (in bytes).
+        */
+        size_t Size() const
+        {
+            return _size;
+        }
+
+        /*!
+            \short Gets total size of all blocks without memory sharing.
+
+            \return a total size of all blocks (in bytes).
+        */
+        size_t Total() const
+        {
+            size_t total = 0;
+            for (size_t i = 0; i < _blocks.size(); ++i)
+                total += _blocks[i].size;
+            return total;
+        }
+
+        /*!
+            \short Gets lower bound of arena size: the maximal sum of sizes of blocks alive at the same step.
+
+            \return a lower bound of arena size (in bytes).
+        */
+        size_t Peak() const
+        {
+            size_t peak = 0;
+            for (size_t i = 0; i < _blocks.size(); ++i)
+            {
+                size_t step = _blocks[i].begin, sum = 0;
+                for (size_t j = 0; j < _blocks.size(); ++j)
+                    if (_blocks[j].begin <= step && step <= _blocks[j].end)
+                        sum += _blocks[j].size;
+                peak = std::max(peak, sum);
+            }
+            return peak;
+        }
+
+    private:
+        struct Block
+        {
+            size_t size, begin, end, offset;
+            Block(size_t s, size_t b, size_t e) : size(s), begin(b), end(e), offset(0) {}
+        };
+        typedef std::vector<Block> Blocks;
+
+        Blocks _blocks;
+        size_t _align, _size;
+
+        size_t AlignHi(size_t size) const
+        {
+            return (size + _align - 1) / _align * _align;
+        }
+    };
+}
+
+#endif
@@ -96,6 +96,7 @@ namespace Simd
             void SetBias(const float* src, const ConvParam& p, Array32f& dst);
             void SetParams(const float* src, const ConvParam& p, Array32f& dst);
             uint8_t* Buffer(uint8_t* buffer);
+            virtual void ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch);
 
             MergConvParam _param;
             mutable String _info;
@@ -108,7 +109,7 @@ namespace Simd
             InputConvolutionPtr _input;
             DepthwiseConvolutionPtr _depthwise;
             OutputConvolutionPtr _output[2];
-            size_t _sizeS, _sizeD, _sizeB[5];
+            size_t _sizeS, _sizeD, _sizeB[5], _threadNumber;
             AlgParam _alg;
             Array8u _buffer;
             Array16u _weightI, _weightO;
@@ -120,11 +121,10 @@ namespace Simd
         public:
             SynetMergedConvolution16bCdc(const MergConvParam& p);
 
-            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
-
             static bool Preferable(const MergConvParam& p);
 
         protected:
+            virtual void ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch);
             void SetSize(size_t miC, size_t miK);
         };
 
@@ -133,11 +133,10 @@ namespace Simd
         public:
             SynetMergedConvolution16bCd(const MergConvParam& p);
 
-            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
-
             static bool Preferable(const MergConvParam& p);
 
         protected:
+            virtual void ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch);
             void SetSize(size_t miC, size_t miK);
         };
 
@@ -146,11 +145,10 @@ namespace Simd
         public:
             SynetMergedConvolution16bDc(const MergConvParam& p);
 
-            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
-
             static bool Preferable(const MergConvParam& p);
 
         protected:
+            virtual void ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch);
             void SetSize(size_t miC, size_t miK);
         };
 
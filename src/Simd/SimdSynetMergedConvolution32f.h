@@ -123,9 +123,10 @@ namespace Simd
             virtual void ReorderFirstWeight(const float* src, float* dst) const {}
             virtual void ReorderSecondWeight(const float* src, float* dst) const {}
             virtual void ReorderThirdWeight(const float* src, float* dst) const {}
+            virtual void ForwardBatch(const float* src, float* buf, float* dst, size_t batch);
 
             ConvolutionPtr _convolution[4];
-            size_t _sizeS, _sizeD, _sizeB[2];
+            size_t _sizeS, _sizeD, _sizeB[2], _threadNumber;
             Array32f _rWeight[3], _rBias[3], _rParams[3];
             const float * _weight[3], * _bias[3], * _params[3];
 
@@ -137,11 +138,10 @@ namespace Simd
         public:
             SynetMergedConvolution32fCdc(const MergConvParam& p);
 
-            virtual void Forward(const float * src, float * buf, float * dst);
-
             static bool Preferable(const MergConvParam& p);
 
         protected:
+            virtual void ForwardBatch(const float* src, float* buf, float* dst, size_t batch);
             void SetSize(size_t L1, size_t L2, size_t L3, size_t F);
             virtual void ReorderFirstWeight(const float* src, float* dst) const;
             virtual void ReorderSecondWeight(const float* src, float* dst) const;
@@ -153,11 +153,10 @@ namespace Simd
         public:
             SynetMergedConvolution32fCd(const MergConvParam& p);
 
-            virtual void Forward(const float* src, float* buf, float* dst);
-
             static bool Preferable(const MergConvParam& p);
 
         protected:
+            virtual void ForwardBatch(const float* src, float* buf, float* dst, size_t batch);
             void SetSize(size_t L1, size_t L2, size_t L3, size_t F);
             virtual void ReorderFirstWeight(const float* src, float* dst) const;
             virtual void ReorderSecondWeight(const float* src, float* dst) const;
@@ -168,11 +167,10 @@ namespace Simd
         public:
             SynetMergedConvolution32fDc(const MergConvParam& p);
 
-            virtual void Forward(const float* src, float* buf, float* dst);
-
             static bool Preferable(const MergConvParam& p);
 
         protected:
+            virtual void ForwardBatch(const float* src, float* buf, float* dst, size_t batch);
             void SetSize(size_t L1, size_t L2, size_t L3, size_t F);
             virtual void ReorderFirstWeight(const float* src, float* dst) const;
             virtual void ReorderSecondWeight(const float* src, float* dst) const;
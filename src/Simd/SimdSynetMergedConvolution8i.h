@@ -191,6 +191,7 @@ namespace Simd
 
         protected:
             uint8_t* GetBuffer(uint8_t* buffer);
+            virtual void ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch);
             void Quantize(const float* weight, const float* bias, size_t i, size_t q);
             void ReorderInputWeight(const ConvParam& p, Array8i & weight);
             void ReorderDepthwiseWeight(const ConvParam& p, Array32f & weight);
@@ -199,7 +200,7 @@ namespace Simd
 
             MergConvParam8i _param;
             bool _s8u, _d8u, _dw0, _1x1;
-            size_t _sizeS, _sizeD, _sizeI[2], _sizeB[5];
+            size_t _sizeS, _sizeD, _sizeI[2], _sizeB[5], _threadNumber;
             CvtParam _cvt[3];
             Array8u _buffer;
             Array8i _weight8i[2];
@@ -223,11 +224,10 @@ namespace Simd
         public:
             SynetMergedConvolution8iCdc(const MergConvParam8i& p);
 
-            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
-
             static bool Preferable(const MergConvParam8i& p);
 
         protected:
+            virtual void ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch);
             void SetSize(size_t F);
         };
 
@@ -236,11 +236,10 @@ namespace Simd
         public:
             SynetMergedConvolution8iCd(const MergConvParam8i& p);
 
-            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
-
             static bool Preferable(const MergConvParam8i& p);
 
         protected:
+            virtual void ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch);
             void SetSize(size_t F);
         };
 
@@ -249,11 +248,10 @@ namespace Simd
         public:
             SynetMergedConvolution8iDc(const MergConvParam8i& p);
 
-            virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
-
             static bool Preferable(const MergConvParam8i& p);
 
         protected:
+            virtual void ForwardBatch(const uint8_t* src, uint8_t* buf, uint8_t* dst, size_t batch);
             void SetSize(size_t F);
         };
 
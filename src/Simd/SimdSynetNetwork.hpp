@@ -0,0 +1,648 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetNetwork_hpp__
+#define __SimdSynetNetwork_hpp__
+
+#include "Simd/SimdLib.hpp"
+#include "Simd/SimdSynetMemoryPlanner.hpp"
+
+#include <vector>
+#include <memory>
+#include <functional>
+
+namespace Simd
+{
+    /*! @ingroup cpp_synet_network
+
+        \short The SynetNetwork class runs a sequence of Synet layers as one graph.
+
+        Every layer is a thin wrapper over a corresponding Synet function or context of %Simd Library API.
+        At initialization the network calculates lifetimes of all intermediate tensors and external buffers
+        of layers, runs in-place layers without extra copies and places all tensors and buffers into one
+        aligned memory arena with using of Simd::SynetMemoryPlanner.
+
+        Using example (convolution + max pooling + softmax):
+        \code
+        #include "Simd/SimdSynetNetwork.hpp"
+
+        int main()
+        {
+            SimdConvolutionParameters conv = ...;
+            std::vector<float> weight = ..., bias = ..., params = ...;
+
+            Simd::SynetNetwork net;
+            size_t src = net.AddInput(conv.srcC * conv.srcH * conv.srcW * sizeof(float));
+            size_t c = net.AddLayer(std::make_shared<Simd::SynetNetwork::Convolution32f>(1, conv, weight.data(), bias.data(), params.data()), { src });
+            size_t p = net.AddLayer(std::make_shared<Simd::SynetNetwork::PoolingMax32f>(1, conv.dstC, conv.dstH, conv.dstW, 2, 2, 2, 2, 0, 0, conv.dstH / 2, conv.dstW / 2, conv.dstF), { c });
+            size_t dst = net.AddLayer(std::make_shared<Simd::SynetNetwork::Softmax32f>(conv.dstH * conv.dstW / 4, conv.dstC, 1), { p });
+            net.SetOutput(dst);
+            if (!net.Init())
+                return 1;
+
+            memcpy(net.Data(src), ..., net.Size(src));
+            net.Forward();
+            const float * output = net.Data<float>(dst);
+
+            return 0;
+        }
+        \endcode
+
+        \note Weights passed to layers which are not copied into internal context buffers must be alive while the network exists.
+    */
+    class SynetNetwork
+    {
+    public:
+        typedef std::vector<size_t> Ids; /*!< \brief Vector of tensor identifiers. */
+
+        /*! @ingroup cpp_synet_network
+
+            \short Layer class.
+
+            Abstract base class for all layers of SynetNetwork.
+        */
+        class Layer
+        {
+        public:
+            /*!
+                \short Releases layer resources.
+            */
+            virtual ~Layer() {}
+
+            /*!
+                \short Checks layer state.
+
+                \return true if layer was successfully created.
+            */
+            virtual bool Enable() const { return true; }
+
+            /*!
+                \short Gets size of output tensor.
+
+                \return a size of output tensor (in bytes).
+            */
+            virtual size_t DstSize() const = 0;
+
+            /*!
+                \short Gets size of external temporary buffer required by the layer.
+
+                \return a size of external temporary buffer (in bytes).
+            */
+            virtual size_t ExternalBufferSize() const { return 0; }
+
+            /*!
+                \short Checks if the layer can write output into memory of the first input tensor.
+
+                \return true if output tensor can alias the first input tensor.
+            */
+            virtual bool InPlace() const { return false; }
+
+            /*!
+                \short Performs forward propagation of the layer.
+
+                \param [in] src - a pointer to array with pointers to input tensors.
+                \param [out] buf - a pointer to external temporary buffer. Its size is not less than ExternalBufferSize().
+                \param [out] dst - a pointer to output tensor.
+            */
+            virtual void Forward(const uint8_t * const * src, uint8_t * buf, uint8_t * dst) = 0;
+        };
+        typedef std::shared_ptr<Layer> LayerPtr; /*!< \brief Shared pointer to layer. */
+
+        /*! @ingroup cpp_synet_network
+
+            \short Convolution32f class.
+
+            Wrapper over ::SimdSynetConvolution32fInit and ::SimdSynetConvolution32fForward.
+        */
+        class Convolution32f : public Layer
+        {
+        public:
+            /*!
+                \short Creates FP32 convolution layer.
+
+                \param [in] batch - a batch size.
+                \param [in] conv - convolution parameters.
+                \param [in] weight - a pointer to convolution weights.
+                \param [in] bias - a pointer to bias. Can be NULL.
+                \param [in] params - a pointer to parameters of activation functions. Can be NULL.
+            */
+            Convolution32f(size_t batch, const SimdConvolutionParameters & conv, const float * weight, const float * bias, const float * params)
+                : _context(SimdSynetConvolution32fInit(batch, &conv))
+                , _dstSize(batch * conv.dstC * conv.dstH * conv.dstW * sizeof(float))
+            {
+                if (_context)
+                {
+                    SimdBool internal;
+                    SimdSynetConvolution32fSetParams(_context, weight, &internal, bias, params);
+                }
+            }
+
+            ~Convolution32f() { if (_context) SimdRelease(_context); }
+
+            bool Enable() const { return _context != NULL; }
+
+            size_t DstSize() const { return _dstSize; }
+
+            size_t ExternalBufferSize() const { return SimdSynetConvolution32fExternalBufferSize(_context) * sizeof(float); }
+
+            void Forward(const uint8_t * const * src, uint8_t * buf, uint8_t * dst)
+            {
+                SimdSynetConvolution32fForward(_context, (const float*)src[0], (float*)buf, (float*)dst);
+            }
+
+        private:
+            void * _context;
+            size_t _dstSize;
+        };
+
+        /*! @ingroup cpp_synet_network
+
+            \short Convolution16b class.
+
+            Wrapper over ::SimdSynetConvolution16bInit and ::SimdSynetConvolution16bForward.
+        */
+        class Convolution16b : public Layer
+        {
+        public:
+            /*!
+                \short Creates BF16 convolution layer.
+
+                \param [in] batch - a batch size.
+                \param [in] conv - convolution parameters (input and output can be FP32 or BF16).
+                \param [in] weight - a pointer to FP32 convolution weights.
+                \param [in] bias - a pointer to FP32 bias. Can be NULL.
+                \param [in] params - a pointer to parameters of activation functions. Can be NULL.
+                \param [in] compatibility - a flags of calculation compatibility.
+            */
+            Convolution16b(size_t batch, const SimdConvolutionParameters & conv, const float * weight, const float * bias, const float * params,
+                SimdSynetCompatibilityType compatibility = SimdSynetCompatibilityDefault)
+                : _context(SimdSynetConvolution16bInit(batch, &conv, compatibility))
+                , _dstSize(batch * conv.dstC * conv.dstH * conv.dstW * (conv.dstT == SimdTensorData16b ? 2 : 4))
+            {
+                if (_context)
+                    SimdSynetConvolution16bSetParams(_context, weight, bias, params);
+            }
+
+            ~Convolution16b() { if (_context) SimdRelease(_context); }
+
+            bool Enable() const { return _context != NULL; }
+
+            size_t DstSize() const { return _dstSize; }
+
+            size_t ExternalBufferSize() const { return SimdSynetConvolution16bExternalBufferSize(_context); }
+
+            void Forward(const uint8_t * const * src, uint8_t * buf, uint8_t * dst)
+            {
+                SimdSynetConvolution16bForward(_context, src[0], buf, dst);
+            }
+
+        private:
+            void * _context;
+            size_t _dstSize;
+        };
+
+        /*! @ingroup cpp_synet_network
+
+            \short MergedConvolution32f class.
+
+            Wrapper over ::SimdSynetMergedConvolution32fInit and ::SimdSynetMergedConvolution32fForward.
+        */
+        class MergedConvolution32f : public Layer
+        {
+        public:
+            /*!
+                \short Creates FP32 merged convolution layer.
+
+                \param [in] batch - a batch size.
+                \param [in] convs - an array with parameters of merged convolutions.
+                \param [in] count - a number of merged convolutions (2 or 3).
+                \param [in] add - a flag of adding input tensor to output.
+                \param [in] weight - an array of pointers to weights of merged convolutions.
+                \param [in] bias - an array of pointers to bias of merged convolutions.
+                \param [in] params - an array of pointers to parameters of activation functions of merged convolutions.
+            */
+            MergedConvolution32f(size_t batch, const SimdConvolutionParameters * convs, size_t count, SimdBool add,
+                const float * const * weight, const float * const * bias, const float * const * params)
+                : _context(SimdSynetMergedConvolution32fInit(batch, convs, count, add))
+                , _dstSize(batch * convs[count - 1].dstC * convs[count - 1].dstH * convs[count - 1].dstW * sizeof(float))
+            {
+                if (_context)
+                {
+                    SimdBool internal[3];
+                    SimdSynetMergedConvolution32fSetParams(_context, weight, internal, bias, params);
+                }
+            }
+
+            ~MergedConvolution32f() { if (_context) SimdRelease(_context); }
+
+            bool Enable() const { return _context != NULL; }
+
+            size_t DstSize() const { return _dstSize; }
+
+            size_t ExternalBufferSize() const { return SimdSynetMergedConvolution32fExternalBufferSize(_context) * sizeof(float); }
+
+            void Forward(const uint8_t * const * src, uint8_t * buf, uint8_t * dst)
+            {
+                SimdSynetMergedConvolution32fForward(_context, (const float*)src[0], (float*)buf, (float*)dst);
+            }
+
+        private:
+            void * _context;
+            size_t _dstSize;
+        };
+
+        /*! @ingroup cpp_synet_network
+
+            \short PoolingMax32f class.
+
+            Wrapper over ::SimdSynetPoolingMax32f (2D case).
+        */
+        class PoolingMax32f : public Layer
+        {
+        public:
+            /*!
+                \short Creates FP32 2D max pooling layer.
+
+                \param [in] batch - a batch size.
+                \param [in] srcC - a number of input and output channels.
+                \param [in] srcH - an input height.
+                \param [in] srcW - an input width.
+                \param [in] kernelY - a height of the pooling kernel.
+                \param [in] kernelX - a width of the pooling kernel.
+                \param [in] strideY - a y-stride of the pooling.
+                \param [in] strideX - a x-stride of the pooling.
+                \param [in] padY - a pad to the top of the input image.
+                \param [in] padX - a pad to the left of the input image.
+                \param [in] dstH - an output height.
+                \param [in] dstW - an output width.
+                \param [in] format - a format of input and output tensor.
+            */
+            PoolingMax32f(size_t batch, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+                size_t strideY, size_t strideX, size_t padY, size_t padX, size_t dstH, size_t dstW, SimdTensorFormatType format)
+                : _batch(batch), _srcC(srcC), _srcH(srcH), _srcW(srcW), _kernelY(kernelY), _kernelX(kernelX)
+                , _strideY(strideY), _strideX(strideX), _padY(padY), _padX(padX), _dstH(dstH), _dstW(dstW), _format(format)
+            {
+            }
+
+            size_t DstSize() const { return _batch * _srcC * _dstH * _dstW * sizeof(float); }
+
+            void Forward(const uint8_t * const * src, uint8_t * buf, uint8_t * dst)
+            {
+                const float * s = (const float*)src[0];
+                float * d = (float*)dst;
+                for (size_t b = 0; b < _batch; ++b)
+                {
+                    SimdSynetPoolingMax32f(s, _srcC, _srcH, _srcW, 1, _kernelY, _kernelX, 1, _strideY, _strideX,
+                        0, _padY, _padX, d, _srcC, _dstH, _dstW, _format);
+                    s += _srcC * _srcH * _srcW;
+                    d += _srcC * _dstH * _dstW;
+                }
+            }
+
+        private:
+            size_t _batch, _srcC, _srcH, _srcW, _kernelY, _kernelX, _strideY, _strideX, _padY, _padX, _dstH, _dstW;
+            SimdTensorFormatType _format;
+        };
+
+        /*! @ingroup cpp_synet_network
+
+            \short Softmax32f class.
+
+            Wrapper over ::SimdSynetSoftmax32f.
+        */
+        class Softmax32f : public Layer
+        {
+        public:
+            /*!
+                \short Creates FP32 softmax layer.
+
+                \param [in] outer - an outer size of input tensor.
+                \param [in] count - a size of softmax dimension.
+                \param [in] inner - an inner size of input tensor.
+            */
+            Softmax32f(size_t outer, size_t count, size_t inner)
+                : _outer(outer), _count(count), _inner(inner)
+            {
+            }
+
+            size_t DstSize() const { return _outer * _count * _inner * sizeof(float); }
+
+            void Forward(const uint8_t * const * src, uint8_t * buf, uint8_t * dst)
+            {
+                SimdSynetSoftmax32f((const float*)src[0], _outer, _count, _inner, (float*)dst);
+            }
+
+        private:
+            size_t _outer, _count, _inner;
+        };
+
+        /*! @ingroup cpp_synet_network
+
+            \short Add16b class.
+
+            Wrapper over ::SimdSynetAdd16bInit and ::SimdSynetAdd16bForward. It has two inputs (A and B).
+        */
+        class Add16b : public Layer
+        {
+        public:
+            /*!
+                \short Creates FP32/BF16 element-wise addition layer.
+
+                \param [in] shape - a shape of input and output tensors.
+                \param [in] aType - a type of input A tensor.
+                \param [in] bType - a type of input B tensor.
+                \param [in] dstType - a type of output tensor.
+                \param [in] format - a format of input and output tensors.
+            */
+            Add16b(const std::vector<size_t> & shape, SimdTensorDataType aType, SimdTensorDataType bType, SimdTensorDataType dstType, SimdTensorFormatType format)
+                : _context(SimdSynetAdd16bInit(shape.data(), shape.size(), aType, shape.data(), shape.size(), bType, dstType, format))
+                , _dstSize(dstType == SimdTensorData16b ? 2 : 4)
+                , _inPlace(aType == dstType)
+            {
+                for (size_t i = 0; i < shape.size(); ++i)
+                    _dstSize *= shape[i];
+            }
+
+            ~Add16b() { if (_context) SimdRelease(_context); }
+
+            bool Enable() const { return _context != NULL; }
+
+            size_t DstSize() const { return _dstSize; }
+
+            bool InPlace() const { return _inPlace; }
+
+            void Forward(const uint8_t * const * src, uint8_t * buf, uint8_t * dst)
+            {
+                SimdSynetAdd16bForward(_context, src[0], src[1], dst);
+            }
+
+        private:
+            void * _context;
+            size_t _dstSize;
+            bool _inPlace;
+        };
+
+        /*! @ingroup cpp_synet_network
+
+            \short Function class.
+
+            Layer which calls arbitrary user function. It allows to insert into network any Synet function without own context.
+        */
+        class Function : public Layer
+        {
+        public:
+            typedef std::function<void(const uint8_t * const * src, uint8_t * dst)> Body; /*!< \brief Body of the layer. */
+
+            /*!
+                \short Creates layer with user function.
+
+                \param [in] body - a function which performs forward propagation.
+                \param [in] dstSize - a size of output tensor (in bytes).
+                \param [in] inPlace - a flag that the function can write output into memory of the first input tensor.
+            */
+            Function(const Body & body, size_t dstSize, bool inPlace = false)
+                : _body(body), _dstSize(dstSize), _inPlace(inPlace)
+            {
+            }
+
+            size_t DstSize() const { return _dstSize; }
+
+            bool InPlace() const { return _inPlace; }
+
+            void Forward(const uint8_t * const * src, uint8_t * buf, uint8_t * dst)
+            {
+                _body(src, dst);
+            }
+
+        private:
+            Body _body;
+            size_t _dstSize;
+            bool _inPlace;
+        };
+
+        /*!
+            \short Adds input tensor to the network.
+
+            \param [in] size - a size of input tensor (in bytes).
+            \return an identifier of the input tensor.
+        */
+        size_t AddInput(size_t size)
+        {
+            _tensors.push_back(Tensor(size, INPUT));
+            return _tensors.size() - 1;
+        }
+
+        /*!
+            \short Adds layer to the network. Layers are executed in the order of addition.
+
+            \param [in] layer - a pointer to the layer.
+            \param [in] src - identifiers of input tensors of the layer.
+            \return an identifier of the output tensor of the layer.
+        */
+        size_t AddLayer(const LayerPtr & layer, const Ids & src)
+        {
+            _nodes.push_back(Node(layer, src, _tensors.size()));
+            _tensors.push_back(Tensor(layer->DstSize(), _nodes.size() - 1));
+            _inited = false;
+            return _tensors.size() - 1;
+        }
+
+        /*!
+            \short Marks tensor as output of the network. Memory of output tensors is never reused.
+
+            \param [in] id - an identifier of the tensor.
+        */
+        void SetOutput(size_t id)
+        {
+            _tensors[id].output = true;
+            _inited = false;
+        }
+
+        /*!
+            \short Plans lifetimes of tensors and allocates memory.
+
+            \return a result of initialization.
+        */
+        bool Init()
+        {
+            _inited = false;
+            size_t nodes = _nodes.size();
+            for (size_t t = 0; t < _tensors.size(); ++t)
+            {
+                Tensor & tensor = _tensors[t];
+                tensor.alias = t;
+                tensor.last = tensor.output || tensor.producer == INPUT ? nodes : tensor.producer;
+            }
+            for (size_t n = 0; n < nodes; ++n)
+            {
+                const Node & node = _nodes[n];
+                if (!node.layer->Enable())
+                    return false;
+                for (size_t i = 0; i < node.src.size(); ++i)
+                {
+                    if (node.src[i] >= node.dst)
+                        return false;
+                    Tensor & tensor = _tensors[node.src[i]];
+                    tensor.last = std::max(tensor.last, n);
+                }
+            }
+            for (size_t n = 0; n < nodes; ++n)
+            {
+                const Node & node = _nodes[n];
+                if (node.layer->InPlace() && node.src.size())
+                {
+                    Tensor & src = _tensors[Root(node.src[0])], & dst = _tensors[node.dst];
+                    bool shared = false;
+                    for (size_t i = 1; i < node.src.size(); ++i)
+                        shared = shared || Root(node.src[i]) == Root(node.src[0]);
+                    if (src.producer != INPUT && !src.output && src.last == n && src.size >= dst.size && !shared)
+                    {
+                        dst.alias = Root(node.src[0]);
+                        src.last = dst.last;
+                        src.output = dst.output;
+                    }
+                }
+            }
+            SynetMemoryPlanner planner;
+            for (size_t t = 0; t < _tensors.size(); ++t)
+            {
+                Tensor & tensor = _tensors[t];
+                if (Root(t) == t)
+                    tensor.offset = planner.Add(tensor.size, tensor.producer == INPUT ? 0 : tensor.producer, tensor.last);
+            }
+            for (size_t n = 0; n < nodes; ++n)
+                _nodes[n].buf = planner.Add(_nodes[n].layer->ExternalBufferSize(), n, n);
+            _arena.resize(planner.Plan());
+            for (size_t t = 0; t < _tensors.size(); ++t)
+            {
+                if (Root(t) == t)
+                    _tensors[t].offset = planner.Offset(_tensors[t].offset);
+            }
+            _src.resize(nodes);
+            for (size_t n = 0; n < nodes; ++n)
+            {
+                Node & node = _nodes[n];
+                node.buf = planner.Offset(node.buf);
+                _src[n].resize(node.src.size());
+                for (size_t i = 0; i < node.src.size(); ++i)
+                    _src[n][i] = Data(node.src[i]);
+            }
+            _inited = true;
+            return true;
+        }
+
+        /*!
+            \short Performs forward propagation of the whole network.
+        */
+        void Forward()
+        {
+            if (!_inited)
+                return;
+            for (size_t n = 0; n < _nodes.size(); ++n)
+            {
+                const Node & node = _nodes[n];
+                node.layer->Forward(_src[n].data(), _arena.data() + node.buf, Data(node.dst));
+            }
+        }
+
+        /*!
+            \short Gets pointer to tensor data. The network must be initialized.
+
+            \param [in] id - an identifier of the tensor.
+            \return a pointer to tensor data.
+        */
+        uint8_t * Data(size_t id)
+        {
+            return _arena.data() + _tensors[Root(id)].offset;
+        }
+
+        /*!
+            \short Gets pointer to tensor data of given type. The network must be initialized.
+
+            \param [in] id - an identifier of the tensor.
+            \return a pointer to tensor data.
+        */
+        template<class T> T * Data(size_t id)
+        {
+            return (T*)Data(id);
+        }
+
+        /*!
+            \short Gets size of tensor.
+
+            \param [in] id - an identifier of the tensor.
+            \return a size of tensor (in bytes).
+        */
+        size_t Size(size_t id) const
+        {
+            return _tensors[id].size;
+        }
+
+        /*!
+            \short Gets size of memory arena allocated by the network for tensors and external buffers.
+
+            \return a size of allocated memory (in bytes).
+        */
+        size_t MemoryUsage() const
+        {
+            return _arena.size();
+        }
+
+    private:
+        typedef std::vector<const uint8_t*> Ptrs;
+
+        static const size_t INPUT = size_t(-1);
+
+        struct Tensor
+        {
+            size_t size, producer, last, alias, offset;
+            bool output;
+            Tensor(size_t s, size_t p) : size(s), producer(p), last(0), alias(0), offset(0), output(false) {}
+        };
+        typedef std::vector<Tensor> Tensors;
+
+        struct Node
+        {
+            LayerPtr layer;
+            Ids src;
+            size_t dst, buf;
+            Node(const LayerPtr & l, const Ids & s, size_t d) : layer(l), src(s), dst(d), buf(0) {}
+        };
+        typedef std::vector<Node> Nodes;
+
+        Tensors _tensors;
+        Nodes _nodes;
+        SynetMemoryPlanner::Buffer _arena;
+        std::vector<Ptrs> _src;
+        bool _inited = false;
+
+        size_t Root(size_t id) const
+        {
+            while (_tensors[id].alias != id)
+                id = _tensors[id].alias;
+            return id;
+        }
+    };
+}
+
+#endif
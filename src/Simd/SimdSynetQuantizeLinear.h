@@ -299,6 +299,16 @@ namespace Simd
             }
         };
 
+        template <> struct QuntizedTerm8i<Term8iLast32f>
+        {
+            template<int index> static SIMD_INLINE void Apply(uint8_t* dst, int32_t* buf, const __m512i* bias, const __m512* norm, const __m512i& zero, __mmask16 tail = -1)
+            {
+                __m512 f32 = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_add_epi32(_mm512_loadu_si512(buf + index * F), bias[index])), norm[index]);
+                _mm512_mask_storeu_ps((float*)dst + index * F, tail, f32);
+                _mm_prefetch((const char*)(buf + index * F), _MM_HINT_NTA);
+            }
+        };
+
         template <> struct QuntizedTerm8i<Term8iInterim>
         {
             template<int index> static SIMD_INLINE void Apply(uint8_t* dst, int32_t* buf, const __m512i* bias, const __m512* norm, const __m512i& zero, __mmask16 tail = -1)
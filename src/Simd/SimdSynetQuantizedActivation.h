@@ -109,6 +109,31 @@ namespace Simd
             }
         };
 
+        template <> struct QuntizedTerm8i<Term8iLast32f>
+        {
+            template<int index> static SIMD_INLINE void Save(uint8_t* dst, int32_t* buf, __m128i sum,
+                const __m128i* bias, const __m128* norm, const __m128i& zero)
+            {
+                _mm_storeu_ps((float*)dst + index * F, _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(sum, bias[index])), norm[index]));
+            }
+
+            template<int index> static SIMD_INLINE void Save(uint8_t* dst, int32_t* buf, __m128i sum,
+                const __m128i* bias, const __m128* norm, const __m128i& zero, size_t tail)
+            {
+                float tmp[F];
+                _mm_storeu_ps(tmp, _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(sum, bias[index])), norm[index]));
+                for (size_t i = 0; i < tail; ++i)
+                    ((float*)dst)[index * F + i] = tmp[i];
+            }
+
+            static SIMD_INLINE void Save(uint8_t* dst, int32_t* buf, __m128i sum0, __m128i sum1,
+                const __m128i* bias, const __m128* norm, const __m128i& zero)
+            {
+                _mm_storeu_ps((float*)dst + 0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(sum0, bias[0])), norm[0]));
+                _mm_storeu_ps((float*)dst + F, _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(sum1, bias[1])), norm[1]));
+            }
+        };
+
         template <> struct QuntizedTerm8i<Term8iInterim>
         {
             template<int index> static SIMD_INLINE void Save(uint8_t* dst, int32_t* buf, __m128i sum,
@@ -303,6 +328,31 @@ namespace Simd
             }
         };
 
+        template <> struct QuntizedTerm8i<Term8iLast32f>
+        {
+            template<int index> static SIMD_INLINE void Save(uint8_t* dst, int32_t* buf, __m256i sum,
+                const __m256i* bias, const __m256* norm, const __m256i& zero)
+            {
+                _mm256_storeu_ps((float*)dst + index * F, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_add_epi32(sum, bias[index])), norm[index]));
+            }
+
+            template<int index> static SIMD_INLINE void Save(uint8_t* dst, int32_t* buf, __m256i sum,
+                const __m256i* bias, const __m256* norm, const __m256i& zero, size_t tail)
+            {
+                float tmp[F];
+                _mm256_storeu_ps(tmp, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_add_epi32(sum, bias[index])), norm[index]));
+                for (size_t i = 0; i < tail; ++i)
+                    ((float*)dst)[index * F + i] = tmp[i];
+            }
+
+            static SIMD_INLINE void Save(uint8_t* dst, int32_t* buf, __m256i sum0, __m256i sum1,
+                const __m256i* bias, const __m256* norm, const __m256i& zero)
+            {
+                _mm256_storeu_ps((float*)dst + 0, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_add_epi32(sum0, bias[0])), norm[0]));
+                _mm256_storeu_ps((float*)dst + F, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_add_epi32(sum1, bias[1])), norm[1]));
+            }
+        };
+
         template <> struct QuntizedTerm8i<Term8iInterim>
         {
             template<int index> static SIMD_INLINE void Save(uint8_t* dst, int32_t* buf, __m256i sum,
@@ -475,6 +525,15 @@ namespace Simd
             }
         };
 
+        template <> struct QuntizedTerm8i<Term8iLast32f>
+        {
+            template<int index> static SIMD_INLINE void Save(uint8_t* dst, int32_t* buf, __m512i sum,
+                const __m512i* bias, const __m512* norm, const __m512i& zero, __mmask16 tail = -1)
+            {
+                _mm512_mask_storeu_ps((float*)dst + index * F, tail, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_add_epi32(sum, bias[index])), norm[index]));
+            }
+        };
+
         template <> struct QuntizedTerm8i<Term8iInterim>
         {
             template<int index> static SIMD_INLINE void Save(uint8_t* dst, int32_t* buf, __m512i sum,
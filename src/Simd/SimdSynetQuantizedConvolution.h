@@ -34,6 +34,8 @@
 
 namespace Simd
 {
+    const int64_t SYNET_QUANTIZED_CONVOLUTION_THREAD_FLOP_MIN = int64_t(256 * 256 * 256) * 2 * 2;
+
     SIMD_INLINE bool ValidQuantized(const ConvParam& param)
     {
         if (!param.Valid(SimdTensorData8u, SimdTensorData8u))
@@ -99,7 +101,7 @@ namespace Simd
         int32_t _intZero, _dstZero;
         float _srcScale, _intScale, _dstScale;
         bool _src8u, _dst8u, _is1x1;
-        size_t _merge, _sizeS, _sizeD, _elemS, _elemD;
+        size_t _merge, _sizeS, _sizeD, _elemS, _elemD, _threadNumber;
     };
 
     //------------------------------------------------------------------------------------------------
@@ -156,7 +158,7 @@ namespace Simd
             virtual void SetWeight(const int8_t* weight);
 
             virtual void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
-            void Forward(const uint8_t* src, uint8_t* buf, int32_t* sum, uint8_t* dst);
+            void Forward(const uint8_t* src, uint8_t* buf, int32_t* sum, uint8_t* dst, size_t begin, size_t end);
 
             AlgParam _alg;
             ConvertPtr _convert;
@@ -55,7 +55,7 @@ namespace Simd
                 constB &&
                 (/*typeA == SimdTensorData32f || */typeA == SimdTensorData8u) &&
                 (/*typeB == SimdTensorData32f || */typeB == SimdTensorData8i) &&
-                (/*typeC == SimdTensorData32f || */typeC == SimdTensorData8u);
+                (typeC == SimdTensorData32f || typeC == SimdTensorData8u);
         }
 
         String Info() const
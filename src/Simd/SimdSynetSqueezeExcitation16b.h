@@ -0,0 +1,135 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetSqueezeExcitation16b_h__
+#define __SimdSynetSqueezeExcitation16b_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdSynetScale16b.h"
+
+namespace Simd
+{
+    struct SqueezeExcitation16bParam
+    {
+        size_t batch, channels, spatial, squeeze;
+        SimdTensorDataType sType, dType;
+        SimdConvolutionActivationType activation;
+
+        SqueezeExcitation16bParam(size_t b, size_t c, size_t s, size_t q, SimdTensorDataType st, SimdTensorDataType dt, SimdConvolutionActivationType a)
+            : batch(b)
+            , channels(c)
+            , spatial(s)
+            , squeeze(q)
+            , sType(st)
+            , dType(dt)
+            , activation(a)
+        {
+        }
+
+        bool Valid()
+        {
+            return
+                (batch > 0 && channels > 0 && spatial > 0 && squeeze > 0) &&
+                (sType == SimdTensorData32f || sType == SimdTensorData16b) &&
+                (dType == SimdTensorData32f || dType == SimdTensorData16b);
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class SynetSqueezeExcitation16b : public Deletable
+    {
+    public:
+        SynetSqueezeExcitation16b(const SqueezeExcitation16bParam& p);
+
+        virtual size_t InternalBufferSize() const = 0;
+        virtual void SetParams(const float* weight0, const float* bias0, const float* params, const float* weight1, const float* bias1) = 0;
+        virtual void Forward(const uint8_t* src, uint8_t* dst) = 0;
+
+    protected:
+        SqueezeExcitation16bParam _param;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        class SynetSqueezeExcitation16b : public Simd::SynetSqueezeExcitation16b
+        {
+        public:
+            SynetSqueezeExcitation16b(const SqueezeExcitation16bParam& p, void* scale);
+            virtual ~SynetSqueezeExcitation16b();
+
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float* weight0, const float* bias0, const float* params, const float* weight1, const float* bias1);
+            virtual void Forward(const uint8_t* src, uint8_t* dst);
+
+            typedef void(*ChannelSumPtr)(const uint8_t* src, size_t channels, size_t spatial, float* sum);
+            typedef void(*ExcitationPtr)(const float* sum, const SqueezeExcitation16bParam& p, const float* weight0, const float* bias0, 
+                const float* params, const float* weight1, const float* bias1, float* hidden, float* scale);
+
+        protected:
+            Simd::SynetScale16b* _scale;
+            ChannelSumPtr _channelSum;
+            ExcitationPtr _excitation;
+            size_t _srcE, _dstE;
+            Array32f _weight0, _bias0, _params, _weight1, _bias1, _buffer;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetSqueezeExcitation16bInit(size_t batch, size_t channels, size_t spatial, size_t squeeze, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdConvolutionActivationType activation);
+    }
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetSqueezeExcitation16b : public Base::SynetSqueezeExcitation16b
+        {
+        public:
+            SynetSqueezeExcitation16b(const SqueezeExcitation16bParam& p);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetSqueezeExcitation16bInit(size_t batch, size_t channels, size_t spatial, size_t squeeze, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdConvolutionActivationType activation);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class SynetSqueezeExcitation16b : public Base::SynetSqueezeExcitation16b
+        {
+        public:
+            SynetSqueezeExcitation16b(const SqueezeExcitation16bParam& p);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetSqueezeExcitation16bInit(size_t batch, size_t channels, size_t spatial, size_t squeeze, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdConvolutionActivationType activation);
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,199 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetWeightBlob_h__
+#define __SimdSynetWeightBlob_h__
+
+#include "Simd/SimdSynetConvParam.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdCpu.h"
+
+namespace Simd
+{
+    const char SYNET_WEIGHT_BLOB_SIGNATURE[8] = { 'S', 'i', 'm', 'd', 'S', 'W', 'B', 0 };
+    const uint32_t SYNET_WEIGHT_BLOB_VERSION = 1;
+    const size_t SYNET_WEIGHT_BLOB_TAG_SIZE = 160;
+
+    struct SynetWeightBlobHeader
+    {
+        char signature[8];
+        uint32_t version, paramSize;
+        uint64_t size;
+        char tag[SYNET_WEIGHT_BLOB_TAG_SIZE];
+        ConvParam param;
+    };
+
+    SIMD_INLINE String SynetWeightBlobTag(const String& desc)
+    {
+        std::stringstream tag;
+        tag << desc << " " << Base::AlgCacheL1() << "-" << Base::AlgCacheL2() << "-" << Base::AlgCacheL3() << " " << sizeof(void*);
+        return tag.str().substr(0, SYNET_WEIGHT_BLOB_TAG_SIZE - 1);
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    class SynetWeightBlobWriter
+    {
+    public:
+        SynetWeightBlobWriter(uint8_t* dst, size_t capacity, const ConvParam& param, const String& desc)
+            : _dst(dst)
+            , _capacity(capacity)
+            , _size(0)
+            , _header(NULL)
+        {
+            SynetWeightBlobHeader header;
+            memset(&header, 0, sizeof(header));
+            memcpy(header.signature, SYNET_WEIGHT_BLOB_SIGNATURE, sizeof(header.signature));
+            header.version = SYNET_WEIGHT_BLOB_VERSION;
+            header.paramSize = sizeof(ConvParam);
+            String tag = SynetWeightBlobTag(desc);
+            memcpy(header.tag, tag.c_str(), tag.size());
+            header.param = param;
+            if (Writable(sizeof(header)))
+                _header = (SynetWeightBlobHeader*)_dst;
+            WriteRaw(&header, sizeof(header));
+        }
+
+        template<class T> void Write(const T* data, size_t size)
+        {
+            uint64_t info[2] = { size, sizeof(T) };
+            WriteRaw(info, sizeof(info));
+            WriteRaw(data, size * sizeof(T));
+        }
+
+        template<class T> void Write(const Array<T>& array)
+        {
+            Write(array.data, array.size);
+        }
+
+        template<class T> void Write(const SharedArray<T>& array)
+        {
+            Write(array.data, array.size);
+        }
+
+        size_t Finish()
+        {
+            if (_header)
+                _header->size = _size;
+            return _size;
+        }
+
+    private:
+        uint8_t* _dst;
+        size_t _capacity, _size;
+        SynetWeightBlobHeader* _header;
+
+        bool Writable(size_t size) const
+        {
+            return _dst && AlignHi(_size + size, SIMD_ALIGN) <= _capacity;
+        }
+
+        void WriteRaw(const void* data, size_t size)
+        {
+            if (Writable(size) && size)
+                memcpy(_dst + _size, data, size);
+            _size = AlignHi(_size + size, SIMD_ALIGN);
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class SynetWeightBlobReader
+    {
+    public:
+        SynetWeightBlobReader(const uint8_t* src, size_t size, const ConvParam& param, const String& desc)
+            : _src(src)
+            , _size(size)
+            , _pos(0)
+            , _ok(false)
+        {
+            const SynetWeightBlobHeader* header = (const SynetWeightBlobHeader*)Read(sizeof(SynetWeightBlobHeader));
+            if (header == NULL || memcmp(header->signature, SYNET_WEIGHT_BLOB_SIGNATURE, sizeof(header->signature)) ||
+                header->version != SYNET_WEIGHT_BLOB_VERSION || header->paramSize != sizeof(ConvParam) || header->size > size)
+                return;
+            String tag = SynetWeightBlobTag(desc);
+            if (strncmp(header->tag, tag.c_str(), SYNET_WEIGHT_BLOB_TAG_SIZE) != 0 || !header->param.Equal(param))
+                return;
+            _ok = true;
+        }
+
+        bool Ok() const
+        {
+            return _ok;
+        }
+
+        template<class T> const T* Read(size_t& size)
+        {
+            const uint64_t* info = (const uint64_t*)Read(sizeof(uint64_t) * 2);
+            if (info == NULL || info[1] != sizeof(T))
+            {
+                _ok = false;
+                return NULL;
+            }
+            size = (size_t)info[0];
+            const T* data = (const T*)Read(size * sizeof(T));
+            if (data == NULL)
+                _ok = false;
+            return data;
+        }
+
+        template<class T> bool Read(Array<T>& array)
+        {
+            size_t size;
+            const T* data = Read<T>(size);
+            if (_ok)
+                array.Assign(data, size);
+            return _ok;
+        }
+
+        template<class T> bool Read(SharedArray<T>& array)
+        {
+            size_t size;
+            const T* data = Read<T>(size);
+            if (_ok)
+            {
+                if (Simd::Aligned(data, SIMD_ALIGN))
+                    array.External((T*)data, size);
+                else
+                    array.Assign(data, size);
+            }
+            return _ok;
+        }
+
+    private:
+        const uint8_t* _src;
+        size_t _size, _pos;
+        bool _ok;
+
+        const uint8_t* Read(size_t size)
+        {
+            if (_src == NULL || _pos + size > _size)
+                return NULL;
+            const uint8_t* data = _src + _pos;
+            _pos = AlignHi(_pos + size, SIMD_ALIGN);
+            return data;
+        }
+    };
+}
+
+#endif
@@ -217,6 +217,8 @@ namespace Test
 
     TEST_ADD_GROUP_A0(Gemm32fNN);
     TEST_ADD_GROUP_A0(Gemm32fNT);
+    TEST_ADD_GROUP_A0(Gemm32fBatched);
+    TEST_ADD_GROUP_A0(Gemm32fNNcb);
 
     TEST_ADD_GROUP_A0(ImageSaveToMemory);
     TEST_ADD_GROUP_A0(Nv12SaveAsJpegToMemory);
@@ -352,6 +354,8 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetAdd8i);
     TEST_ADD_GROUP_A0(SynetAdd16b);
 
+    TEST_ADD_GROUP_A0(SynetAttention);
+
     TEST_ADD_GROUP_A0(SynetChannelSum16b);
     TEST_ADD_GROUP_A0(SynetEltwiseLayerForward);
     TEST_ADD_GROUP_A0(SynetLrnLayerCrossChannels);
@@ -377,10 +381,27 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetSetInput);
 
     TEST_ADD_GROUP_A0(SynetConvolution8iForward);
+    TEST_ADD_GROUP_A0(SynetConvolution8iShareParams);
+    TEST_ADD_GROUP_A0(SynetConvolution8iExportImport);
+    TEST_ADD_GROUP_A0(SynetConvolution8iThreads);
 
     TEST_ADD_GROUP_A0(SynetConvolution16bForward);
+    TEST_ADD_GROUP_A0(SynetConvolution16bShareParams);
+    TEST_ADD_GROUP_A0(SynetConvolution16bDynamic);
+    TEST_ADD_GROUP_A0(SynetConvolution16bExportImport);
+    TEST_ADD_GROUP_A0(SynetConvolution16bWinograd);
+    TEST_ADD_GROUP_A0(SynetConvolution16bPooled);
+    TEST_ADD_GROUP_A0(SynetConvolution16bThreads);
 
     TEST_ADD_GROUP_A0(SynetConvolution32fForward);
+    TEST_ADD_GROUP_A0(SynetConvolution32fTuned);
+    TEST_ADD_GROUP_A0(SynetConvolution32fRuntimeCache);
+    TEST_ADD_GROUP_A0(SynetConvolution32fDynamic);
+    TEST_ADD_GROUP_A0(SynetConvolution32fPooled);
+    TEST_ADD_GROUP_A0(SynetConvolution32fThreads);
+
+    TEST_ADD_GROUP_A0(SynetConvolutionConverter);
+    TEST_ADD_GROUP_A0(SynetCalibrator);
 
     TEST_ADD_GROUP_A0(SynetDeconvolution32fForward);
 
@@ -395,6 +416,7 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetInnerProduct8i);
 
     TEST_ADD_GROUP_A0(SynetInnerProduct16bForward);
+    TEST_ADD_GROUP_A0(Gemm16b);
 
     TEST_ADD_GROUP_A0(SynetMergedConvolution8iForward);
 
@@ -402,6 +424,9 @@ namespace Test
 
     TEST_ADD_GROUP_A0(SynetMergedConvolution32fForward);
 
+    TEST_ADD_GROUP_A0(SynetNetworkForward);
+    TEST_ADD_GROUP_A0(SynetMemoryPlanner);
+
     TEST_ADD_GROUP_A0(SynetNormalizeLayerForward);
     TEST_ADD_GROUP_A0(SynetNormalizeLayerForwardV2);
     TEST_ADD_GROUP_A0(SynetNormalizeLayerForwardV3);
@@ -409,12 +434,16 @@ namespace Test
 
     TEST_ADD_GROUP_A0(SynetNormalizeLayerForward16bV2);
 
+    TEST_ADD_GROUP_A0(SynetLayerNorm32f);
+    TEST_ADD_GROUP_A0(SynetLayerNorm16b);
+
     TEST_ADD_GROUP_A0(SynetPermute);
 
     TEST_ADD_GROUP_A0(SynetPoolingAverage);
     TEST_ADD_GROUP_A0(SynetPoolingMax32f);
     TEST_ADD_GROUP_A0(SynetPoolingMax16b);
     TEST_ADD_GROUP_A0(SynetPoolingMax8u);
+    TEST_ADD_GROUP_A0(SynetPoolingAdaptive);
 
     TEST_ADD_GROUP_A0(SynetQuantizedPreluLayerForward);
 
@@ -423,6 +452,7 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetQuantizedConcatLayerForward);
 
     TEST_ADD_GROUP_A0(SynetQuantizedConvolutionForward);
+    TEST_ADD_GROUP_A0(SynetQuantizedConvolutionThreads);
 
     TEST_ADD_GROUP_A0(SynetQuantizedInnerProductForward);
 
@@ -438,9 +468,12 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetScaleLayerForward);
     TEST_ADD_GROUP_A0(SynetScale8iForward);
     TEST_ADD_GROUP_A0(SynetScale16b);
+    TEST_ADD_GROUP_A0(SynetSqueezeExcitation16b);
 
     TEST_ADD_GROUP_A0(SynetSoftmax32f);
     TEST_ADD_GROUP_A0(SynetSoftmax16b);
+    TEST_ADD_GROUP_A0(SynetSoftmaxMasked);
+    TEST_ADD_GROUP_A0(SynetSoftmaxTopK);
 
     TEST_ADD_GROUP_A0(SynetUnaryOperation32f);
 #endif
@@ -313,4 +313,232 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    enum Gemm32fBatchedType
+    {
+        Gemm32fBatchedNN,
+        Gemm32fBatchedNNStrided,
+        Gemm32fBatchedNTStrided,
+    };
+
+    bool Gemm32fBatchedAutoTest(Gemm32fBatchedType type, size_t batch, size_t M, size_t N, size_t K, bool sharedB, size_t gap)
+    {
+        bool result = true;
+
+        bool nt = type == Gemm32fBatchedNTStrided;
+        const char* names[3] = { "SimdGemm32fNNBatched", "SimdGemm32fNNStridedBatched", "SimdGemm32fNTStridedBatched" };
+        std::stringstream desc;
+        desc << names[type] << "[" << batch << "x" << M << "-" << N << "-" << K << (sharedB ? "-s" : "") << (gap ? "-g" : "") << "]";
+
+        TEST_LOG_SS(Info, "Test " << desc.str() << " & " << (nt ? "SimdGemm32fNT" : "SimdGemm32fNN") << " .");
+
+        size_t lda = K + gap, ldb = (nt ? K : N) + gap, ldc = N + gap;
+        size_t strideA = M * lda + gap, strideB = sharedB ? 0 : (nt ? N : K) * ldb + gap, strideC = M * ldc + gap;
+        Tensor32f A({ batch * strideA }), B({ sharedB ? (nt ? N : K) * ldb : batch * strideB }), C1({ batch * strideC }), C2({ batch * strideC });
+
+        const float alpha = 1.5f, beta = 0.5f;
+        FillRandom(A.Data(), A.Size(), -1.0, 1.0f);
+        FillRandom(B.Data(), B.Size(), -1.0, 1.0f);
+        FillRandom(C1.Data(), C1.Size(), -1.0, 1.0f);
+        memcpy(C2.Data(), C1.Data(), C1.Size() * sizeof(float));
+
+        std::vector<const float*> pA(batch), pB(batch);
+        std::vector<float*> pC(batch);
+        for (size_t b = 0; b < batch; ++b)
+        {
+            pA[b] = A.Data() + b * strideA;
+            pB[b] = B.Data() + b * strideB;
+            pC[b] = C1.Data() + b * strideC;
+        }
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        {
+            TEST_PERFORMANCE_TEST(desc.str());
+            if (type == Gemm32fBatchedNN)
+                SimdGemm32fNNBatched(batch, M, N, K, &alpha, pA.data(), lda, pB.data(), ldb, &beta, pC.data(), ldc);
+            else if (type == Gemm32fBatchedNNStrided)
+                SimdGemm32fNNStridedBatched(batch, M, N, K, &alpha, A.Data(), lda, strideA, B.Data(), ldb, strideB, &beta, C1.Data(), ldc, strideC);
+            else
+                SimdGemm32fNTStridedBatched(batch, M, N, K, &alpha, A.Data(), lda, strideA, B.Data(), ldb, strideB, &beta, C1.Data(), ldc, strideC);
+        }
+
+        for (size_t b = 0; b < batch; ++b)
+        {
+            if (nt)
+                SimdGemm32fNT(M, N, K, &alpha, A.Data() + b * strideA, lda, B.Data() + b * strideB, ldb, &beta, C2.Data() + b * strideC, ldc);
+            else
+                SimdGemm32fNN(M, N, K, &alpha, A.Data() + b * strideA, lda, B.Data() + b * strideB, ldb, &beta, C2.Data() + b * strideC, ldc);
+        }
+
+        result = result && Compare(C1, C2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool Gemm32fBatchedAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        result = result && Gemm32fBatchedAutoTest(Gemm32fBatchedNN, 12, 197, 64, 64, false, 0);
+        result = result && Gemm32fBatchedAutoTest(Gemm32fBatchedNN, 7, 33, 45, 17, false, 3);
+        result = result && Gemm32fBatchedAutoTest(Gemm32fBatchedNNStrided, 12, 197, 64, 197, false, 0);
+        result = result && Gemm32fBatchedAutoTest(Gemm32fBatchedNNStrided, 7, 33, 45, 17, false, 3);
+        result = result && Gemm32fBatchedAutoTest(Gemm32fBatchedNNStrided, 16, 49, 96, 96, true, 0);
+        result = result && Gemm32fBatchedAutoTest(Gemm32fBatchedNNStrided, 5, 31, 40, 24, true, 2);
+        result = result && Gemm32fBatchedAutoTest(Gemm32fBatchedNNStrided, 2, 512, 512, 512, false, 0);
+        result = result && Gemm32fBatchedAutoTest(Gemm32fBatchedNTStrided, 12, 197, 197, 64, false, 0);
+        result = result && Gemm32fBatchedAutoTest(Gemm32fBatchedNTStrided, 16, 49, 96, 96, true, 0);
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool Gemm32fNNcbAutoTest(size_t N, size_t K, const Shape& Ms)
+    {
+        bool result = true;
+
+        std::stringstream desc;
+        desc << "SimdGemm32fNNcbRun[" << N << "-" << K << "]";
+
+        TEST_LOG_SS(Info, "Test " << desc.str() << " & SimdGemm32fNN .");
+
+        Tensor32f B(Shape({ K, N })), tmp(Shape({ K, N }));
+        FillRandom(B.Data(), B.Size(), -1.0f, 1.0f);
+        tmp.Clone(B);
+
+        void* context = SimdGemm32fNNcbInit(N, K, tmp.Data());
+        Fill(tmp, 0.0f);
+
+        const float alpha = 1.0f, beta = 0.0f;
+        for (size_t i = 0; i < Ms.size() && result; ++i)
+        {
+            size_t M = Ms[i];
+            Tensor32f A(Shape({ M, K })), C1(Shape({ M, N })), C2(Shape({ M, N }));
+            FillRandom(A.Data(), A.Size(), -1.0f, 1.0f);
+            Fill(C1, 1.0f);
+            Fill(C2, 2.0f);
+
+            {
+                TEST_PERFORMANCE_TEST(desc.str());
+                SimdGemm32fNNcbRun(context, M, A.Data(), C1.Data());
+            }
+
+            SimdGemm32fNN(M, N, K, &alpha, A.Data(), K, B.Data(), N, &beta, C2.Data(), N);
+
+            result = result && Compare(C1, C2, EPS, true, 32, DifferenceBoth);
+        }
+        SimdRelease(context);
+
+        return result;
+    }
+
+    bool Gemm32fNNcbAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        result = result && Gemm32fNNcbAutoTest(64, 128, Shape({ 1, 7, 64, 197 }));
+        result = result && Gemm32fNNcbAutoTest(5, 33, Shape({ 3, 17, 1 }));
+        result = result && Gemm32fNNcbAutoTest(47, 19, Shape({ 13, 1, 100 }));
+        result = result && Gemm32fNNcbAutoTest(256, 512, Shape({ 1, 16, 512 }));
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+#if defined(SIMD_SYNET_ENABLE)
+    static void Gemm16bConvert(const Tensor32f& src, SimdTensorDataType type, Tensor16u& dst16, Tensor32f& dst32)
+    {
+        Tensor16u bf16(src.Shape());
+        if (type == SimdTensorData16f)
+        {
+            SimdFloat32ToFloat16(src.Data(), src.Size(), dst16.Data());
+            SimdFloat16ToFloat32(dst16.Data(), src.Size(), dst32.Data());
+            SimdFloat32ToBFloat16(dst32.Data(), src.Size(), bf16.Data());
+        }
+        else
+        {
+            SimdFloat32ToBFloat16(src.Data(), src.Size(), dst16.Data());
+            SimdFloat32ToBFloat16(src.Data(), src.Size(), bf16.Data());
+        }
+        SimdBFloat16ToFloat32(bf16.Data(), src.Size(), dst32.Data());
+    }
+
+    bool Gemm16bAutoTest(size_t M, size_t N, size_t K, SimdTensorDataType typeA, SimdTensorDataType typeB, SimdTensorDataType typeC, SimdBool transB, SimdBool constB)
+    {
+        bool result = true;
+
+        void* context = SimdGemm16bInit(M, N, K, typeA, typeB, typeC, transB, constB);
+        if (context == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't create SimdGemm16b context!");
+            return false;
+        }
+        std::stringstream desc;
+        desc << "SimdGemm16b[" << SimdGemm16bInfo(context) << "]";
+
+        TEST_LOG_SS(Info, "Test " << desc.str() << " & SimdGemm32f" << (transB ? "NT" : "NN") << " .");
+
+        Shape sA = Shape({ M, K }), sB = transB ? Shape({ N, K }) : Shape({ K, N }), sC = Shape({ M, N });
+        Tensor32f A(sA), B(sB), A32f(sA), B32f(sB), C32f(sC), C1(sC), C2(sC);
+        Tensor16u A16(sA), B16(sB), C16(sC);
+        FillRandom(A.Data(), A.Size(), -1.0f, 1.0f);
+        FillRandom(B.Data(), B.Size(), -1.0f, 1.0f);
+        Gemm16bConvert(A, typeA, A16, A32f);
+        Gemm16bConvert(B, typeB, B16, B32f);
+
+        const uint8_t* pA = typeA == SimdTensorData32f ? (uint8_t*)A.Data() : (uint8_t*)A16.Data();
+        const uint8_t* pB = typeB == SimdTensorData32f ? (uint8_t*)B.Data() : (uint8_t*)B16.Data();
+        uint8_t* pC = typeC == SimdTensorData32f ? (uint8_t*)C1.Data() : (uint8_t*)C16.Data();
+
+        if (constB)
+            SimdGemm16bSetB(context, pB);
+
+        Tensor8u buf(Shape({ SimdGemm16bExternalBufferSize(context) }));
+
+        {
+            TEST_PERFORMANCE_TEST(desc.str());
+            SimdGemm16bRun(context, pA, constB ? NULL : pB, buf.Data(), pC);
+        }
+        SimdRelease(context);
+
+        if (typeC == SimdTensorData16b)
+            SimdBFloat16ToFloat32(C16.Data(), C16.Size(), C1.Data());
+        else if (typeC == SimdTensorData16f)
+            SimdFloat16ToFloat32(C16.Data(), C16.Size(), C1.Data());
+
+        const float alpha = 1.0f, beta = 0.0f;
+        if (transB)
+            SimdGemm32fNT(M, N, K, &alpha, A32f.Data(), K, B32f.Data(), K, &beta, C2.Data(), N);
+        else
+            SimdGemm32fNN(M, N, K, &alpha, A32f.Data(), K, B32f.Data(), N, &beta, C2.Data(), N);
+
+        float eps = typeC == SimdTensorData16b ? EPS * 8.0f : EPS;
+        result = result && Compare(C1, C2, eps, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool Gemm16bAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b, f16 = SimdTensorData16f;
+        const SimdBool t = SimdTrue, f = SimdFalse;
+
+        result = result && Gemm16bAutoTest(127, 129, 131, b16, b16, f32, f, t);
+        result = result && Gemm16bAutoTest(127, 129, 131, b16, b16, f32, f, f);
+        result = result && Gemm16bAutoTest(128, 128, 128, f32, f32, b16, t, t);
+        result = result && Gemm16bAutoTest(64, 96, 80, f32, b16, f32, t, f);
+        result = result && Gemm16bAutoTest(97, 65, 77, f16, f16, f16, f, t);
+        result = result && Gemm16bAutoTest(97, 65, 77, f16, f16, f32, t, f);
+        result = result && Gemm16bAutoTest(1, 512, 1024, b16, b16, f32, t, t);
+
+        return result;
+    }
+#endif
 }
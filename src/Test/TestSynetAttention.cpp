@@ -0,0 +1,211 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+#include "Test/TestOptions.h"
+
+#include "Simd/SimdSynetAttention.h"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        struct FuncAtt
+        {
+            typedef void*(*FuncPtr)(size_t batch, size_t heads, size_t queries, size_t keys, size_t size, SimdTensorDataType srcType, SimdTensorDataType dstType, float scale);
+
+            FuncPtr func;
+            String desc;
+
+            FuncAtt(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(size_t batch, size_t heads, size_t queries, size_t keys, size_t size, SimdTensorDataType srcType, SimdTensorDataType dstType)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << batch << "x" << heads << "x" << queries << "x" << keys << "x" << size;
+                ss << "-" << ToChar(srcType) << ToChar(dstType) << "]";
+                desc = ss.str();
+            }
+
+            void Call(void * context, const uint8_t * q, const uint8_t* k, const uint8_t* v, uint8_t* buf, uint8_t * dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetAttentionForward(context, q, k, v, buf, dst);
+            }
+
+            static char ToChar(SimdTensorDataType type)
+            {
+                return type == SimdTensorData32f ? 'f' : 'b';
+            }
+        };
+    }
+
+#define FUNC_ATT(function) FuncAtt(function, #function)
+
+    static void SynetAttentionReference(const float* q, const float* k, const float* v, size_t batch, size_t heads, size_t queries, size_t keys, size_t size, float scale, float* dst)
+    {
+        size_t stride = heads * size;
+        std::vector<float> s(keys);
+        for (size_t b = 0; b < batch; ++b)
+        {
+            for (size_t h = 0; h < heads; ++h)
+            {
+                for (size_t i = 0; i < queries; ++i)
+                {
+                    const float* qi = q + (b * queries + i) * stride + h * size;
+                    float max = -FLT_MAX, sum = 0;
+                    for (size_t j = 0; j < keys; ++j)
+                    {
+                        const float* kj = k + (b * keys + j) * stride + h * size;
+                        float dot = 0;
+                        for (size_t c = 0; c < size; ++c)
+                            dot += qi[c] * kj[c];
+                        s[j] = dot * scale;
+                        max = std::max(max, s[j]);
+                    }
+                    for (size_t j = 0; j < keys; ++j)
+                    {
+                        s[j] = ::expf(s[j] - max);
+                        sum += s[j];
+                    }
+                    float* di = dst + (b * queries + i) * stride + h * size;
+                    for (size_t c = 0; c < size; ++c)
+                        di[c] = 0;
+                    for (size_t j = 0; j < keys; ++j)
+                    {
+                        const float* vj = v + (b * keys + j) * stride + h * size;
+                        for (size_t c = 0; c < size; ++c)
+                            di[c] += s[j] / sum * vj[c];
+                    }
+                }
+            }
+        }
+    }
+
+    bool SynetAttentionAutoTest(size_t batch, size_t heads, size_t queries, size_t keys, size_t size, SimdTensorDataType srcType, SimdTensorDataType dstType, FuncAtt f1, FuncAtt f2)
+    {
+        bool result = true;
+
+        f1.Update(batch, heads, queries, keys, size, srcType, dstType);
+        f2.Update(batch, heads, queries, keys, size, srcType, dstType);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " .");
+
+        float scale = 1.0f / ::sqrtf(float(size));
+        Tensor32f qf({ batch, queries, heads, size }), kf({ batch, keys, heads, size }), vf({ batch, keys, heads, size });
+        FillRandom(qf.Data(), qf.Size(), -2.0f, 2.0f);
+        FillRandom(kf.Data(), kf.Size(), -2.0f, 2.0f);
+        FillRandom(vf.Data(), vf.Size(), -1.0f, 1.0f);
+        Tensor16u qb(qf.Shape()), kb(kf.Shape()), vb(vf.Shape());
+        if (srcType == SimdTensorData16b)
+        {
+            SimdFloat32ToBFloat16(qf.Data(), qf.Size(), qb.Data());
+            SimdFloat32ToBFloat16(kf.Data(), kf.Size(), kb.Data());
+            SimdFloat32ToBFloat16(vf.Data(), vf.Size(), vb.Data());
+            SimdBFloat16ToFloat32(qb.Data(), qb.Size(), qf.Data());
+            SimdBFloat16ToFloat32(kb.Data(), kb.Size(), kf.Data());
+            SimdBFloat16ToFloat32(vb.Data(), vb.Size(), vf.Data());
+        }
+        const uint8_t* q = srcType == SimdTensorData32f ? (uint8_t*)qf.Data() : (uint8_t*)qb.Data();
+        const uint8_t* k = srcType == SimdTensorData32f ? (uint8_t*)kf.Data() : (uint8_t*)kb.Data();
+        const uint8_t* v = srcType == SimdTensorData32f ? (uint8_t*)vf.Data() : (uint8_t*)vb.Data();
+
+        Tensor32f dst1f(qf.Shape()), dst2f(qf.Shape()), dst3f(qf.Shape());
+        Tensor16u dst1b(qf.Shape()), dst2b(qf.Shape());
+        uint8_t* dst1 = dstType == SimdTensorData32f ? (uint8_t*)dst1f.Data() : (uint8_t*)dst1b.Data();
+        uint8_t* dst2 = dstType == SimdTensorData32f ? (uint8_t*)dst2f.Data() : (uint8_t*)dst2b.Data();
+
+        void* context1 = f1.func(batch, heads, queries, keys, size, srcType, dstType, scale);
+        void* context2 = f2.func(batch, heads, queries, keys, size, srcType, dstType, scale);
+
+        Tensor8u buf1({ ::SimdSynetAttentionExternalBufferSize(context1) }), buf2({ ::SimdSynetAttentionExternalBufferSize(context2) });
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, q, k, v, buf1.Data(), dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, q, k, v, buf2.Data(), dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        if (dstType == SimdTensorData16b)
+        {
+            SimdBFloat16ToFloat32(dst1b.Data(), dst1b.Size(), dst1f.Data());
+            SimdBFloat16ToFloat32(dst2b.Data(), dst2b.Size(), dst2f.Data());
+        }
+        SynetAttentionReference(qf.Data(), kf.Data(), vf.Data(), batch, heads, queries, keys, size, scale, dst3f.Data());
+
+        float eps = dstType == SimdTensorData32f ? EPS : EPS * 8.0f;
+        result = result && Compare(dst1f, dst2f, eps, true, 64, DifferenceBoth, "f1 & f2");
+        result = result && Compare(dst1f, dst3f, eps, true, 64, DifferenceBoth, "f1 & reference");
+
+        return result;
+    }
+
+    bool SynetAttentionAutoTest(const FuncAtt& f1, const FuncAtt& f2)
+    {
+        bool result = true;
+
+        const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+
+        result = result && SynetAttentionAutoTest(1, 3, 197, 197, 64, f32, f32, f1, f2);
+        result = result && SynetAttentionAutoTest(1, 3, 197, 197, 64, b16, f32, f1, f2);
+        result = result && SynetAttentionAutoTest(1, 3, 197, 197, 64, b16, b16, f1, f2);
+        result = result && SynetAttentionAutoTest(2, 2, 50, 77, 40, f32, f32, f1, f2);
+        result = result && SynetAttentionAutoTest(2, 2, 50, 77, 40, f32, b16, f1, f2);
+#ifdef NDEBUG
+        result = result && SynetAttentionAutoTest(1, 6, 1024, 1024, 64, f32, f32, f1, f2);
+        result = result && SynetAttentionAutoTest(1, 6, 1024, 1024, 64, b16, b16, f1, f2);
+#endif
+
+        return result;
+    }
+
+    bool SynetAttentionAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && SynetAttentionAutoTest(FUNC_ATT(Simd::Base::SynetAttentionInit), FUNC_ATT(SimdSynetAttentionInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && SynetAttentionAutoTest(FUNC_ATT(Simd::Avx2::SynetAttentionInit), FUNC_ATT(SimdSynetAttentionInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && SynetAttentionAutoTest(FUNC_ATT(Simd::Avx512bw::SynetAttentionInit), FUNC_ATT(SimdSynetAttentionInit));
+#endif 
+
+        return result;
+    }
+#endif
+}
@@ -0,0 +1,228 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+#include "Test/TestOptions.h"
+#include "Test/TestSynetConvolutionParam.h"
+
+#include "Simd/SimdSynetConverter.hpp"
+#include "Simd/SimdSynetCalibrator.hpp"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        typedef Test::SynetConvolutionParam<false> Param;
+        typedef Simd::SynetConvolutionConverter Converter;
+    }
+
+    bool SynetConvolutionConverterAutoTest(const Param& p)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetConvolutionConverter " << p.Decription() << ".");
+
+        const SimdConvolutionParameters& c = p.conv;
+        Tensor32f src({ p.batch, c.srcH, c.srcW, c.srcC });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight({ c.kernelY, c.kernelX, c.srcC / c.group, c.dstC }), bias({ c.dstC }), params({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+
+        Tensor32f dst({ p.batch, c.dstH, c.dstW, c.dstC });
+        {
+            void* context = ::SimdSynetConvolution32fInit(p.batch, &c);
+            ::SimdSynetConvolution32fSetParams(context, weight.Data(), NULL, bias.Data(), params.Data());
+            ::SimdSynetConvolution32fForward(context, src.Data(), NULL, dst.Data());
+            ::SimdRelease(context);
+        }
+
+        Tensor32f srcMin({ c.srcC }, SimdTensorFormatUnknown, FLT_MAX), srcMax({ c.srcC }, SimdTensorFormatUnknown, -FLT_MAX);
+        Tensor32f dstMin({ c.dstC }, SimdTensorFormatUnknown, FLT_MAX), dstMax({ c.dstC }, SimdTensorFormatUnknown, -FLT_MAX);
+        for (size_t i = 0; i < src.Size(); ++i)
+        {
+            size_t ch = i % c.srcC;
+            srcMin.Data()[ch] = Simd::Min(srcMin.Data()[ch], src.Data()[i]);
+            srcMax.Data()[ch] = Simd::Max(srcMax.Data()[ch], src.Data()[i]);
+        }
+        float range = 0;
+        for (size_t i = 0; i < dst.Size(); ++i)
+        {
+            size_t ch = i % c.dstC;
+            dstMin.Data()[ch] = Simd::Min(dstMin.Data()[ch], dst.Data()[i]);
+            dstMax.Data()[ch] = Simd::Max(dstMax.Data()[ch], dst.Data()[i]);
+            range = Simd::Max(range, ::fabs(dst.Data()[i]));
+        }
+        const float* stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+
+        Converter converter(p.batch, c, weight.Data(), bias.Data(), params.Data(), stats);
+
+        converter.Check(src.Data());
+
+        const char* names[Converter::PrecisionSize] = { "32f", "16b", "8i", "8u" };
+        const float limits[Converter::PrecisionSize] = { 0.0f, 0.02f, 0.05f, 0.05f };
+        for (int i = 0; i < Converter::PrecisionSize; ++i)
+        {
+            Converter::Precision precision = (Converter::Precision)i;
+            if (!converter.Enable(precision))
+                continue;
+            const Converter::Error& error = converter.GetError(precision);
+            TEST_LOG_SS(Info, " " << names[i] << " " << converter.Info(precision) << " : max = " << error.max << ", mean = " << error.mean << ".");
+            if (!error.checked || error.max > limits[i] * range)
+            {
+                TEST_LOG_SS(Error, "Too big error of " << names[i] << " precision: " << error.max << " > " << limits[i] * range << " !");
+                result = false;
+            }
+        }
+        if (!converter.Enable(Converter::Precision32f) || !converter.Enable(Converter::Precision16b) || !converter.Enable(Converter::Precision8i))
+        {
+            TEST_LOG_SS(Error, "Can't create FP32, BF16 or INT8 context!");
+            result = false;
+        }
+
+        if (converter.Select(FLT_MAX) == Converter::Precision32f || converter.Select(-1.0f) != Converter::Precision32f)
+        {
+            TEST_LOG_SS(Error, "Wrong precision selection!");
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool SynetConvolutionConverterAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _3(3, 3);
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu;
+
+        result = result && SynetConvolutionConverterAutoTest(Param(1, 32, 16, 16, 32, _3, _1, _1, _1, _1, 1, aId, SimdTrue));
+        result = result && SynetConvolutionConverterAutoTest(Param(1, 64, 12, 12, 48, _1, _1, _1, _0, _0, 1, aRe, SimdTrue));
+        result = result && SynetConvolutionConverterAutoTest(Param(2, 32, 10, 10, 32, _3, _1, _1, _1, _1, 32, aId, SimdTrue));
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetCalibratorAutoTest(const Param& p, size_t samples)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetCalibrator " << p.Decription() << " with " << samples << " samples.");
+
+        typedef Simd::SynetCalibrator Calibrator;
+        const SimdConvolutionParameters& c = p.conv;
+        Tensor32f src({ p.batch, c.srcH, c.srcW, c.srcC }), dst({ p.batch, c.dstH, c.dstW, c.dstC });
+        Tensor32f weight({ c.kernelY, c.kernelX, c.srcC / c.group, c.dstC }), bias({ c.dstC }), params({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+
+        void* context = ::SimdSynetConvolution32fInit(p.batch, &c);
+        ::SimdSynetConvolution32fSetParams(context, weight.Data(), NULL, bias.Data(), params.Data());
+
+        Calibrator srcCalibrator(c.srcC, c.srcH * c.srcW, c.srcF), dstCalibrator(c.dstC, c.dstH * c.dstW, c.dstF);
+        Tensor32f dstMin({ c.dstC }, SimdTensorFormatUnknown, FLT_MAX), dstMax({ c.dstC }, SimdTensorFormatUnknown, -FLT_MAX);
+        for (size_t s = 0; s < samples; ++s)
+        {
+            FillRandom(src.Data(), src.Size(), -1.0f - float(s), 1.0f + float(s));
+            ::SimdSynetConvolution32fForward(context, src.Data(), NULL, dst.Data());
+            srcCalibrator.Update(src.Data(), p.batch);
+            dstCalibrator.Update(dst.Data(), p.batch);
+            for (size_t i = 0; i < dst.Size(); ++i)
+            {
+                size_t ch = i % c.dstC;
+                dstMin.Data()[ch] = Simd::Min(dstMin.Data()[ch], dst.Data()[i]);
+                dstMax.Data()[ch] = Simd::Max(dstMax.Data()[ch], dst.Data()[i]);
+            }
+        }
+        ::SimdRelease(context);
+
+        if (dstCalibrator.Count() != dst.Size() * samples)
+        {
+            TEST_LOG_SS(Error, "Wrong count of values: " << dstCalibrator.Count() << " != " << dst.Size() * samples << " !");
+            result = false;
+        }
+        for (size_t ch = 0; ch < c.dstC && result; ++ch)
+        {
+            if (dstCalibrator.Min()[ch] != dstMin.Data()[ch] || dstCalibrator.Max()[ch] != dstMax.Data()[ch])
+            {
+                TEST_LOG_SS(Error, "Wrong min/max of channel " << ch << " !");
+                result = false;
+            }
+        }
+
+        float mmLo, mmHi;
+        dstCalibrator.Range(Calibrator::MethodMinMax, mmLo, mmHi);
+        const char* names[3] = { "MinMax", "Percentile", "Entropy" };
+        for (int m = 0; m < 3 && result; ++m)
+        {
+            float lo, hi, scale;
+            uint8_t zero;
+            dstCalibrator.Range((Calibrator::Method)m, lo, hi);
+            dstCalibrator.Quantization((Calibrator::Method)m, scale, zero);
+            TEST_LOG_SS(Info, " " << names[m] << " : range [" << lo << ", " << hi << "], scale " << scale << ", zero " << int(zero) << ".");
+            if (lo < mmLo || hi > mmHi || lo >= hi || scale <= 0.0f)
+            {
+                TEST_LOG_SS(Error, "Wrong range of " << names[m] << " method!");
+                result = false;
+            }
+        }
+
+        Tensor32f srcMin({ c.srcC }), srcMax({ c.srcC });
+        srcCalibrator.Stats(Calibrator::MethodMinMax, srcMin.Data(), srcMax.Data());
+        dstCalibrator.Stats(Calibrator::MethodPercentile, dstMin.Data(), dstMax.Data());
+        const float* stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+        Simd::SynetConvolutionConverter converter(p.batch, c, weight.Data(), bias.Data(), params.Data(), stats);
+        if (result && !converter.Enable(Simd::SynetConvolutionConverter::Precision8i))
+        {
+            TEST_LOG_SS(Error, "Can't create INT8 context with collected statistics!");
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool SynetCalibratorAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _3(3, 3);
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu;
+
+        result = result && SynetCalibratorAutoTest(Param(1, 32, 16, 16, 32, _3, _1, _1, _1, _1, 1, aId, SimdTrue), 4);
+        result = result && SynetCalibratorAutoTest(Param(2, 64, 12, 12, 48, _1, _1, _1, _0, _0, 1, aRe, SimdTrue), 8);
+
+        return result;
+    }
+#endif
+}
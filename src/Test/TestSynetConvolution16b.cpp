@@ -55,6 +55,8 @@ namespace Test
                 extra << (p.conv.srcT == SimdTensorData32f ? "-f" : "-b");
                 extra << (p.conv.dstT == SimdTensorData32f ? "f" : "b");
                 extra << afs[p.conv.activation];
+                if (::SimdGetThreadNumber() > 1)
+                    extra << "-t" << ::SimdGetThreadNumber();
                 desc = desc + p.Decription(extra.str());
             }
 
@@ -663,5 +665,459 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution16bShareParamsAutoTest(const Param& p)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetConvolution16b shared parameters" << p.Decription() << ".");
+
+        const SimdConvolutionParameters& c = p.conv;
+        SimdSynetCompatibilityType comp = (SimdSynetCompatibilityType)(SimdSynetCompatibilityFmaUse | SimdSynetCompatibility16bfSoft);
+        Tensor32f weight(p.WeightShape()), other(p.WeightShape()), bias({ c.dstC }), params({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(other.Data(), other.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+        Tensor32f src(p.SrcShape(), c.srcF), dst1(p.DstShape(), c.dstF), dst2(p.DstShape(), c.dstF);
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+        Tensor8u buf;
+
+        void* context1 = ::SimdSynetConvolution16bInit(p.batch, &c, comp);
+        void* context2 = ::SimdSynetConvolution16bInit(p.batch, &c, comp);
+        void* context3 = ::SimdSynetConvolution16bInit(p.batch, &c, comp);
+        buf.Extend({ ::SimdSynetConvolution16bExternalBufferSize(context1) });
+        ::SimdSynetConvolution16bSetParams(context1, weight.Data(), bias.Data(), params.Data());
+        ::SimdSynetConvolution16bForward(context1, (uint8_t*)src.Data(), buf.Data(), (uint8_t*)dst1.Data());
+
+        if (!::SimdSynetConvolution16bShareParams(context2, context1) || !::SimdSynetConvolution16bShareParams(context3, context2))
+        {
+            TEST_LOG_SS(Error, "Can't share parameters of SynetConvolution16b!");
+            result = false;
+        }
+        ::SimdRelease(context1);
+        ::SimdSynetConvolution16bSetParams(context3, other.Data(), bias.Data(), params.Data());
+
+        ::SimdSynetConvolution16bForward(context2, (uint8_t*)src.Data(), buf.Data(), (uint8_t*)dst2.Data());
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        ::SimdRelease(context2);
+        ::SimdRelease(context3);
+
+        return result;
+    }
+
+    bool SynetConvolution16bShareParamsAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity;
+        const SimdTensorDataType f32 = SimdTensorData32f;
+
+        result = result && SynetConvolution16bShareParamsAutoTest(Param(1, 64, 16, 16, 96, _1, _1, _1, _0, _0, 1, aId, SimdTrue, f32, f32));
+        result = result && SynetConvolution16bShareParamsAutoTest(Param(1, 32, 20, 20, 48, _3, _1, _1, _1, _1, 1, aRe, SimdTrue, f32, f32));
+        result = result && SynetConvolution16bShareParamsAutoTest(Param(1, 32, 20, 20, 32, _3, _1, _1, _1, _1, 32, aRe, SimdTrue, f32, f32));
+        result = result && SynetConvolution16bShareParamsAutoTest(Param(1, 32, 20, 20, 48, _3, _1, _1, _1, _1, 1, aRe, SimdFalse, f32, f32));
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution16bDynamicAutoTest(const Param& p, const std::vector<Size>& sizes)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetConvolution16b dynamic shape" << p.Decription() << ".");
+
+        const SimdConvolutionParameters& c = p.conv;
+        SimdSynetCompatibilityType comp = (SimdSynetCompatibilityType)(SimdSynetCompatibilityFmaUse | SimdSynetCompatibility16bfSoft);
+        Tensor32f weight(p.WeightShape()), bias({ c.dstC }), params({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+
+        void* context2 = ::SimdSynetConvolution16bInitDynamic(p.batch, &c, comp);
+        void* context3 = ::SimdSynetConvolution16bInitDynamic(p.batch, &c, comp);
+        ::SimdSynetConvolution16bSetParams(context2, weight.Data(), bias.Data(), params.Data());
+
+        const size_t capacity = 8;
+        size_t maxInternal = ::SimdSynetConvolution16bInternalBufferSize(context2);
+        for (size_t i = 0; i < sizes.size() && result; ++i)
+        {
+            Param q(p.batch, c.srcC, sizes[i].y, sizes[i].x, c.dstC, Size(c.kernelX, c.kernelY), Size(c.dilationX, c.dilationY),
+                Size(c.strideX, c.strideY), Size(c.padX, c.padY), Size(c.padW, c.padH), c.group, c.activation, p.trans);
+            const SimdConvolutionParameters& d = q.conv;
+            Tensor32f src(q.SrcShape(), d.srcF), dst1(q.DstShape(), d.dstF), dst2(q.DstShape(), d.dstF);
+            FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+            Tensor8u buf1, buf2;
+
+            void* context1 = ::SimdSynetConvolution16bInit(q.batch, &d, comp);
+            ::SimdSynetConvolution16bSetParams(context1, weight.Data(), bias.Data(), params.Data());
+            buf1.Extend({ ::SimdSynetConvolution16bExternalBufferSize(context1) });
+            ::SimdSynetConvolution16bForward(context1, (uint8_t*)src.Data(), buf1.Data(), (uint8_t*)dst1.Data());
+            maxInternal = Simd::Max(maxInternal, ::SimdSynetConvolution16bInternalBufferSize(context1));
+            ::SimdRelease(context1);
+
+            if (!::SimdSynetConvolution16bReshape(context2, q.batch, d.srcH, d.srcW))
+            {
+                TEST_LOG_SS(Error, "Can't reshape SynetConvolution16b to " << d.srcH << "x" << d.srcW << " !");
+                result = false;
+                break;
+            }
+            buf2.Extend({ ::SimdSynetConvolution16bExternalBufferSize(context2) });
+            ::SimdSynetConvolution16bForward(context2, (uint8_t*)src.Data(), buf2.Data(), (uint8_t*)dst2.Data());
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+            size_t internal = ::SimdSynetConvolution16bInternalBufferSize(context2);
+            if (internal > capacity * maxInternal)
+            {
+                TEST_LOG_SS(Error, "Internal buffer of dynamic SynetConvolution16b grows: " << internal << " > " << capacity << " * " << maxInternal << " !");
+                result = false;
+            }
+
+            if (i + 1 == sizes.size() && result)
+            {
+                if (!::SimdSynetConvolution16bReshape(context3, q.batch, d.srcH, d.srcW) || !::SimdSynetConvolution16bShareParams(context3, context2))
+                {
+                    TEST_LOG_SS(Error, "Can't share parameters of dynamic SynetConvolution16b!");
+                    result = false;
+                    break;
+                }
+                buf2.Extend({ ::SimdSynetConvolution16bExternalBufferSize(context3) });
+                ::SimdSynetConvolution16bForward(context3, (uint8_t*)src.Data(), buf2.Data(), (uint8_t*)dst2.Data());
+                result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+            }
+        }
+
+        ::SimdRelease(context2);
+        ::SimdRelease(context3);
+
+        return result;
+    }
+
+    bool SynetConvolution16bDynamicAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity;
+        std::vector<Size> sizes = { Size(32, 24), Size(17, 33), Size(64, 48), Size(32, 24), Size(17, 33) }, many;
+        for (size_t i = 0; i < 20; ++i)
+            many.push_back(Size(16 + i, 24 + i % 3));
+        many.push_back(Size(16, 24));
+
+        result = result && SynetConvolution16bDynamicAutoTest(Param(1, 32, 24, 32, 48, _3, _1, _1, _1, _1, 1, aRe, SimdTrue), sizes);
+        result = result && SynetConvolution16bDynamicAutoTest(Param(1, 32, 24, 32, 32, _3, _1, _2, _1, _1, 32, aRe, SimdTrue), sizes);
+        result = result && SynetConvolution16bDynamicAutoTest(Param(1, 64, 24, 32, 48, _1, _1, _1, _0, _0, 1, aId, SimdTrue), sizes);
+        result = result && SynetConvolution16bDynamicAutoTest(Param(1, 64, 24, 32, 64, _3, _1, _1, _1, _1, 1, aRe, SimdTrue), many);
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution16bExportImportAutoTest(const Param& p)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetConvolution16b export/import parameters" << p.Decription() << ".");
+
+        const SimdConvolutionParameters& c = p.conv;
+        SimdSynetCompatibilityType comp = (SimdSynetCompatibilityType)(SimdSynetCompatibilityFmaUse | SimdSynetCompatibility16bfSoft);
+        Tensor32f weight(p.WeightShape()), bias({ c.dstC }), params({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+        Tensor32f src(p.SrcShape(), c.srcF), dst1(p.DstShape(), c.dstF), dst2(p.DstShape(), c.dstF);
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+        Tensor8u buf, blob;
+
+        void* context1 = ::SimdSynetConvolution16bInit(p.batch, &c, comp);
+        void* context2 = ::SimdSynetConvolution16bInit(p.batch, &c, comp);
+        buf.Extend({ ::SimdSynetConvolution16bExternalBufferSize(context1) });
+        ::SimdSynetConvolution16bSetParams(context1, weight.Data(), bias.Data(), params.Data());
+        ::SimdSynetConvolution16bForward(context1, (uint8_t*)src.Data(), buf.Data(), (uint8_t*)dst1.Data());
+
+        size_t size = ::SimdSynetConvolution16bExportParams(context1, NULL, 0);
+        blob.Extend({ size });
+        if (size == 0 || ::SimdSynetConvolution16bExportParams(context1, blob.Data(), size) != size)
+        {
+            TEST_LOG_SS(Error, "Can't export parameters of SynetConvolution16b!");
+            result = false;
+        }
+        ::SimdRelease(context1);
+
+        blob.Data()[0] ^= 1;
+        if (result && ::SimdSynetConvolution16bImportParams(context2, blob.Data(), size))
+        {
+            TEST_LOG_SS(Error, "SynetConvolution16b imports corrupted parameters!");
+            result = false;
+        }
+        blob.Data()[0] ^= 1;
+        if (result && !::SimdSynetConvolution16bImportParams(context2, blob.Data(), size))
+        {
+            TEST_LOG_SS(Error, "Can't import parameters of SynetConvolution16b!");
+            result = false;
+        }
+
+        if (result)
+        {
+            ::SimdSynetConvolution16bForward(context2, (uint8_t*)src.Data(), buf.Data(), (uint8_t*)dst2.Data());
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        }
+
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetConvolution16bExportImportAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity;
+        const SimdTensorDataType f32 = SimdTensorData32f;
+
+        result = result && SynetConvolution16bExportImportAutoTest(Param(1, 64, 16, 16, 96, _1, _1, _1, _0, _0, 1, aId, SimdTrue, f32, f32));
+        result = result && SynetConvolution16bExportImportAutoTest(Param(1, 32, 20, 20, 48, _3, _1, _1, _1, _1, 1, aRe, SimdTrue, f32, f32));
+        result = result && SynetConvolution16bExportImportAutoTest(Param(1, 32, 20, 20, 32, _3, _1, _1, _1, _1, 32, aRe, SimdTrue, f32, f32));
+        result = result && SynetConvolution16bExportImportAutoTest(Param(1, 32, 20, 20, 48, _3, _1, _1, _1, _1, 1, aRe, SimdFalse, f32, f32));
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution16bWinogradAutoTest(const Param& p, SimdSynetCompatibilityType winograd)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetConvolution16b Winograd" << (winograd & SimdSynetCompatibility16bWinograd4x4 ? "4x4" : "") << p.Decription() << ".");
+
+        const SimdConvolutionParameters& c = p.conv;
+        SimdSynetCompatibilityType comp1 = (SimdSynetCompatibilityType)(SimdSynetCompatibilityFmaUse | SimdSynetCompatibility16bfSoft);
+        SimdSynetCompatibilityType comp2 = (SimdSynetCompatibilityType)(comp1 | winograd);
+        Tensor32f weight(p.WeightShape()), bias({ c.dstC }), params({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+        Tensor32f src32f(p.SrcShape(), c.srcF), dst32f1(p.DstShape(), c.dstF), dst32f2(p.DstShape(), c.dstF);
+        Tensor16u src16u(p.SrcShape(), c.srcF), dst16u1(p.DstShape(), c.dstF), dst16u2(p.DstShape(), c.dstF);
+        FillRandom(src32f.Data(), src32f.Size(), -1.0, 1.0f);
+        SimdFloat32ToBFloat16(src32f.Data(), src32f.Size(), src16u.Data());
+
+        const uint8_t* src = c.srcT == SimdTensorData32f ? (uint8_t*)src32f.Data() : (uint8_t*)src16u.Data();
+        uint8_t* dst1 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : (uint8_t*)dst16u1.Data();
+        uint8_t* dst2 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : (uint8_t*)dst16u2.Data();
+
+        void* context1 = ::SimdSynetConvolution16bInit(p.batch, &c, comp1);
+        void* context2 = ::SimdSynetConvolution16bInit(p.batch, &c, comp2);
+        if (String(::SimdSynetConvolution16bInfo(context2)).find("Winograd") == String::npos)
+        {
+            TEST_LOG_SS(Error, "SynetConvolution16b doesn't use Winograd algorithm: " << ::SimdSynetConvolution16bInfo(context2) << " !");
+            result = false;
+        }
+        Tensor8u buf1({ ::SimdSynetConvolution16bExternalBufferSize(context1) }), buf2({ ::SimdSynetConvolution16bExternalBufferSize(context2) });
+        ::SimdSynetConvolution16bSetParams(context1, weight.Data(), bias.Data(), params.Data());
+        ::SimdSynetConvolution16bSetParams(context2, weight.Data(), bias.Data(), params.Data());
+
+        ::SimdSynetConvolution16bForward(context1, src, buf1.Data(), dst1);
+        {
+            TEST_PERFORMANCE_TEST(String("SynetConvolution16bWinograd") + p.Decription());
+            ::SimdSynetConvolution16bForward(context2, src, buf2.Data(), dst2);
+        }
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        if (c.dstT == SimdTensorData16b)
+        {
+            SimdBFloat16ToFloat32(dst16u1.Data(), dst16u1.Size(), dst32f1.Data());
+            SimdBFloat16ToFloat32(dst16u2.Data(), dst16u2.Size(), dst32f2.Data());
+        }
+        float* end = dst32f1.Data() + dst32f1.Size();
+        float range = *std::max_element(dst32f1.Data(), end) - *std::min_element(dst32f1.Data(), end);
+        float eps = (winograd & SimdSynetCompatibility16bWinograd4x4 ? 0.08f : 0.008f) * range;
+        result = result && Compare(dst32f1, dst32f2, eps, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetConvolution16bWinogradAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity, aPr = SimdConvolutionActivationPrelu;
+        const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+        const SimdSynetCompatibilityType w2 = SimdSynetCompatibility16bWinograd, w4 = (SimdSynetCompatibilityType)(w2 | SimdSynetCompatibility16bWinograd4x4);
+
+        result = result && SynetConvolution16bWinogradAutoTest(Param(1, 64, 32, 32, 64, _3, _1, _1, _1, _1, 1, aRe, SimdTrue, f32, f32), w2);
+        result = result && SynetConvolution16bWinogradAutoTest(Param(1, 48, 19, 21, 40, _3, _1, _1, _1, _1, 1, aId, SimdTrue, b16, b16), w2);
+        result = result && SynetConvolution16bWinogradAutoTest(Param(2, 32, 6, 6, 48, _3, _1, _1, _0, _0, 1, aPr, SimdTrue, b16, f32), w2);
+        result = result && SynetConvolution16bWinogradAutoTest(Param(1, 32, 20, 20, 32, _3, _1, _1, _1, _1, 1, aRe, SimdTrue, f32, b16), w2);
+        result = result && SynetConvolution16bWinogradAutoTest(Param(1, 64, 32, 32, 64, _3, _1, _1, _1, _1, 1, aRe, SimdTrue, f32, f32), w4);
+        result = result && SynetConvolution16bWinogradAutoTest(Param(1, 48, 19, 21, 40, _3, _1, _1, _1, _1, 1, aId, SimdTrue, b16, b16), w4);
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution16bPooledAutoTest(const Param& p, SimdSynetPoolingMethodType method, const Size& kernel)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetConvolution16b pooled" << p.Decription() << (method == SimdSynetPoolingMethodMax ? " max" : " avg") << kernel.y << "x" << kernel.x << ".");
+
+        const SimdConvolutionParameters& c = p.conv;
+        SimdSynetCompatibilityType comp = (SimdSynetCompatibilityType)(SimdSynetCompatibilityFmaUse | SimdSynetCompatibility16bfSoft);
+        size_t dstH = Simd::DivHi(c.dstH, kernel.y), dstW = Simd::DivHi(c.dstW, kernel.x);
+        Shape poolShape = p.trans ? Shape({ p.batch, dstH, dstW, c.dstC }) : Shape({ p.batch, c.dstC, dstH, dstW });
+        Tensor32f weight(p.WeightShape()), bias({ c.dstC }), params({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+        Tensor32f src32f(p.SrcShape(), c.srcF), conv(p.DstShape(), c.dstF), dst32f1(poolShape, c.dstF), dst32f2(poolShape, c.dstF);
+        Tensor16u src16u(p.SrcShape(), c.srcF), dst16u1(poolShape, c.dstF), dst16u2(poolShape, c.dstF);
+        FillRandom(src32f.Data(), src32f.Size(), -1.0, 1.0f);
+        SimdFloat32ToBFloat16(src32f.Data(), src32f.Size(), src16u.Data());
+        const uint8_t* src = c.srcT == SimdTensorData32f ? (uint8_t*)src32f.Data() : (uint8_t*)src16u.Data();
+        uint8_t* dst2 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : (uint8_t*)dst16u2.Data();
+
+        SimdConvolutionParameters c1 = c;
+        c1.dstT = SimdTensorData32f;
+        void* context1 = ::SimdSynetConvolution16bInit(p.batch, &c1, comp);
+        Tensor8u buf1({ ::SimdSynetConvolution16bExternalBufferSize(context1) });
+        ::SimdSynetConvolution16bSetParams(context1, weight.Data(), bias.Data(), params.Data());
+        ::SimdSynetConvolution16bForward(context1, src, buf1.Data(), (uint8_t*)conv.Data());
+        ::SimdRelease(context1);
+        for (size_t b = 0, sizeC = c.dstC * c.dstH * c.dstW, sizeP = c.dstC * dstH * dstW; b < p.batch; ++b)
+        {
+            if (method == SimdSynetPoolingMethodMax)
+                ::SimdSynetPoolingMax32f(conv.Data() + b * sizeC, c.dstC, c.dstH, c.dstW, 1, kernel.y, kernel.x, 1, kernel.y, kernel.x,
+                    0, 0, 0, dst32f1.Data() + b * sizeP, c.dstC, dstH, dstW, c.dstF);
+            else
+                ::SimdSynetPoolingAverage(conv.Data() + b * sizeC, c.dstC, c.dstH, c.dstW, kernel.y, kernel.x, kernel.y, kernel.x,
+                    0, 0, dst32f1.Data() + b * sizeP, dstH, dstW, SimdTrue, c.dstF);
+        }
+
+        void* context2 = ::SimdSynetConvolution16bInitPooled(p.batch, &c, comp, method, kernel.y, kernel.x);
+        if (context2 == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't init pooled SynetConvolution16b!");
+            return false;
+        }
+        Tensor8u buf2({ ::SimdSynetConvolution16bExternalBufferSize(context2) });
+        ::SimdSynetConvolution16bSetParams(context2, weight.Data(), bias.Data(), params.Data());
+        {
+            TEST_PERFORMANCE_TEST(String("SynetConvolution16bPooled") + p.Decription());
+            ::SimdSynetConvolution16bForward(context2, src, buf2.Data(), dst2);
+        }
+        ::SimdRelease(context2);
+
+        if (c.dstT == SimdTensorData16b)
+        {
+            SimdFloat32ToBFloat16(dst32f1.Data(), dst32f1.Size(), dst16u1.Data());
+            SimdBFloat16ToFloat32(dst16u1.Data(), dst16u1.Size(), dst32f1.Data());
+            SimdBFloat16ToFloat32(dst16u2.Data(), dst16u2.Size(), dst32f2.Data());
+        }
+        result = result && Compare(dst32f1, dst32f2, 0.01f, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetConvolution16bPooledAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity;
+        const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+        const SimdSynetPoolingMethodType pMax = SimdSynetPoolingMethodMax, pAvg = SimdSynetPoolingMethodAverage;
+
+        result = result && SynetConvolution16bPooledAutoTest(Param(1, 32, 128, 64, 64, _3, _1, _1, _1, _1, 1, aRe, SimdTrue, f32, f32), pMax, _2);
+        result = result && SynetConvolution16bPooledAutoTest(Param(2, 32, 95, 47, 48, _3, _1, _1, _1, _1, 1, aRe, SimdTrue, b16, b16), pAvg, _2);
+        result = result && SynetConvolution16bPooledAutoTest(Param(1, 64, 60, 60, 64, _1, _1, _1, _0, _0, 1, aId, SimdTrue, f32, b16), pMax, _3);
+        result = result && SynetConvolution16bPooledAutoTest(Param(1, 16, 33, 31, 32, _3, _1, _1, _1, _1, 1, aRe, SimdFalse, f32, f32), pAvg, _2);
+        result = result && SynetConvolution16bPooledAutoTest(Param(1, 16, 200, 100, 64, _3, _1, _1, _1, _1, 1, aRe, SimdFalse, b16, b16), pMax, _3);
+        result = result && SynetConvolution16bPooledAutoTest(Param(2, 16, 150, 90, 80, _3, _1, _1, _1, _1, 1, aId, SimdFalse, f32, b16), pAvg, _2);
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution16bThreadsAutoTest(const Param& p, SimdSynetCompatibilityType comp, size_t threads)
+    {
+        bool result = true;
+
+        const SimdConvolutionParameters& c = p.conv;
+        Tensor32f weight(p.WeightShape()), bias({ c.dstC }), params({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+        Tensor32f src32f(p.SrcShape(), c.srcF), dst32f1(p.DstShape(), c.dstF), dst32f2(p.DstShape(), c.dstF);
+        Tensor16u src16u(p.SrcShape(), c.srcF), dst16u1(p.DstShape(), c.dstF), dst16u2(p.DstShape(), c.dstF);
+        FillRandom(src32f.Data(), src32f.Size(), -1.0, 1.0f);
+        SimdFloat32ToBFloat16(src32f.Data(), src32f.Size(), src16u.Data());
+
+        const uint8_t* src = c.srcT == SimdTensorData32f ? (uint8_t*)src32f.Data() : (uint8_t*)src16u.Data();
+        uint8_t* dst1 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : (uint8_t*)dst16u1.Data();
+        uint8_t* dst2 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : (uint8_t*)dst16u2.Data();
+
+        size_t number = ::SimdGetThreadNumber();
+
+        ::SimdSetThreadNumber(1);
+        void* context1 = ::SimdSynetConvolution16bInit(p.batch, &c, comp);
+        Tensor8u buf1({ ::SimdSynetConvolution16bExternalBufferSize(context1) });
+        ::SimdSynetConvolution16bSetParams(context1, weight.Data(), bias.Data(), params.Data());
+        ::SimdSynetConvolution16bForward(context1, src, buf1.Data(), dst1);
+        ::SimdRelease(context1);
+
+        ::SimdSetThreadNumber(threads);
+        void* context2 = ::SimdSynetConvolution16bInit(p.batch, &c, comp);
+        Tensor8u buf2({ ::SimdSynetConvolution16bExternalBufferSize(context2) });
+        ::SimdSynetConvolution16bSetParams(context2, weight.Data(), bias.Data(), params.Data());
+
+        TEST_LOG_SS(Info, "Test SynetConvolution16b " << ::SimdSynetConvolution16bInfo(context2) << p.Decription() << " with " << ::SimdGetThreadNumber() << " threads.");
+
+        ::SimdSynetConvolution16bForward(context2, src, buf2.Data(), dst2);
+        ::SimdRelease(context2);
+
+        ::SimdSetThreadNumber(number);
+
+        if (c.dstT == SimdTensorData16b)
+        {
+            SimdBFloat16ToFloat32(dst16u1.Data(), dst16u1.Size(), dst32f1.Data());
+            SimdBFloat16ToFloat32(dst16u2.Data(), dst16u2.Size(), dst32f2.Data());
+        }
+        result = result && Compare(dst32f1, dst32f2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetConvolution16bThreadsAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity;
+        const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+        const SimdSynetCompatibilityType cD = SimdSynetCompatibilityDefault, cW = SimdSynetCompatibility16bWinograd;
+        const size_t threads = 4;
+
+        result = result && SynetConvolution16bThreadsAutoTest(Param(1, 64, 56, 56, 64, _3, _1, _1, _1, _1, 1, aRe, SimdTrue, f32, f32), cD, threads);
+        result = result && SynetConvolution16bThreadsAutoTest(Param(1, 256, 56, 56, 256, _1, _1, _1, _0, _0, 1, aId, SimdTrue, b16, b16), cD, threads);
+        result = result && SynetConvolution16bThreadsAutoTest(Param(2, 128, 29, 31, 96, _3, _1, _1, _1, _1, 1, aRe, SimdTrue, f32, b16), cD, threads);
+        result = result && SynetConvolution16bThreadsAutoTest(Param(1, 64, 64, 64, 64, _3, _1, _1, _1, _1, 1, aRe, SimdTrue, f32, f32), cW, threads);
+
+        return result;
+    }
 #endif
 }
@@ -27,6 +27,7 @@
 #include "Test/TestSynetConvolutionParam.h"
 #include "Test/TestRandom.h"
 #include "Test/TestOptions.h"
+#include "Test/TestFile.h"
 
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynet.h"
@@ -262,6 +263,7 @@ namespace Test
 #endif
 #if 1
         result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 1280, 32, 32, 256, _1, _1, _1, _0, _0, 1, aRe, t), f1, f2);
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 17, 24, 24, 32, _2, _1, _1, _1, _0, 1, a, t), f1, f2);
 #endif
 #else
         result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 20, 75, 75, 20, Size(1, 11), _1, _1, Size(0, 5), Size(0, 5), 20, aId, t), f1, f2);
@@ -320,5 +322,381 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution32fTunedAutoTest(const Param& p, const String& candidate = String())
+    {
+        bool result = true;
+
+        const SimdConvolutionParameters& c = p.conv;
+        Tensor32f src({ p.batch, p.trans ? c.srcH : c.srcC, p.trans ? c.srcW : c.srcH, p.trans ? c.srcC : c.srcW });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+        Tensor32f weight({ p.trans ? c.kernelY : c.dstC, p.trans ? c.kernelX : c.srcC / c.group,
+            p.trans ? c.srcC / c.group : c.kernelY, p.trans ? c.dstC : c.kernelX });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        Tensor32f bias({ c.dstC }), params({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+        Tensor32f buf1, buf2, dst1({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+        Tensor32f dst2(dst1.Shape());
+
+        void* context1 = ::SimdSynetConvolution32fInit(p.batch, &c);
+        ::SimdSetTuningMode(SimdTrue);
+        void* context2 = ::SimdSynetConvolution32fInit(p.batch, &c);
+        ::SimdSetTuningMode(SimdFalse);
+
+        TEST_LOG_SS(Info, "Test SynetConvolution32f tuning " << p.Decription() << " : " << ::SimdSynetConvolution32fInfo(context2) << ".");
+
+        if (candidate.size() && String(::SimdSynetConvolution32fInfo(context2)).find(candidate) == String::npos)
+        {
+            TEST_LOG_SS(Error, "SynetConvolution32f tuning candidates of " << p.Decription() << " do not include " << candidate << "!");
+            result = false;
+        }
+
+        buf1.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context1) });
+        buf2.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context2) });
+        ::SimdSynetConvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetConvolution32fSetParams(context2, weight.Data(), NULL, bias.Data(), params.Data());
+
+        ::SimdSynetConvolution32fForward(context1, src.Data(), buf1.Data(), dst1.Data());
+        for (size_t i = 0; i < 64 && result; ++i)
+        {
+            ::SimdFill32f(dst2.Data(), dst2.Size(), params.Data());
+            ::SimdSynetConvolution32fForward(context2, src.Data(), buf2.Data(), dst2.Data());
+            result = result && Compare(dst1, dst2, 4 * EPS, true, 64, DifferenceBoth);
+        }
+
+        String info = ::SimdSynetConvolution32fInfo(context2);
+        TEST_LOG_SS(Info, "Reference : " << ::SimdSynetConvolution32fInfo(context1) << ", tuned : " << info << ".");
+        if (result && info.find("Tuned") != String::npos)
+        {
+            TEST_LOG_SS(Error, "SynetConvolution32f algorithm is not chosen after tuning!");
+            result = false;
+        }
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetConvolution32fTunedAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity;
+
+        result = result && SynetConvolution32fTunedAutoTest(Param(1, 16, 32, 32, 16, _3, _1, _1, _1, _1, 1, aRe, SimdTrue), "Winograd");
+        result = result && SynetConvolution32fTunedAutoTest(Param(1, 8, 48, 40, 24, _3, _1, _1, _1, _1, 1, aId, SimdTrue), "Winograd");
+        result = result && SynetConvolution32fTunedAutoTest(Param(1, 16, 32, 32, 16, _3, _1, _1, _1, _1, 1, aRe, SimdFalse), "Winograd");
+        result = result && SynetConvolution32fTunedAutoTest(Param(1, 32, 20, 20, 32, _3, _1, _2, _1, _1, 32, aRe, SimdTrue));
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    static String ReadRuntimeCache(const String& path)
+    {
+        std::ifstream ifs(path);
+        std::stringstream ss;
+        ss << ifs.rdbuf();
+        return ss.str();
+    }
+
+    bool SynetConvolution32fRuntimeCacheAutoTest(const Param& p)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdRuntimeCache with SynetConvolution32f" << p.Decription() << ".");
+
+        const SimdConvolutionParameters& c = p.conv;
+        Tensor32f src({ p.batch, c.srcH, c.srcW, c.srcC });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+        Tensor32f weight({ c.kernelY, c.kernelX, c.srcC / c.group, c.dstC }), bias({ c.dstC }), params({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+        Tensor32f buf, dst1({ p.batch, c.dstH, c.dstW, c.dstC }), dst2({ p.batch, c.dstH, c.dstW, c.dstC });
+
+        const String dir = "_out", path1 = MakePath(dir, "runtime_cache_1.txt"), path2 = MakePath(dir, "runtime_cache_2.txt");
+        if (!CreatePathIfNotExist(dir, false))
+        {
+            TEST_LOG_SS(Error, "Can't create directory '" << dir << "'!");
+            return false;
+        }
+
+        ::SimdRuntimeCacheClear();
+
+        void* context1 = ::SimdSynetConvolution32fInit(p.batch, &c);
+        buf.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context1) });
+        ::SimdSynetConvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+        for (size_t i = 0; i < 16; ++i)
+            ::SimdSynetConvolution32fForward(context1, src.Data(), buf.Data(), dst1.Data());
+        ::SimdRelease(context1);
+
+        if (!::SimdRuntimeCacheSave(path1.c_str()))
+        {
+            TEST_LOG_SS(Error, "Can't save runtime cache to '" << path1 << "'!");
+            return false;
+        }
+
+        ::SimdRuntimeCacheClear();
+        if (!::SimdRuntimeCacheLoad(path1.c_str()))
+        {
+            TEST_LOG_SS(Error, "Can't load runtime cache from '" << path1 << "'!");
+            return false;
+        }
+
+        void* context2 = ::SimdSynetConvolution32fInit(p.batch, &c);
+        ::SimdSynetConvolution32fSetParams(context2, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetConvolution32fForward(context2, src.Data(), buf.Data(), dst2.Data());
+        ::SimdRelease(context2);
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        if (result && (!::SimdRuntimeCacheSave(path2.c_str()) || ReadRuntimeCache(path1) != ReadRuntimeCache(path2)))
+        {
+            TEST_LOG_SS(Error, "Saved and loaded runtime caches are different!");
+            result = false;
+        }
+
+        if (result)
+        {
+            std::ofstream(path2.c_str()) << "Simd::Runtime cache 0" << std::endl;
+            if (::SimdRuntimeCacheLoad(path2.c_str()))
+            {
+                TEST_LOG_SS(Error, "Runtime cache with wrong version was loaded!");
+                result = false;
+            }
+        }
+
+        ::SimdRuntimeCacheClear();
+
+        return result;
+    }
+
+    bool SynetConvolution32fRuntimeCacheAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _1(1, 1), _3(3, 3);
+
+        result = result && SynetConvolution32fRuntimeCacheAutoTest(Param(1, 16, 32, 32, 32, _3, _1, _1, _1, _1, 1, SimdConvolutionActivationRelu, SimdTrue));
+        result = result && SynetConvolution32fRuntimeCacheAutoTest(Param(1, 64, 16, 16, 64, _1, _1, _1, Size(0, 0), Size(0, 0), 1, SimdConvolutionActivationIdentity, SimdTrue));
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution32fDynamicAutoTest(const Param& p, const std::vector<Size>& sizes)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetConvolution32f dynamic shape" << p.Decription() << ".");
+
+        const SimdConvolutionParameters& c = p.conv;
+        Tensor32f weight({ c.kernelY, c.kernelX, c.srcC / c.group, c.dstC }), bias({ c.dstC }), params({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+
+        void* context2 = ::SimdSynetConvolution32fInitDynamic(p.batch, &c);
+        ::SimdSynetConvolution32fSetParams(context2, weight.Data(), NULL, bias.Data(), params.Data());
+
+        const size_t capacity = 8;
+        size_t maxInternal = ::SimdSynetConvolution32fInternalBufferSize(context2);
+        for (size_t i = 0; i < sizes.size() && result; ++i)
+        {
+            Param q(p.batch, c.srcC, sizes[i].y, sizes[i].x, c.dstC, Size(c.kernelX, c.kernelY), Size(c.dilationX, c.dilationY),
+                Size(c.strideX, c.strideY), Size(c.padX, c.padY), Size(c.padW, c.padH), c.group, c.activation, p.trans);
+            const SimdConvolutionParameters& d = q.conv;
+            Tensor32f src({ q.batch, d.srcH, d.srcW, d.srcC }), buf1, buf2;
+            FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+            Tensor32f dst1({ q.batch, d.dstH, d.dstW, d.dstC }), dst2({ q.batch, d.dstH, d.dstW, d.dstC });
+
+            void* context1 = ::SimdSynetConvolution32fInit(q.batch, &d);
+            ::SimdSynetConvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+            buf1.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context1) });
+            ::SimdSynetConvolution32fForward(context1, src.Data(), buf1.Data(), dst1.Data());
+            maxInternal = Simd::Max(maxInternal, ::SimdSynetConvolution32fInternalBufferSize(context1));
+            ::SimdRelease(context1);
+
+            if (!::SimdSynetConvolution32fReshape(context2, q.batch, d.srcH, d.srcW))
+            {
+                TEST_LOG_SS(Error, "Can't reshape SynetConvolution32f to " << d.srcH << "x" << d.srcW << " !");
+                result = false;
+                break;
+            }
+            buf2.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context2) });
+            ::SimdSynetConvolution32fForward(context2, src.Data(), buf2.Data(), dst2.Data());
+
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+            size_t internal = ::SimdSynetConvolution32fInternalBufferSize(context2);
+            if (internal > capacity * maxInternal)
+            {
+                TEST_LOG_SS(Error, "Internal buffer of dynamic SynetConvolution32f grows: " << internal << " > " << capacity << " * " << maxInternal << " !");
+                result = false;
+            }
+        }
+
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetConvolution32fDynamicAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity;
+        std::vector<Size> sizes = { Size(32, 24), Size(17, 33), Size(64, 48), Size(32, 24), Size(17, 33) }, many;
+        for (size_t i = 0; i < 20; ++i)
+            many.push_back(Size(16 + i, 24 + i % 3));
+        many.push_back(Size(16, 24));
+
+        result = result && SynetConvolution32fDynamicAutoTest(Param(1, 16, 24, 32, 32, _3, _1, _1, _1, _1, 1, aRe, SimdTrue), sizes);
+        result = result && SynetConvolution32fDynamicAutoTest(Param(1, 32, 24, 32, 32, _3, _1, _2, _1, _1, 32, aRe, SimdTrue), sizes);
+        result = result && SynetConvolution32fDynamicAutoTest(Param(1, 64, 24, 32, 48, _1, _1, _1, _0, _0, 1, aId, SimdTrue), sizes);
+        result = result && SynetConvolution32fDynamicAutoTest(Param(1, 64, 24, 32, 64, _3, _1, _1, _1, _1, 1, aRe, SimdTrue), many);
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution32fPooledAutoTest(const Param& p, SimdSynetPoolingMethodType method, const Size& kernel)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetConvolution32f pooled" << p.Decription() << (method == SimdSynetPoolingMethodMax ? " max" : " avg") << kernel.y << "x" << kernel.x << ".");
+
+        const SimdConvolutionParameters& c = p.conv;
+        size_t dstH = Simd::DivHi(c.dstH, kernel.y), dstW = Simd::DivHi(c.dstW, kernel.x);
+        Shape poolShape = p.trans ? Shape({ p.batch, dstH, dstW, c.dstC }) : Shape({ p.batch, c.dstC, dstH, dstW });
+        Tensor32f weight(p.WeightShape()), bias({ c.dstC }), params({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+        Tensor32f src(p.SrcShape(), c.srcF), conv(p.DstShape(), c.dstF), buf1, buf2;
+        Tensor32f dst1(poolShape, c.dstF), dst2(poolShape, c.dstF);
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        void* context1 = ::SimdSynetConvolution32fInit(p.batch, &c);
+        ::SimdSynetConvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+        buf1.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context1) });
+        ::SimdSynetConvolution32fForward(context1, src.Data(), buf1.Data(), conv.Data());
+        ::SimdRelease(context1);
+        for (size_t b = 0, sizeC = c.dstC * c.dstH * c.dstW, sizeP = c.dstC * dstH * dstW; b < p.batch; ++b)
+        {
+            if (method == SimdSynetPoolingMethodMax)
+                ::SimdSynetPoolingMax32f(conv.Data() + b * sizeC, c.dstC, c.dstH, c.dstW, 1, kernel.y, kernel.x, 1, kernel.y, kernel.x,
+                    0, 0, 0, dst1.Data() + b * sizeP, c.dstC, dstH, dstW, c.dstF);
+            else
+                ::SimdSynetPoolingAverage(conv.Data() + b * sizeC, c.dstC, c.dstH, c.dstW, kernel.y, kernel.x, kernel.y, kernel.x,
+                    0, 0, dst1.Data() + b * sizeP, dstH, dstW, SimdTrue, c.dstF);
+        }
+
+        void* context2 = ::SimdSynetConvolution32fInitPooled(p.batch, &c, method, kernel.y, kernel.x);
+        if (context2 == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't init pooled SynetConvolution32f!");
+            return false;
+        }
+        ::SimdSynetConvolution32fSetParams(context2, weight.Data(), NULL, bias.Data(), params.Data());
+        buf2.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context2) });
+        {
+            TEST_PERFORMANCE_TEST(String("SynetConvolution32fPooled") + p.Decription());
+            ::SimdSynetConvolution32fForward(context2, src.Data(), buf2.Data(), dst2.Data());
+        }
+        ::SimdRelease(context2);
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetConvolution32fPooledAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity;
+        const SimdSynetPoolingMethodType pMax = SimdSynetPoolingMethodMax, pAvg = SimdSynetPoolingMethodAverage;
+
+        result = result && SynetConvolution32fPooledAutoTest(Param(1, 32, 128, 64, 64, _3, _1, _1, _1, _1, 1, aRe, SimdTrue), pMax, _2);
+        result = result && SynetConvolution32fPooledAutoTest(Param(2, 32, 95, 47, 48, _3, _1, _1, _1, _1, 1, aRe, SimdTrue), pAvg, _2);
+        result = result && SynetConvolution32fPooledAutoTest(Param(1, 64, 60, 60, 64, _1, _1, _1, _0, _0, 1, aId, SimdTrue), pMax, _3);
+        result = result && SynetConvolution32fPooledAutoTest(Param(1, 16, 33, 31, 32, _3, _1, _1, _1, _1, 1, aRe, SimdFalse), pAvg, _2);
+        result = result && SynetConvolution32fPooledAutoTest(Param(1, 16, 200, 100, 64, _3, _1, _1, _1, _1, 1, aRe, SimdFalse), pMax, _3);
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution32fThreadsAutoTest(const Param& p, size_t threads)
+    {
+        bool result = true;
+
+        const SimdConvolutionParameters& c = p.conv;
+        Tensor32f weight(p.WeightShape()), bias({ c.dstC }), params({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+        Tensor32f src(p.SrcShape(), c.srcF), buf1, buf2, dst1(p.DstShape(), c.dstF), dst2(p.DstShape(), c.dstF);
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        size_t number = ::SimdGetThreadNumber();
+
+        ::SimdSetThreadNumber(1);
+        void* context1 = ::SimdSynetConvolution32fInit(p.batch, &c);
+        ::SimdSynetConvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+        buf1.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context1) });
+        ::SimdSynetConvolution32fForward(context1, src.Data(), buf1.Data(), dst1.Data());
+        ::SimdRelease(context1);
+
+        ::SimdSetThreadNumber(threads);
+        void* context2 = ::SimdSynetConvolution32fInit(p.batch, &c);
+        ::SimdSynetConvolution32fSetParams(context2, weight.Data(), NULL, bias.Data(), params.Data());
+        buf2.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context2) });
+
+        TEST_LOG_SS(Info, "Test SynetConvolution32f " << ::SimdSynetConvolution32fInfo(context2) << p.Decription() << " with " << ::SimdGetThreadNumber() << " threads.");
+
+        for (size_t i = 0; i < 16 && result; ++i)
+        {
+            ::SimdFill32f(dst2.Data(), dst2.Size(), params.Data());
+            ::SimdSynetConvolution32fForward(context2, src.Data(), buf2.Data(), dst2.Data());
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        }
+        ::SimdRelease(context2);
+
+        ::SimdSetThreadNumber(number);
+
+        return result;
+    }
+
+    bool SynetConvolution32fThreadsAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity;
+        const size_t threads = 4;
+
+        result = result && SynetConvolution32fThreadsAutoTest(Param(1, 2048, 3, 11, 1024, _1, _1, _1, _0, _0, 1, aId, SimdTrue), threads);
+        result = result && SynetConvolution32fThreadsAutoTest(Param(1, 1280, 32, 32, 256, _1, _1, _1, _0, _0, 1, aRe, SimdTrue), threads);
+        result = result && SynetConvolution32fThreadsAutoTest(Param(1, 64, 64, 64, 64, _3, _1, _1, _1, _1, 1, aRe, SimdTrue), threads);
+        result = result && SynetConvolution32fThreadsAutoTest(Param(1, 48, 56, 56, 48, _3, _1, _1, _1, _1, 1, aRe, SimdTrue), threads);
+        result = result && SynetConvolution32fThreadsAutoTest(Param(1, 512, 112, 112, 512, _3, _1, _1, _1, _1, 512, aRe, SimdTrue), threads);
+        result = result && SynetConvolution32fThreadsAutoTest(Param(1, 256, 112, 112, 512, _3, _1, _1, _1, _1, 256, aRe, SimdTrue), threads);
+
+        return result;
+    }
 #endif
 }
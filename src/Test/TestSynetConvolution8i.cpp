@@ -56,6 +56,8 @@ namespace Test
                 extra << (p.conv.dstT == SimdTensorData32f ? "f" : "u");
                 extra << afs[p.conv.activation];
                 extra << (Simd::Base::Overflow(c) ? "-o" : Simd::Base::Narrowed(c) ? "-n" : "-p");
+                if (::SimdGetThreadNumber() > 1)
+                    extra << "-t" << ::SimdGetThreadNumber();
                 desc = desc + p.Decription(extra.str());
             }
 
@@ -313,5 +315,210 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution8iShareParamsAutoTest(const Param& p)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetConvolution8i shared parameters" << p.Decription() << ".");
+
+        const SimdConvolutionParameters& c = p.conv;
+        SimdSynetCompatibilityType comp = SimdSynetCompatibilityDefault;
+        Tensor32f weight(p.WeightShape()), other(p.WeightShape()), bias({ c.dstC }), params({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(other.Data(), other.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+        Tensor32f srcMin({ c.srcC }), srcMax({ c.srcC }), dstMin({ c.dstC }), dstMax({ c.dstC });
+        Fill(srcMin, -1.0f);
+        Fill(srcMax, 1.0f);
+        Fill(dstMin, -10.0f);
+        Fill(dstMax, 10.0f);
+        const float* stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+        Tensor32f src(p.SrcShape(), c.srcF), dst1(p.DstShape(), c.dstF), dst2(p.DstShape(), c.dstF);
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+        Tensor8u buf;
+
+        void* context1 = ::SimdSynetConvolution8iInit(p.batch, &c, comp);
+        void* context2 = ::SimdSynetConvolution8iInit(p.batch, &c, comp);
+        void* context3 = ::SimdSynetConvolution8iInit(p.batch, &c, comp);
+        buf.Extend({ ::SimdSynetConvolution8iExternalBufferSize(context1) });
+        ::SimdSynetConvolution8iSetParams(context1, weight.Data(), bias.Data(), params.Data(), stats);
+        ::SimdSynetConvolution8iForward(context1, (uint8_t*)src.Data(), buf.Data(), (uint8_t*)dst1.Data());
+
+        if (!::SimdSynetConvolution8iShareParams(context2, context1) || !::SimdSynetConvolution8iShareParams(context3, context2))
+        {
+            TEST_LOG_SS(Error, "Can't share parameters of SynetConvolution8i!");
+            result = false;
+        }
+        ::SimdRelease(context1);
+        ::SimdSynetConvolution8iSetParams(context3, other.Data(), bias.Data(), params.Data(), stats);
+
+        ::SimdSynetConvolution8iForward(context2, (uint8_t*)src.Data(), buf.Data(), (uint8_t*)dst2.Data());
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        ::SimdRelease(context2);
+        ::SimdRelease(context3);
+
+        return result;
+    }
+
+    bool SynetConvolution8iShareParamsAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity;
+        const SimdTensorDataType f32 = SimdTensorData32f;
+
+        result = result && SynetConvolution8iShareParamsAutoTest(Param(1, 64, 16, 16, 96, _1, _1, _1, _0, _0, 1, aId, SimdTrue, f32, f32));
+        result = result && SynetConvolution8iShareParamsAutoTest(Param(1, 32, 20, 20, 48, _3, _1, _1, _1, _1, 1, aRe, SimdTrue, f32, f32));
+        result = result && SynetConvolution8iShareParamsAutoTest(Param(1, 32, 20, 20, 32, _3, _1, _1, _1, _1, 32, aRe, SimdTrue, f32, f32));
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution8iExportImportAutoTest(const Param& p)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetConvolution8i export/import parameters" << p.Decription() << ".");
+
+        const SimdConvolutionParameters& c = p.conv;
+        SimdSynetCompatibilityType comp = SimdSynetCompatibilityDefault;
+        Tensor32f weight(p.WeightShape()), bias({ c.dstC }), params({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+        Tensor32f srcMin({ c.srcC }), srcMax({ c.srcC }), dstMin({ c.dstC }), dstMax({ c.dstC });
+        Fill(srcMin, -1.0f);
+        Fill(srcMax, 1.0f);
+        Fill(dstMin, -10.0f);
+        Fill(dstMax, 10.0f);
+        const float* stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+        Tensor32f src(p.SrcShape(), c.srcF), dst1(p.DstShape(), c.dstF), dst2(p.DstShape(), c.dstF);
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+        Tensor8u buf, blob;
+
+        void* context1 = ::SimdSynetConvolution8iInit(p.batch, &c, comp);
+        void* context2 = ::SimdSynetConvolution8iInit(p.batch, &c, comp);
+        buf.Extend({ ::SimdSynetConvolution8iExternalBufferSize(context1) });
+        ::SimdSynetConvolution8iSetParams(context1, weight.Data(), bias.Data(), params.Data(), stats);
+        ::SimdSynetConvolution8iForward(context1, (uint8_t*)src.Data(), buf.Data(), (uint8_t*)dst1.Data());
+
+        size_t size = ::SimdSynetConvolution8iExportParams(context1, NULL, 0);
+        blob.Extend({ size });
+        if (size == 0 || ::SimdSynetConvolution8iExportParams(context1, blob.Data(), size) != size)
+        {
+            TEST_LOG_SS(Error, "Can't export parameters of SynetConvolution8i!");
+            result = false;
+        }
+        ::SimdRelease(context1);
+
+        blob.Data()[0] ^= 1;
+        if (result && ::SimdSynetConvolution8iImportParams(context2, blob.Data(), size))
+        {
+            TEST_LOG_SS(Error, "SynetConvolution8i imports corrupted parameters!");
+            result = false;
+        }
+        blob.Data()[0] ^= 1;
+        if (result && !::SimdSynetConvolution8iImportParams(context2, blob.Data(), size))
+        {
+            TEST_LOG_SS(Error, "Can't import parameters of SynetConvolution8i!");
+            result = false;
+        }
+
+        if (result)
+        {
+            ::SimdSynetConvolution8iForward(context2, (uint8_t*)src.Data(), buf.Data(), (uint8_t*)dst2.Data());
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        }
+
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetConvolution8iExportImportAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity;
+        const SimdTensorDataType f32 = SimdTensorData32f;
+
+        result = result && SynetConvolution8iExportImportAutoTest(Param(1, 64, 16, 16, 96, _1, _1, _1, _0, _0, 1, aId, SimdTrue, f32, f32));
+        result = result && SynetConvolution8iExportImportAutoTest(Param(1, 32, 20, 20, 48, _3, _1, _1, _1, _1, 1, aRe, SimdTrue, f32, f32));
+        result = result && SynetConvolution8iExportImportAutoTest(Param(1, 32, 20, 20, 32, _3, _1, _1, _1, _1, 32, aRe, SimdTrue, f32, f32));
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetConvolution8iThreadsAutoTest(const Param& p, size_t threads)
+    {
+        bool result = true;
+
+        const SimdConvolutionParameters& c = p.conv;
+        SimdSynetCompatibilityType comp = SimdSynetCompatibilityDefault;
+        Tensor32f weight(p.WeightShape()), bias({ c.dstC }), params({ c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+        Tensor32f srcMin({ c.srcC }), srcMax({ c.srcC }), dstMin({ c.dstC }), dstMax({ c.dstC });
+        Fill(srcMin, -1.0f);
+        Fill(srcMax, 1.0f);
+        Fill(dstMin, -10.0f);
+        Fill(dstMax, 10.0f);
+        const float* stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+        Tensor32f src(p.SrcShape(), c.srcF), dst1(p.DstShape(), c.dstF), dst2(p.DstShape(), c.dstF);
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        size_t number = ::SimdGetThreadNumber();
+
+        ::SimdSetThreadNumber(1);
+        void* context1 = ::SimdSynetConvolution8iInit(p.batch, &c, comp);
+        Tensor8u buf1({ ::SimdSynetConvolution8iExternalBufferSize(context1) });
+        ::SimdSynetConvolution8iSetParams(context1, weight.Data(), bias.Data(), params.Data(), stats);
+        ::SimdSynetConvolution8iForward(context1, (uint8_t*)src.Data(), buf1.Data(), (uint8_t*)dst1.Data());
+        ::SimdRelease(context1);
+
+        ::SimdSetThreadNumber(threads);
+        void* context2 = ::SimdSynetConvolution8iInit(p.batch, &c, comp);
+        Tensor8u buf2({ ::SimdSynetConvolution8iExternalBufferSize(context2) });
+        ::SimdSynetConvolution8iSetParams(context2, weight.Data(), bias.Data(), params.Data(), stats);
+
+        TEST_LOG_SS(Info, "Test SynetConvolution8i " << ::SimdSynetConvolution8iInfo(context2) << p.Decription() << " with " << ::SimdGetThreadNumber() << " threads.");
+
+        ::SimdSynetConvolution8iForward(context2, (uint8_t*)src.Data(), buf2.Data(), (uint8_t*)dst2.Data());
+        ::SimdRelease(context2);
+
+        ::SimdSetThreadNumber(number);
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetConvolution8iThreadsAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity;
+        const SimdTensorDataType f32 = SimdTensorData32f;
+        const size_t threads = 4;
+
+        result = result && SynetConvolution8iThreadsAutoTest(Param(4, 64, 56, 56, 64, _3, _1, _1, _1, _1, 1, aRe, SimdTrue, f32, f32), threads);
+        result = result && SynetConvolution8iThreadsAutoTest(Param(5, 128, 28, 28, 128, _1, _1, _1, _0, _0, 1, aId, SimdTrue, f32, f32), threads);
+        result = result && SynetConvolution8iThreadsAutoTest(Param(3, 64, 48, 48, 64, _3, _1, _1, _1, _1, 1, aRe, SimdFalse, f32, f32), threads);
+
+        return result;
+    }
 #endif
 }
@@ -0,0 +1,293 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+#include "Test/TestOptions.h"
+
+#include "Simd/SimdSynet.h"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        struct FuncLn32f
+        {
+            typedef void(*LayerPtr)(const float* src, const float* add, size_t count, size_t size, const float* scale, const float* shift, const float* eps, float* sum, float* dst);
+            typedef void(*RmsPtr)(const float* src, const float* add, size_t count, size_t size, const float* scale, const float* eps, float* sum, float* dst);
+
+            LayerPtr layer;
+            RmsPtr rms;
+            String desc;
+
+            FuncLn32f(const LayerPtr& f, const String& d) : layer(f), rms(NULL), desc(d) {}
+            FuncLn32f(const RmsPtr& f, const String& d) : layer(NULL), rms(f), desc(d) {}
+
+            void Update(size_t count, size_t size, bool add, bool shift)
+            {
+                desc = desc + "[" + ToString(count) + "x" + ToString(size) + (add ? "-a" : "") + (shift ? "-s" : "") + "]";
+            }
+
+            void Call(const Tensor32f& src, const Tensor32f& add, size_t count, size_t size, const Tensor32f& scale, const Tensor32f& shift, float eps, Tensor32f& sum, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                if (layer)
+                    layer(src.Data(), add.Size() ? add.Data() : NULL, count, size, scale.Data(), shift.Size() ? shift.Data() : NULL, &eps, sum.Data(), dst.Data());
+                else
+                    rms(src.Data(), add.Size() ? add.Data() : NULL, count, size, scale.Data(), &eps, sum.Data(), dst.Data());
+            }
+        };
+
+        struct FuncLn16b
+        {
+            typedef void(*LayerPtr)(const uint16_t* src, const uint16_t* add, size_t count, size_t size, const float* scale, const float* shift, const float* eps, float* buf, uint16_t* sum, uint16_t* dst);
+            typedef void(*RmsPtr)(const uint16_t* src, const uint16_t* add, size_t count, size_t size, const float* scale, const float* eps, float* buf, uint16_t* sum, uint16_t* dst);
+
+            LayerPtr layer;
+            RmsPtr rms;
+            String desc;
+
+            FuncLn16b(const LayerPtr& f, const String& d) : layer(f), rms(NULL), desc(d) {}
+            FuncLn16b(const RmsPtr& f, const String& d) : layer(NULL), rms(f), desc(d) {}
+
+            void Update(size_t count, size_t size, bool add, bool shift)
+            {
+                desc = desc + "[" + ToString(count) + "x" + ToString(size) + (add ? "-a" : "") + (shift ? "-s" : "") + "]";
+            }
+
+            void Call(const Tensor16u& src, const Tensor16u& add, size_t count, size_t size, const Tensor32f& scale, const Tensor32f& shift, float eps, Tensor32f& buf, Tensor16u& sum, Tensor16u& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                if (layer)
+                    layer(src.Data(), add.Size() ? add.Data() : NULL, count, size, scale.Data(), shift.Size() ? shift.Data() : NULL, &eps, buf.Data(), sum.Data(), dst.Data());
+                else
+                    rms(src.Data(), add.Size() ? add.Data() : NULL, count, size, scale.Data(), &eps, buf.Data(), sum.Data(), dst.Data());
+            }
+        };
+    }
+
+#define FUNC_LN32F(function) FuncLn32f(function, #function)
+#define FUNC_LN16B(function) FuncLn16b(function, #function)
+
+    bool SynetLayerNorm32fAutoTest(size_t count, size_t size, bool hasAdd, bool hasShift, FuncLn32f f1, FuncLn32f f2)
+    {
+        bool result = true;
+
+        f1.Update(count, size, hasAdd, hasShift);
+        f2.Update(count, size, hasAdd, hasShift);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << count << ", " << size << "].");
+
+        const float eps = 0.00001f;
+        Tensor32f src(Shape({ count, size })), add, scale(ToShape(size)), shift;
+        Tensor32f sum1(Shape({ count, size })), sum2(Shape({ count, size }));
+        Tensor32f dst1(Shape({ count, size })), dst2(Shape({ count, size }));
+        FillRandom(src.Data(), src.Size(), -10.0, 10.0);
+        FillRandom(scale.Data(), scale.Size(), -2.0, 2.0);
+        if (hasAdd)
+        {
+            add.Reshape(Shape({ count, size }));
+            FillRandom(add.Data(), add.Size(), -10.0, 10.0);
+        }
+        if (hasShift)
+        {
+            shift.Reshape(ToShape(size));
+            FillRandom(shift.Data(), shift.Size(), -2.0, 2.0);
+        }
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, add, count, size, scale, shift, eps, sum1, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, add, count, size, scale, shift, eps, sum2, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+        if (hasAdd)
+            result = result && Compare(sum1, sum2, EPS, true, 32, DifferenceBoth, "sum");
+
+        return result;
+    }
+
+    bool SynetLayerNorm32fAutoTest(const FuncLn32f& f1, const FuncLn32f& f2)
+    {
+        bool result = true;
+
+        for (int add = 0; add <= 1; ++add)
+        {
+            for (int shift = 0; shift <= (f1.layer ? 1 : 0); ++shift)
+            {
+                result = result && SynetLayerNorm32fAutoTest(197, 768, add, shift, f1, f2);
+                result = result && SynetLayerNorm32fAutoTest(77, 511, add, shift, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool SynetLayerNorm32fAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+        {
+            result = result && SynetLayerNorm32fAutoTest(FUNC_LN32F(Simd::Base::SynetLayerNorm32f), FUNC_LN32F(SimdSynetLayerNorm32f));
+            result = result && SynetLayerNorm32fAutoTest(FUNC_LN32F(Simd::Base::SynetRmsNorm32f), FUNC_LN32F(SimdSynetRmsNorm32f));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+        {
+            result = result && SynetLayerNorm32fAutoTest(FUNC_LN32F(Simd::Sse41::SynetLayerNorm32f), FUNC_LN32F(SimdSynetLayerNorm32f));
+            result = result && SynetLayerNorm32fAutoTest(FUNC_LN32F(Simd::Sse41::SynetRmsNorm32f), FUNC_LN32F(SimdSynetRmsNorm32f));
+        }
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+        {
+            result = result && SynetLayerNorm32fAutoTest(FUNC_LN32F(Simd::Avx2::SynetLayerNorm32f), FUNC_LN32F(SimdSynetLayerNorm32f));
+            result = result && SynetLayerNorm32fAutoTest(FUNC_LN32F(Simd::Avx2::SynetRmsNorm32f), FUNC_LN32F(SimdSynetRmsNorm32f));
+        }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+        {
+            result = result && SynetLayerNorm32fAutoTest(FUNC_LN32F(Simd::Avx512bw::SynetLayerNorm32f), FUNC_LN32F(SimdSynetLayerNorm32f));
+            result = result && SynetLayerNorm32fAutoTest(FUNC_LN32F(Simd::Avx512bw::SynetRmsNorm32f), FUNC_LN32F(SimdSynetRmsNorm32f));
+        }
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetLayerNorm16bAutoTest(size_t count, size_t size, bool hasAdd, bool hasShift, FuncLn16b f1, FuncLn16b f2)
+    {
+        bool result = true;
+
+        f1.Update(count, size, hasAdd, hasShift);
+        f2.Update(count, size, hasAdd, hasShift);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << count << ", " << size << "].");
+
+        const float eps = 0.00001f;
+        Tensor32f src32f(Shape({ count, size })), scale(ToShape(size)), shift, buf(ToShape(size * 2));
+        Tensor16u src16b(Shape({ count, size })), add16b;
+        Tensor16u sum1(Shape({ count, size })), sum2(Shape({ count, size }));
+        Tensor16u dst1(Shape({ count, size })), dst2(Shape({ count, size }));
+        Tensor32f dst32f1(Shape({ count, size })), dst32f2(Shape({ count, size }));
+        FillRandom(src32f.Data(), src32f.Size(), -10.0, 10.0);
+        SimdFloat32ToBFloat16(src32f.Data(), src32f.Size(), src16b.Data());
+        FillRandom(scale.Data(), scale.Size(), -2.0, 2.0);
+        if (hasAdd)
+        {
+            add16b.Reshape(Shape({ count, size }));
+            FillRandom(src32f.Data(), src32f.Size(), -10.0, 10.0);
+            SimdFloat32ToBFloat16(src32f.Data(), src32f.Size(), add16b.Data());
+        }
+        if (hasShift)
+        {
+            shift.Reshape(ToShape(size));
+            FillRandom(shift.Data(), shift.Size(), -2.0, 2.0);
+        }
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src16b, add16b, count, size, scale, shift, eps, buf, sum1, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src16b, add16b, count, size, scale, shift, eps, buf, sum2, dst2));
+
+        SimdBFloat16ToFloat32(dst1.Data(), dst1.Size(), dst32f1.Data());
+        SimdBFloat16ToFloat32(dst2.Data(), dst2.Size(), dst32f2.Data());
+        result = result && Compare(dst32f1, dst32f2, EPS * 8.0f, true, 32, DifferenceBoth);
+        if (hasAdd)
+        {
+            SimdBFloat16ToFloat32(sum1.Data(), sum1.Size(), dst32f1.Data());
+            SimdBFloat16ToFloat32(sum2.Data(), sum2.Size(), dst32f2.Data());
+            result = result && Compare(dst32f1, dst32f2, EPS * 8.0f, true, 32, DifferenceBoth, "sum");
+        }
+
+        return result;
+    }
+
+    bool SynetLayerNorm16bAutoTest(const FuncLn16b& f1, const FuncLn16b& f2)
+    {
+        bool result = true;
+
+        for (int add = 0; add <= 1; ++add)
+        {
+            for (int shift = 0; shift <= (f1.layer ? 1 : 0); ++shift)
+            {
+                result = result && SynetLayerNorm16bAutoTest(197, 768, add, shift, f1, f2);
+                result = result && SynetLayerNorm16bAutoTest(77, 511, add, shift, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool SynetLayerNorm16bAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+        {
+            result = result && SynetLayerNorm16bAutoTest(FUNC_LN16B(Simd::Base::SynetLayerNorm16b), FUNC_LN16B(SimdSynetLayerNorm16b));
+            result = result && SynetLayerNorm16bAutoTest(FUNC_LN16B(Simd::Base::SynetRmsNorm16b), FUNC_LN16B(SimdSynetRmsNorm16b));
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+        {
+            result = result && SynetLayerNorm16bAutoTest(FUNC_LN16B(Simd::Sse41::SynetLayerNorm16b), FUNC_LN16B(SimdSynetLayerNorm16b));
+            result = result && SynetLayerNorm16bAutoTest(FUNC_LN16B(Simd::Sse41::SynetRmsNorm16b), FUNC_LN16B(SimdSynetRmsNorm16b));
+        }
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+        {
+            result = result && SynetLayerNorm16bAutoTest(FUNC_LN16B(Simd::Avx2::SynetLayerNorm16b), FUNC_LN16B(SimdSynetLayerNorm16b));
+            result = result && SynetLayerNorm16bAutoTest(FUNC_LN16B(Simd::Avx2::SynetRmsNorm16b), FUNC_LN16B(SimdSynetRmsNorm16b));
+        }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+        {
+            result = result && SynetLayerNorm16bAutoTest(FUNC_LN16B(Simd::Avx512bw::SynetLayerNorm16b), FUNC_LN16B(SimdSynetLayerNorm16b));
+            result = result && SynetLayerNorm16bAutoTest(FUNC_LN16B(Simd::Avx512bw::SynetRmsNorm16b), FUNC_LN16B(SimdSynetRmsNorm16b));
+        }
+#endif 
+
+        return result;
+    }
+#endif
+}
@@ -0,0 +1,209 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2026 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+#include "Test/TestOptions.h"
+#include "Test/TestSynetConvolutionParam.h"
+
+#include "Simd/SimdSynetNetwork.hpp"
+#include "Simd/SimdSynetMemoryPlanner.hpp"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        typedef Test::SynetConvolutionParam<false> Param;
+    }
+
+    bool SynetNetworkForwardAutoTest(const Param& p0, const Param& p1)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetNetwork conv" << p0.Decription() << " + conv" << p1.Decription() << " + add + max pooling + softmax.");
+
+        const SimdConvolutionParameters& c0 = p0.conv, & c1 = p1.conv;
+        size_t batch = p0.batch, dstH = c1.dstH / 2, dstW = c1.dstW / 2, dstC = c1.dstC;
+
+        Tensor32f src({ batch, c0.srcH, c0.srcW, c0.srcC });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight0({ c0.kernelY, c0.kernelX, c0.srcC, c0.dstC }), bias0({ c0.dstC }), params0({ c0.dstC });
+        FillRandom(weight0.Data(), weight0.Size(), -1.0, 1.0f);
+        FillRandom(bias0.Data(), bias0.Size(), -1.0, 1.0f);
+        FillRandom(params0.Data(), params0.Size(), 0.0f, 0.1f);
+
+        Tensor32f weight1({ c1.kernelY, c1.kernelX, c1.srcC, c1.dstC }), bias1({ c1.dstC }), params1({ c1.dstC });
+        FillRandom(weight1.Data(), weight1.Size(), -1.0, 1.0f);
+        FillRandom(bias1.Data(), bias1.Size(), -1.0, 1.0f);
+        FillRandom(params1.Data(), params1.Size(), 0.0f, 0.1f);
+
+        Tensor32f dst1({ batch, dstH, dstW, dstC }), dst2({ batch, dstH, dstW, dstC });
+
+        {
+            Tensor32f conv0({ batch, c0.dstH, c0.dstW, c0.dstC }), conv1({ batch, c1.dstH, c1.dstW, c1.dstC });
+            Tensor32f sum({ batch, c1.dstH, c1.dstW, c1.dstC }), pool({ batch, dstH, dstW, dstC }), buf;
+
+            void* context0 = ::SimdSynetConvolution32fInit(batch, &c0);
+            void* context1 = ::SimdSynetConvolution32fInit(batch, &c1);
+            Shape shape = { batch, c1.dstH, c1.dstW, c1.dstC };
+            void* context2 = ::SimdSynetAdd16bInit(shape.data(), shape.size(), SimdTensorData32f,
+                shape.data(), shape.size(), SimdTensorData32f, SimdTensorData32f, SimdTensorFormatNhwc);
+            ::SimdSynetConvolution32fSetParams(context0, weight0.Data(), NULL, bias0.Data(), params0.Data());
+            ::SimdSynetConvolution32fSetParams(context1, weight1.Data(), NULL, bias1.Data(), params1.Data());
+            buf.Extend({ Simd::Max(::SimdSynetConvolution32fExternalBufferSize(context0), ::SimdSynetConvolution32fExternalBufferSize(context1)) });
+
+            ::SimdSynetConvolution32fForward(context0, src.Data(), buf.Data(), conv0.Data());
+            ::SimdSynetConvolution32fForward(context1, conv0.Data(), buf.Data(), conv1.Data());
+            ::SimdSynetAdd16bForward(context2, (uint8_t*)conv1.Data(), (uint8_t*)conv0.Data(), (uint8_t*)sum.Data());
+            for (size_t b = 0; b < batch; ++b)
+                ::SimdSynetPoolingMax32f(sum.Data({ b, 0, 0, 0 }), dstC, c1.dstH, c1.dstW, 1, 2, 2, 1, 2, 2,
+                    0, 0, 0, pool.Data({ b, 0, 0, 0 }), dstC, dstH, dstW, SimdTensorFormatNhwc);
+            ::SimdSynetSoftmax32f(pool.Data(), batch * dstH * dstW, dstC, 1, dst1.Data());
+
+            ::SimdRelease(context0);
+            ::SimdRelease(context1);
+            ::SimdRelease(context2);
+        }
+
+        Simd::SynetNetwork net;
+        size_t in = net.AddInput(src.Size() * sizeof(float));
+        size_t conv0 = net.AddLayer(std::make_shared<Simd::SynetNetwork::Convolution32f>(batch, c0, weight0.Data(), bias0.Data(), params0.Data()), { in });
+        size_t conv1 = net.AddLayer(std::make_shared<Simd::SynetNetwork::Convolution32f>(batch, c1, weight1.Data(), bias1.Data(), params1.Data()), { conv0 });
+        size_t sum = net.AddLayer(std::make_shared<Simd::SynetNetwork::Add16b>(Shape({ batch, c1.dstH, c1.dstW, c1.dstC }),
+            SimdTensorData32f, SimdTensorData32f, SimdTensorData32f, SimdTensorFormatNhwc), { conv1, conv0 });
+        size_t pool = net.AddLayer(std::make_shared<Simd::SynetNetwork::PoolingMax32f>(batch, dstC, c1.dstH, c1.dstW,
+            2, 2, 2, 2, 0, 0, dstH, dstW, SimdTensorFormatNhwc), { sum });
+        size_t out = net.AddLayer(std::make_shared<Simd::SynetNetwork::Softmax32f>(batch * dstH * dstW, dstC, 1), { pool });
+        net.SetOutput(out);
+        if (!net.Init())
+        {
+            TEST_LOG_SS(Error, "Can't init SynetNetwork!");
+            return false;
+        }
+
+        memcpy(net.Data(in), src.Data(), net.Size(in));
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        {
+            TEST_PERFORMANCE_TEST("SynetNetwork::Forward");
+            net.Forward();
+        }
+        memcpy(dst2.Data(), net.Data(out), net.Size(out));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        if (result && net.Data(sum) != net.Data(conv1))
+        {
+            TEST_LOG_SS(Error, "SynetNetwork doesn't perform in-place addition!");
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool SynetNetworkForwardAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity;
+
+        result = result && SynetNetworkForwardAutoTest(Param(1, 16, 32, 32, 32, _3, _1, _1, _1, _1, 1, aRe, SimdTrue), Param(1, 32, 32, 32, 32, _1, _1, _1, _0, _0, 1, aId, SimdTrue));
+        result = result && SynetNetworkForwardAutoTest(Param(2, 24, 22, 18, 48, _3, _1, _1, _1, _1, 1, aRe, SimdTrue), Param(2, 48, 22, 18, 48, _3, _1, _1, _1, _1, 48, aRe, SimdTrue));
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetMemoryPlannerAutoTest(size_t count, size_t steps, size_t align)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetMemoryPlanner [" << count << "-" << steps << "-" << align << "].");
+
+        struct Block { size_t size, begin, end, id; };
+        std::vector<Block> blocks(count);
+        Simd::SynetMemoryPlanner planner(align);
+        for (size_t i = 0; i < count; ++i)
+        {
+            Block& b = blocks[i];
+            b.size = Random(64 * 1024);
+            b.begin = Random((int)steps);
+            b.end = b.begin + Random(5);
+            b.id = planner.Add(b.size, b.begin, b.end);
+        }
+
+        planner.Plan();
+
+        for (size_t i = 0; i < count && result; ++i)
+        {
+            const Block& a = blocks[i];
+            size_t aOffset = planner.Offset(a.id);
+            if (aOffset % align != 0 || aOffset + a.size > planner.Size())
+            {
+                TEST_LOG_SS(Error, "Wrong placement of block " << i << " : offset " << aOffset << ", size " << a.size << ", arena " << planner.Size() << " !");
+                result = false;
+            }
+            for (size_t j = i + 1; j < count && result; ++j)
+            {
+                const Block& b = blocks[j];
+                size_t bOffset = planner.Offset(b.id);
+                if (a.begin <= b.end && b.begin <= a.end && a.size && b.size && aOffset < bOffset + b.size && bOffset < aOffset + a.size)
+                {
+                    TEST_LOG_SS(Error, "Blocks " << i << " and " << j << " with overlapped lifetimes are overlapped in arena!");
+                    result = false;
+                }
+            }
+        }
+
+        if (result && (planner.Size() < planner.Peak() || planner.Size() > planner.Total()))
+        {
+            TEST_LOG_SS(Error, "Wrong arena size " << planner.Size() << " : peak " << planner.Peak() << ", total " << planner.Total() << " !");
+            result = false;
+        }
+
+        TEST_LOG_SS(Info, "Arena size " << planner.Size() << " (peak " << planner.Peak() << ", total " << planner.Total() << ").");
+
+        return result;
+    }
+
+    bool SynetMemoryPlannerAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        result = result && SynetMemoryPlannerAutoTest(16, 16, 64);
+        result = result && SynetMemoryPlannerAutoTest(100, 40, 64);
+        result = result && SynetMemoryPlannerAutoTest(500, 200, 4096);
+
+        return result;
+    }
+#endif
+}
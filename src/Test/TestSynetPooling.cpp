@@ -557,5 +557,138 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    struct FuncPAd
+    {
+        typedef void(*FuncPtr)(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, SimdTensorDataType type,
+            SimdSynetPoolingMethodType method, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
+
+        FuncPtr func;
+        String desc;
+
+        FuncPAd(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+        void Update(size_t srcC, size_t srcH, size_t srcW, size_t dstH, size_t dstW, SimdTensorDataType type, SimdSynetPoolingMethodType method, SimdTensorFormatType format)
+        {
+            std::stringstream ss;
+            ss << desc;
+            ss << "[" << srcC << "x" << srcH << "x" << srcW << "-" << dstH << "x" << dstW;
+            ss << "-" << ToString(type) << "-" << (method == SimdSynetPoolingMethodMax ? "max" : "avg");
+            ss << "-" << (format == SimdTensorFormatNhwc ? "1" : "0");
+            ss << "]";
+            desc = ss.str();
+        }
+
+        void Call(const Tensor8u& src, size_t srcC, size_t srcH, size_t srcW, SimdTensorDataType type, 
+            SimdSynetPoolingMethodType method, Tensor8u& dst, size_t dstH, size_t dstW, SimdTensorFormatType format) const
+        {
+            TEST_PERFORMANCE_TEST(desc);
+            func(src.Data(), srcC, srcH, srcW, type, method, dst.Data(), dstH, dstW, format);
+        }
+    };
+
+#define FUNC_PAD(function) FuncPAd(function, #function)
+
+    bool SynetPoolingAdaptiveAutoTest(size_t srcC, size_t srcH, size_t srcW, size_t dstH, size_t dstW, SimdTensorDataType type, 
+        SimdSynetPoolingMethodType method, SimdTensorFormatType format, FuncPAd f1, FuncPAd f2)
+    {
+        bool result = true;
+
+        f1.Update(srcC, srcH, srcW, dstH, dstW, type, method, format);
+        f2.Update(srcC, srcH, srcW, dstH, dstW, type, method, format);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << "].");
+
+        size_t srcSize = srcC * srcH * srcW, dstSize = srcC * dstH * dstW, elem = type == SimdTensorData32f ? 4 : (type == SimdTensorData16b ? 2 : 1);
+        Tensor8u src({ srcSize * elem }), dst1({ dstSize * elem }), dst2({ dstSize * elem });
+        Tensor32f src32f({ srcSize }), dst32f1({ dstSize }), dst32f2({ dstSize });
+        if (type == SimdTensorData8u)
+            FillRandom(src.Data(), src.Size(), 0, 255);
+        else
+        {
+            FillRandom(src32f.Data(), src32f.Size(), -1.0f, 1.0f);
+            if (type == SimdTensorData32f)
+                memcpy(src.Data(), src32f.Data(), src.Size());
+            else
+                SimdFloat32ToBFloat16(src32f.Data(), srcSize, (uint16_t*)src.Data());
+        }
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, srcC, srcH, srcW, type, method, dst1, dstH, dstW, format));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, srcC, srcH, srcW, type, method, dst2, dstH, dstW, format));
+
+        if (type == SimdTensorData8u)
+            result = result && Compare(dst1, dst2, 0, true, 64);
+        else
+        {
+            if (type == SimdTensorData32f)
+            {
+                memcpy(dst32f1.Data(), dst1.Data(), dst1.Size());
+                memcpy(dst32f2.Data(), dst2.Data(), dst2.Size());
+            }
+            else
+            {
+                SimdBFloat16ToFloat32((uint16_t*)dst1.Data(), dstSize, dst32f1.Data());
+                SimdBFloat16ToFloat32((uint16_t*)dst2.Data(), dstSize, dst32f2.Data());
+            }
+            result = result && Compare(dst32f1, dst32f2, type == SimdTensorData32f ? EPS : 0.01f, true, 64, DifferenceBoth);
+        }
+
+        return result;
+    }
+
+    bool SynetPoolingAdaptiveAutoTest(SimdTensorDataType t, SimdTensorFormatType f, const FuncPAd& f1, const FuncPAd& f2)
+    {
+        bool result = true;
+
+        const SimdSynetPoolingMethodType pMax = SimdSynetPoolingMethodMax, pAvg = SimdSynetPoolingMethodAverage;
+
+        result = result && SynetPoolingAdaptiveAutoTest(512, 7, 7, 1, 1, t, pAvg, f, f1, f2);
+        result = result && SynetPoolingAdaptiveAutoTest(256, 56, 56, 1, 1, t, pMax, f, f1, f2);
+        result = result && SynetPoolingAdaptiveAutoTest(99, 33, 31, 1, 1, t, pAvg, f, f1, f2);
+        result = result && SynetPoolingAdaptiveAutoTest(130, 17, 23, 5, 7, t, pMax, f, f1, f2);
+        result = result && SynetPoolingAdaptiveAutoTest(64, 20, 20, 6, 6, t, pAvg, f, f1, f2);
+        result = result && SynetPoolingAdaptiveAutoTest(35, 13, 14, 3, 2, t, pAvg, f, f1, f2);
+
+        return result;
+    }
+
+    bool SynetPoolingAdaptiveAutoTest(const FuncPAd& f1, const FuncPAd& f2)
+    {
+        bool result = true;
+
+        result = result && SynetPoolingAdaptiveAutoTest(SimdTensorData32f, SimdTensorFormatNchw, f1, f2);
+        result = result && SynetPoolingAdaptiveAutoTest(SimdTensorData32f, SimdTensorFormatNhwc, f1, f2);
+        result = result && SynetPoolingAdaptiveAutoTest(SimdTensorData16b, SimdTensorFormatNchw, f1, f2);
+        result = result && SynetPoolingAdaptiveAutoTest(SimdTensorData16b, SimdTensorFormatNhwc, f1, f2);
+        result = result && SynetPoolingAdaptiveAutoTest(SimdTensorData8u, SimdTensorFormatNchw, f1, f2);
+        result = result && SynetPoolingAdaptiveAutoTest(SimdTensorData8u, SimdTensorFormatNhwc, f1, f2);
+
+        return result;
+    }
+
+    bool SynetPoolingAdaptiveAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && SynetPoolingAdaptiveAutoTest(FUNC_PAD(Simd::Base::SynetPoolingAdaptive), FUNC_PAD(SimdSynetPoolingAdaptive));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && SynetPoolingAdaptiveAutoTest(FUNC_PAD(Simd::Avx2::SynetPoolingAdaptive), FUNC_PAD(SimdSynetPoolingAdaptive));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && SynetPoolingAdaptiveAutoTest(FUNC_PAD(Simd::Avx512bw::SynetPoolingAdaptive), FUNC_PAD(SimdSynetPoolingAdaptive));
+#endif
+
+        return result;
+    }
 #endif
 }
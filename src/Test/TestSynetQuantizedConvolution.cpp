@@ -57,6 +57,8 @@ namespace Test
                 extra << (p.conv.srcT == SimdTensorData32f ? "-f" : "-u");
                 extra << (p.conv.dstT == SimdTensorData32f ? "f" : "u");
                 extra << afs[p.conv.activation];
+                if (::SimdGetThreadNumber() > 1)
+                    extra << "-t" << ::SimdGetThreadNumber();
                 desc = desc + p.Decription(extra.str());
             }
 
@@ -500,5 +502,64 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetQuantizedConvolutionThreadsAutoTest(const Param& p, size_t threads)
+    {
+        bool result = true;
+
+        QcParams32f p32f;
+        if (!p32f.Init(p))
+            return false;
+
+        QcParams8i p8i;
+        if (!p8i.Init(p, p32f, SimdFalse))
+            return false;
+
+        const uint8_t* src = p8i.src.Data();
+        uint8_t* dst1 = p8i.dst1.Data(), * dst2 = p8i.dst2.Data();
+
+        size_t number = ::SimdGetThreadNumber();
+
+        ::SimdSetThreadNumber(1);
+        void* context1 = ::SimdSynetQuantizedConvolutionInit(p.batch, &p.conv);
+        Tensor8u buf1({ ::SimdSynetQuantizedConvolutionExternalBufferSize(context1) });
+        ::SimdSynetQuantizedConvolutionSetParams(context1, p8i.scale, p8i.zero, p8i.weight.Data(), p8i.weightScale.Data(), p8i.bias.Data(), p32f.params.Data());
+        ::SimdSynetQuantizedConvolutionForward(context1, src, buf1.Data(), dst1);
+        ::SimdRelease(context1);
+
+        ::SimdSetThreadNumber(threads);
+        void* context2 = ::SimdSynetQuantizedConvolutionInit(p.batch, &p.conv);
+        Tensor8u buf2({ ::SimdSynetQuantizedConvolutionExternalBufferSize(context2) });
+        ::SimdSynetQuantizedConvolutionSetParams(context2, p8i.scale, p8i.zero, p8i.weight.Data(), p8i.weightScale.Data(), p8i.bias.Data(), p32f.params.Data());
+
+        TEST_LOG_SS(Info, "Test SynetQuantizedConvolution " << ::SimdSynetQuantizedConvolutionInfo(context2) << p.Decription() << " with " << ::SimdGetThreadNumber() << " threads.");
+
+        ::SimdSynetQuantizedConvolutionForward(context2, src, buf2.Data(), dst2);
+        ::SimdRelease(context2);
+
+        ::SimdSetThreadNumber(number);
+
+        result = result && Compare(p8i.dst1, p8i.dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool SynetQuantizedConvolutionThreadsAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        const Size _0(0, 0), _1(1, 1), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity;
+        const SimdTensorDataType u8 = SimdTensorData8u;
+        const size_t threads = 4;
+
+        result = result && SynetQuantizedConvolutionThreadsAutoTest(Param(1, 64, 56, 56, 64, _3, _1, _1, _1, _1, 1, aRe, SimdTrue, u8, u8), threads);
+        result = result && SynetQuantizedConvolutionThreadsAutoTest(Param(1, 256, 56, 56, 256, _1, _1, _1, _0, _0, 1, aId, SimdTrue, u8, u8), threads);
+        result = result && SynetQuantizedConvolutionThreadsAutoTest(Param(2, 128, 29, 31, 96, _3, _1, _1, _1, _1, 1, aRe, SimdTrue, u8, u8), threads);
+
+        return result;
+    }
 #endif
 }
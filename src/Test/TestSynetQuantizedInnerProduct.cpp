@@ -297,8 +297,14 @@ namespace Test
         result = result && SynetQuantizedInnerProductForwardAutoTest(e, Param(1, 512, 25088, u8, i8, u8, f, t, f), o, f1, f2);
         result = result && SynetQuantizedInnerProductForwardAutoTest(e, Param(1, 25088, 512, u8, i8, u8, f, t, f), o, f1, f2);
 #endif
+#if 1
+        result = result && SynetQuantizedInnerProductForwardAutoTest(e, Param(1, 512, 25088, u8, i8, f32, f, t, f), o, f1, f2);
+        result = result && SynetQuantizedInnerProductForwardAutoTest(e, Param(127, 129, 531, u8, i8, f32, f, t, f), o, f1, f2);
+        result = result && SynetQuantizedInnerProductForwardAutoTest(e, Param(64, 1000, 256, u8, i8, f32, t, t, f), o, f1, f2);
+#endif
 #else
         result = result && SynetQuantizedInnerProductForwardAutoTest(e, Param(1, 512, 25088, u8, i8, u8, f, t, f), o, f1, f2);
+        result = result && SynetQuantizedInnerProductForwardAutoTest(e, Param(17, 65, 129, u8, i8, f32, t, t, f), o, f1, f2);
 #endif
 
         return result;
@@ -31,6 +31,7 @@
 
 #include "Simd/SimdSynetScale8i.h"
 #include "Simd/SimdSynetScale16b.h"
+#include "Simd/SimdSynetSqueezeExcitation16b.h"
 #include "Simd/SimdSynet.h"
 
 namespace Test
@@ -502,5 +503,139 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncSe16b
+        {
+            typedef void* (*FuncPtr)(size_t batch, size_t channels, size_t spatial, size_t squeeze, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdConvolutionActivationType activation);
+
+            FuncPtr func;
+            String desc;
+
+            FuncSe16b(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t b, size_t c, size_t s, size_t q, SimdTensorDataType st, SimdTensorDataType dt, SimdConvolutionActivationType a)
+            {
+                desc = desc + "[" + ToString(b) + "x" + ToString(c) + "x" + ToString(s) + "-" + ToString(q) + "-" + ToChar(st) + ToChar(dt) + "-" + ToString(a) + "]";
+            }
+
+            void Call(void* context, const uint8_t* src, uint8_t* dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetSqueezeExcitation16bForward(context, src, dst);
+            }
+        };
+    }
+
+#define FUNC_SE16B(function) FuncSe16b(function, #function)
+
+    bool SynetSqueezeExcitation16bAutoTest(size_t batch, size_t channels, size_t spatial, size_t squeeze, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdConvolutionActivationType activation, FuncSe16b f1, FuncSe16b f2)
+    {
+        bool result = true;
+
+        f1.Update(batch, channels, spatial, squeeze, srcType, dstType, activation);
+        f2.Update(batch, channels, spatial, squeeze, srcType, dstType, activation);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc);
+
+        Shape shape = Shp(batch, spatial, channels);
+        Tensor32f src32f(shape), dst32f1(shape), dst32f2(shape);
+        Tensor32f weight0(Shp(squeeze, channels)), bias0(Shp(squeeze)), params(Shp(Simd::Max<size_t>(squeeze, 2)));
+        Tensor32f weight1(Shp(channels, squeeze)), bias1(Shp(channels));
+        Tensor16u src16b(shape), dst16b1(shape), dst16b2(shape);
+
+        srand(0);
+        FillRandom(src32f.Data(), src32f.Size(), -1.0, 1.0f);
+        FillRandom(weight0.Data(), weight0.Size(), -1.0, 1.0f);
+        FillRandom(bias0.Data(), bias0.Size(), -1.0, 1.0f);
+        FillRandom(weight1.Data(), weight1.Size(), -1.0, 1.0f);
+        FillRandom(bias1.Data(), bias1.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 0.1f);
+        if (activation == SimdConvolutionActivationSwish)
+            params.Data()[0] = 1.0f;
+
+        SimdFloat32ToBFloat16(src32f.Data(), src32f.Size(), src16b.Data());
+
+        Fill(dst32f1, 1.0f);
+        Fill(dst32f2, 2.0f);
+
+        Fill(dst16b1.Data(), dst16b1.Size(), uint16_t(1));
+        Fill(dst16b2.Data(), dst16b2.Size(), uint16_t(2));
+
+        const uint8_t* src = srcType == SimdTensorData32f ? (uint8_t*)src32f.Data() : (uint8_t*)src16b.Data();
+        uint8_t* dst1 = dstType == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : (uint8_t*)dst16b1.Data();
+        uint8_t* dst2 = dstType == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : (uint8_t*)dst16b2.Data();
+
+        void* context1 = f1.func(batch, channels, spatial, squeeze, srcType, dstType, activation);
+        void* context2 = f2.func(batch, channels, spatial, squeeze, srcType, dstType, activation);
+
+        if (context1 == NULL)
+            return true;
+
+        ::SimdSynetSqueezeExcitation16bSetParams(context1, weight0.Data(), bias0.Data(), params.Data(), weight1.Data(), bias1.Data());
+        ::SimdSynetSqueezeExcitation16bSetParams(context2, weight0.Data(), bias0.Data(), params.Data(), weight1.Data(), bias1.Data());
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        float eps = EPS;
+        if (dstType == SimdTensorData16b)
+        {
+            eps = eps * 7.8f;
+            SimdBFloat16ToFloat32(dst16b1.Data(), dst16b1.Size(), dst32f1.Data());
+            SimdBFloat16ToFloat32(dst16b2.Data(), dst16b2.Size(), dst32f2.Data());
+        }
+        result = result && Compare(dst32f1, dst32f2, eps, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetSqueezeExcitation16bAutoTest(const FuncSe16b& f1, const FuncSe16b& f2)
+    {
+        bool result = true;
+
+        const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aSw = SimdConvolutionActivationSwish;
+
+#if 1
+        result = result && SynetSqueezeExcitation16bAutoTest(1, 96, 56 * 56, 4, f32, f32, aSw, f1, f2);
+        result = result && SynetSqueezeExcitation16bAutoTest(2, 240, 28 * 28, 10, b16, b16, aSw, f1, f2);
+        result = result && SynetSqueezeExcitation16bAutoTest(1, 672, 14 * 14, 28, f32, b16, aSw, f1, f2);
+        result = result && SynetSqueezeExcitation16bAutoTest(1, 1152, 7 * 7, 48, b16, f32, aSw, f1, f2);
+        result = result && SynetSqueezeExcitation16bAutoTest(2, 67, 13 * 11, 5, f32, f32, aRe, f1, f2);
+        result = result && SynetSqueezeExcitation16bAutoTest(1, 123, 9 * 7, 17, b16, b16, aRe, f1, f2);
+#endif
+
+        return result;
+    }
+
+    bool SynetSqueezeExcitation16bAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && SynetSqueezeExcitation16bAutoTest(FUNC_SE16B(Simd::Base::SynetSqueezeExcitation16bInit), FUNC_SE16B(SimdSynetSqueezeExcitation16bInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && SynetSqueezeExcitation16bAutoTest(FUNC_SE16B(Simd::Avx2::SynetSqueezeExcitation16bInit), FUNC_SE16B(SimdSynetSqueezeExcitation16bInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && SynetSqueezeExcitation16bAutoTest(FUNC_SE16B(Simd::Avx512bw::SynetSqueezeExcitation16bInit), FUNC_SE16B(SimdSynetSqueezeExcitation16bInit));
+#endif
+
+        return result;
+    }
 #endif
 }
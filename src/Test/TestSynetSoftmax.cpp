@@ -234,5 +234,214 @@ namespace Test
         return result;
     }
 
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncSmM
+        {
+            typedef void(*Func32fPtr)(const float* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, float* dst);
+            typedef void(*Func16bPtr)(const uint16_t* src, size_t outer, size_t count, const float* mask, size_t maskOuter, SimdBool log, uint16_t* dst);
+
+            Func32fPtr func32f;
+            Func16bPtr func16b;
+            String desc;
+
+            FuncSmM(const Func32fPtr& f32, const Func16bPtr& f16, const String& d) : func32f(f32), func16b(f16), desc(d) {}
+
+            void Update(size_t outer, size_t count, size_t maskOuter, SimdBool log, SimdTensorDataType type)
+            {
+                desc = desc + "[" + ToString(outer) + "-" + ToString(count) + "-" + ToString(maskOuter) + "-" + ToChar(type) + (log ? "-log" : "") + "]";
+            }
+
+            void Call(const Tensor32f& src32f, const Tensor16u& src16b, const float* mask, size_t maskOuter, SimdBool log, SimdTensorDataType type, Tensor32f& dst32f, Tensor16u& dst16b) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                if (type == SimdTensorData32f)
+                    func32f(src32f.Data(), src32f.Axis(0), src32f.Axis(1), mask, maskOuter, log, dst32f.Data());
+                else
+                    func16b(src16b.Data(), src16b.Axis(0), src16b.Axis(1), mask, maskOuter, log, dst16b.Data());
+            }
+        };
+    }
+
+#define FUNC_SMM(function) FuncSmM(function##32f, function##16b, #function)
+
+    bool SynetSoftmaxMaskedAutoTest(size_t outer, size_t count, size_t maskOuter, SimdBool log, SimdTensorDataType type, FuncSmM f1, FuncSmM f2)
+    {
+        bool result = true;
+
+        f1.Update(outer, count, maskOuter, log, type);
+        f2.Update(outer, count, maskOuter, log, type);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src32f(Shp(outer, count));
+        Tensor16u src16b(Shp(outer, count));
+        FillRandom(src32f.Data(), src32f.Size(), -10.0, 10.0);
+        SimdFloat32ToBFloat16(src32f.Data(), src32f.Size(), src16b.Data());
+
+        Tensor32f mask(Shp(Simd::Max<size_t>(maskOuter, 1), count));
+        for (size_t i = 0; i < mask.Size(); ++i)
+            mask.Data()[i] = Random(4) == 0 ? -10000.0f : 0.0f;
+        const float* pMask = maskOuter ? mask.Data() : NULL;
+
+        Tensor32f dst32f1(Shp(outer, count)), dst32f2(Shp(outer, count));
+        Tensor16u dst16b1(Shp(outer, count)), dst16b2(Shp(outer, count));
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src32f, src16b, pMask, maskOuter, log, type, dst32f1, dst16b1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src32f, src16b, pMask, maskOuter, log, type, dst32f2, dst16b2));
+
+        float eps = EPS;
+        if (type == SimdTensorData16b)
+        {
+            eps = eps * 8.0f;
+            SimdBFloat16ToFloat32(dst16b1.Data(), dst16b1.Size(), dst32f1.Data());
+            SimdBFloat16ToFloat32(dst16b2.Data(), dst16b2.Size(), dst32f2.Data());
+        }
+        result = result && Compare(dst32f1, dst32f2, eps, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetSoftmaxMaskedAutoTest(const FuncSmM& f1, const FuncSmM& f2)
+    {
+        bool result = true;
+
+        const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+        const SimdBool t = SimdTrue, f = SimdFalse;
+
+        result = result && SynetSoftmaxMaskedAutoTest(12 * 128, 128, 1, f, f32, f1, f2);
+        result = result && SynetSoftmaxMaskedAutoTest(12 * 77, 77, 77, f, f32, f1, f2);
+        result = result && SynetSoftmaxMaskedAutoTest(12 * 77, 77, 77, f, b16, f1, f2);
+        result = result && SynetSoftmaxMaskedAutoTest(8 * 197, 197, 0, t, f32, f1, f2);
+        result = result && SynetSoftmaxMaskedAutoTest(8 * 197, 197, 1, t, b16, f1, f2);
+        result = result && SynetSoftmaxMaskedAutoTest(64, 32000, 0, t, f32, f1, f2);
+
+        return result;
+    }
+
+    bool SynetSoftmaxMaskedAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && SynetSoftmaxMaskedAutoTest(FUNC_SMM(Simd::Base::SynetSoftmaxMasked), FUNC_SMM(SimdSynetSoftmaxMasked));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && SynetSoftmaxMaskedAutoTest(FUNC_SMM(Simd::Avx2::SynetSoftmaxMasked), FUNC_SMM(SimdSynetSoftmaxMasked));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && SynetSoftmaxMaskedAutoTest(FUNC_SMM(Simd::Avx512bw::SynetSoftmaxMasked), FUNC_SMM(SimdSynetSoftmaxMasked));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncSmTk
+        {
+            typedef void(*Func32fPtr)(const float* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value);
+            typedef void(*Func16bPtr)(const uint16_t* src, size_t outer, size_t count, size_t k, SimdBool log, uint32_t* index, float* value);
+
+            Func32fPtr func32f;
+            Func16bPtr func16b;
+            String desc;
+
+            FuncSmTk(const Func32fPtr& f32, const Func16bPtr& f16, const String& d) : func32f(f32), func16b(f16), desc(d) {}
+
+            void Update(size_t outer, size_t count, size_t k, SimdBool log, SimdTensorDataType type)
+            {
+                desc = desc + "[" + ToString(outer) + "-" + ToString(count) + "-" + ToString(k) + "-" + ToChar(type) + (log ? "-log" : "") + "]";
+            }
+
+            void Call(const Tensor32f& src32f, const Tensor16u& src16b, size_t k, SimdBool log, SimdTensorDataType type, Tensor32u& index, Tensor32f& value) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                if (type == SimdTensorData32f)
+                    func32f(src32f.Data(), src32f.Axis(0), src32f.Axis(1), k, log, index.Data(), value.Data());
+                else
+                    func16b(src16b.Data(), src16b.Axis(0), src16b.Axis(1), k, log, index.Data(), value.Data());
+            }
+        };
+    }
+
+#define FUNC_SMTK(function) FuncSmTk(function##32f, function##16b, #function)
+
+    bool SynetSoftmaxTopKAutoTest(size_t outer, size_t count, size_t k, SimdBool log, SimdTensorDataType type, FuncSmTk f1, FuncSmTk f2)
+    {
+        bool result = true;
+
+        f1.Update(outer, count, k, log, type);
+        f2.Update(outer, count, k, log, type);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src32f(Shp(outer, count));
+        Tensor16u src16b(Shp(outer, count));
+        FillRandom(src32f.Data(), src32f.Size(), -10.0, 10.0);
+        SimdFloat32ToBFloat16(src32f.Data(), src32f.Size(), src16b.Data());
+
+        Tensor32u index1(Shp(outer, k)), index2(Shp(outer, k));
+        Tensor32f value1(Shp(outer, k)), value2(Shp(outer, k));
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src32f, src16b, k, log, type, index1, value1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src32f, src16b, k, log, type, index2, value2));
+
+        result = result && Compare(index1, index2, 0, true, 64, "index");
+        result = result && Compare(value1, value2, EPS, true, 64, DifferenceBoth, "value");
+
+        return result;
+    }
+
+    bool SynetSoftmaxTopKAutoTest(const FuncSmTk& f1, const FuncSmTk& f2)
+    {
+        bool result = true;
+
+        const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+        const SimdBool t = SimdTrue, f = SimdFalse;
+
+        result = result && SynetSoftmaxTopKAutoTest(16, 1000, 5, f, f32, f1, f2);
+        result = result && SynetSoftmaxTopKAutoTest(16, 1000, 1, t, f32, f1, f2);
+        result = result && SynetSoftmaxTopKAutoTest(3, 21843, 10, f, f32, f1, f2);
+        result = result && SynetSoftmaxTopKAutoTest(7, 1001, 5, t, b16, f1, f2);
+        result = result && SynetSoftmaxTopKAutoTest(4, 20000, 1, f, b16, f1, f2);
+        result = result && SynetSoftmaxTopKAutoTest(33, 17, 17, f, f32, f1, f2);
+
+        return result;
+    }
+
+    bool SynetSoftmaxTopKAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && SynetSoftmaxTopKAutoTest(FUNC_SMTK(Simd::Base::SynetSoftmaxTopK), FUNC_SMTK(SimdSynetSoftmaxTopK));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && SynetSoftmaxTopKAutoTest(FUNC_SMTK(Simd::Avx2::SynetSoftmaxTopK), FUNC_SMTK(SimdSynetSoftmaxTopK));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && SynetSoftmaxTopKAutoTest(FUNC_SMTK(Simd::Avx512bw::SynetSoftmaxTopK), FUNC_SMTK(SimdSynetSoftmaxTopK));
+#endif
+
+        return result;
+    }
+
 #endif
 }
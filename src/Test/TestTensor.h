@@ -353,6 +353,7 @@ namespace Test
     typedef Tensor<float> Tensor32f;
     typedef Tensor<uint8_t> Tensor8u;
     typedef Tensor<uint16_t> Tensor16u;
+    typedef Tensor<uint32_t> Tensor32u;
 
     //-------------------------------------------------------------------------------------------------
 